@@ -0,0 +1,150 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/*
+ * Benchmark: Codegen node dispatch
+ * Purpose: Measure what classifying AST nodes costs when passes dispatch on
+ *          one switch on the StmtKind/ExprKind tag versus a ladder of
+ *          astCast tests in the order the former dynamic_cast chains used
+ *          (nodes are no longer polymorphic, see AstArena::make), and report end-to-end codegen throughput on a large program.
+ * Components Under Test: Stmt/Expr kind tags, CodeGenerator::generate.
+ * Usage: basic_compiler_bench_codegen_dispatch [statements] (default 1000000)
+ * Output: one line per measurement (ms and statements/s).
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+using namespace gwbasic;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// A mix of every statement kind codegen accepts at top level, one per line.
+std::string makeSource(long statements) {
+    std::string src;
+    src.reserve(static_cast<size_t>(statements) * 24);
+    for (long i = 0; i < statements; ++i) {
+        const long ln = i + 1;
+        src += std::to_string(ln);
+        switch (i % 6) {
+            case 0: src += " LET X = X + I * 2 - (Y / 3)\n"; break;
+            case 1: src += " PRINT X\n"; break;
+            case 2: src += " IF X > 100 THEN " + std::to_string(ln + 1) + "\n"; break;
+            case 3: src += " PRINT \"tick\"\n"; break;
+            case 4: src += " FOR I = 1 TO 3: Y = Y + I: NEXT I\n"; break;
+            default: src += " Y = -Y + 1\n"; break;
+        }
+    }
+    src += std::to_string(statements + 1) + " END\n";
+    return src;
+}
+
+// Ladder classification: one astCast per kind in the order of the dynamic_cast
+// chains the passes used before the kind tag (statement order as in
+// emitLineBlock, expression order as in emitExpr).
+int classifyByCast(const Expr* e) {
+    if (astCast<NumberExpr>(e)) return 1;
+    if (auto v = astCast<VarExpr>(e)) return 2 + static_cast<int>(v->name.size());
+    if (auto u = astCast<UnaryExpr>(e)) return 3 + classifyByCast(u->inner.get());
+    if (auto b = astCast<BinaryExpr>(e)) return 4 + classifyByCast(b->lhs.get()) + classifyByCast(b->rhs.get());
+    if (astCast<StringExpr>(e)) return 5;
+    return 0;
+}
+
+int classifyByCast(const Stmt* s) {
+    if (auto a = astCast<AssignStmt>(s)) return 1 + classifyByCast(a->value.get());
+    if (auto p = astCast<PrintStmt>(s)) return 2 + classifyByCast(p->value.get());
+    if (astCast<GotoStmt>(s)) return 3;
+    if (astCast<GosubStmt>(s)) return 4;
+    if (auto i = astCast<IfStmt>(s)) return 5 + classifyByCast(i->cond.get());
+    if (astCast<EndStmt>(s)) return 6;
+    if (astCast<InputStmt>(s)) return 7;
+    if (auto f = astCast<ForStmt>(s)) {
+        int n = 8 + classifyByCast(f->start.get()) + classifyByCast(f->end.get());
+        for (const auto& b : f->body) n += classifyByCast(b.get());
+        return n;
+    }
+    if (astCast<ReturnStmt>(s)) return 9;
+    return 0;
+}
+
+// Tag-based classification: one load and one switch per node.
+int classifyByKind(const Expr* e) {
+    switch (e->kind) {
+        case ExprKind::Number: return 1;
+        case ExprKind::Var: return 2 + static_cast<int>(static_cast<const VarExpr*>(e)->name.size());
+        case ExprKind::Unary: return 3 + classifyByKind(static_cast<const UnaryExpr*>(e)->inner.get());
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            return 4 + classifyByKind(b->lhs.get()) + classifyByKind(b->rhs.get());
+        }
+        case ExprKind::String: return 5;
+        default: return 0;
+    }
+}
+
+int classifyByKind(const Stmt* s) {
+    switch (s->kind) {
+        case StmtKind::Assign: return 1 + classifyByKind(static_cast<const AssignStmt*>(s)->value.get());
+        case StmtKind::Print: return 2 + classifyByKind(static_cast<const PrintStmt*>(s)->value.get());
+        case StmtKind::Goto: return 3;
+        case StmtKind::Gosub: return 4;
+        case StmtKind::If: return 5 + classifyByKind(static_cast<const IfStmt*>(s)->cond.get());
+        case StmtKind::End: return 6;
+        case StmtKind::Input: return 7;
+        case StmtKind::For: {
+            const auto* f = static_cast<const ForStmt*>(s);
+            int n = 8 + classifyByKind(f->start.get()) + classifyByKind(f->end.get());
+            for (const auto& b : f->body) n += classifyByKind(b.get());
+            return n;
+        }
+        case StmtKind::Return: return 9;
+        default: return 0;
+    }
+}
+
+template <class F>
+void timeWalk(const char* label, const Program& prog, long statements, F&& classify) {
+    constexpr int kRounds = 5;
+    long long checksum = 0;
+    const auto t0 = Clock::now();
+    for (int r = 0; r < kRounds; ++r)
+        for (const auto& line : prog.lines)
+            for (const auto& st : line.statements) checksum += classify(st.get());
+    const double ms = msSince(t0) / kRounds;
+    std::printf("%-28s %10.2f ms  %12.0f stmts/s  (checksum %lld)\n",
+                label, ms, statements / (ms / 1000.0), checksum / kRounds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long statements = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 1000000;
+    if (statements <= 0) { std::fprintf(stderr, "statement count must be positive\n"); return 2; }
+
+    const std::string src = makeSource(statements);
+    Lexer lex(src);
+    Parser parser(lex.tokenize());
+    Program prog = parser.parseProgram();
+    std::printf("program: %ld statements, %zu lines\n", statements, prog.lines.size());
+
+    timeWalk("classify (cast ladder)", prog, statements, [](const Stmt* s) { return classifyByCast(s); });
+    timeWalk("classify (kind switch)", prog, statements, [](const Stmt* s) { return classifyByKind(s); });
+
+    const auto t0 = Clock::now();
+    CodeGenerator gen;
+    const std::string ir = gen.generate(prog);
+    const double ms = msSince(t0);
+    std::printf("%-28s %10.2f ms  %12.0f stmts/s  (%zu bytes IR)\n",
+                "codegen (generate)", ms, statements / (ms / 1000.0), ir.size());
+    return 0;
+}
@@ -0,0 +1,60 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/*
+ * Benchmark: GOSUB nesting
+ * Purpose: Show that IR size and compile time stay linear in the number of
+ *          nested subroutines. Each subroutine calls the next one twice, so
+ *          expanding every call inline would double the IR per level.
+ * Components Under Test: CodeGenerator::emitGosub, return dispatch.
+ * Usage: basic_compiler_bench_gosub_nesting [max-depth] (default 4096)
+ * Output: one line per depth (ms and IR bytes).
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// Subroutine k lives at line 1000 + 10k and calls k + 1 twice; the last one
+// is a real (non-leaf) body so nothing is inlined.
+std::string makeSource(long depth) {
+    std::string src = "10 GOSUB 1000\n20 PRINT X\n30 END\n";
+    for (long k = 0; k < depth; ++k) {
+        const long ln = 1000 + 10 * k;
+        src += std::to_string(ln) + " LET X = X + 1";
+        if (k + 1 < depth) {
+            const std::string next = std::to_string(ln + 10);
+            src += " : GOSUB " + next + " : GOSUB " + next;
+        } else {
+            src += " : IF X > 0 THEN " + std::to_string(ln + 5);
+        }
+        src += "\n" + std::to_string(ln + 5) + " RETURN\n";
+    }
+    return src;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long maxDepth = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 4096;
+    if (maxDepth <= 0) { std::fprintf(stderr, "depth must be positive\n"); return 2; }
+    for (long depth = 4; depth <= maxDepth; depth *= 4) {
+        const std::string src = makeSource(depth);
+        const auto t0 = Clock::now();
+        const std::size_t irBytes = Compiler::compileString(src).size();
+        const double ms = msSince(t0);
+        std::printf("depth %6ld  %10.2f ms  (ir %zu bytes, %.0f bytes/level)\n",
+                    depth, ms, irBytes, static_cast<double>(irBytes) / depth);
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/*
+ * Benchmark: Lexer keyword recognition
+ * Purpose: Measure identifier classification with the compile-time keyword
+ *          table against the former upper-case-copy-and-compare chain, and
+ *          report whole-lexer throughput on keyword-dense input.
+ * Components Under Test: lookupKeyword, Lexer::next.
+ * Usage: basic_compiler_bench_lexer_keywords [lines] (default 1000000)
+ * Output: one line per measurement (ms, words/s or tokens/s and MB/s).
+ */
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/token/KeywordTable.h"
+
+using namespace gwbasic;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// Mostly keywords in mixed case, plus identifiers that share a keyword's
+// length or prefix (the worst case for bucketed lookup).
+std::string makeSource(long lines) {
+    static const char* const kLines[] = {
+        " FOR I = 1 TO 10 STEP 2: PRINT I: NEXT I\n",
+        " if X > 1 then 10\n",
+        " Gosub 20: Return\n",
+        " LET TOTAL = FORX + GOTOS\n",
+        " INPUT N: print N: goto 10\n",
+        " REM keyword dense comment\n",
+        " THEN1 = STEPS + NEXTX: End\n",
+    };
+    std::string src;
+    src.reserve(static_cast<size_t>(lines) * 32);
+    for (long i = 0; i < lines; ++i) {
+        src += std::to_string(i + 1);
+        src += kLines[i % std::size(kLines)];
+    }
+    return src;
+}
+
+// Former identifierOrKeyword classification: copy, upper-case, compare.
+TokenType classifyByChain(std::string_view buf) {
+    std::string upper;
+    upper.reserve(buf.size());
+    for (const char c : buf) upper.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+    if (upper == "LET") return TokenType::KwLet;
+    if (upper == "PRINT") return TokenType::KwPrint;
+    if (upper == "IF") return TokenType::KwIf;
+    if (upper == "THEN") return TokenType::KwThen;
+    if (upper == "GOTO") return TokenType::KwGoto;
+    if (upper == "END") return TokenType::KwEnd;
+    if (upper == "FOR") return TokenType::KwFor;
+    if (upper == "TO") return TokenType::KwTo;
+    if (upper == "STEP") return TokenType::KwStep;
+    if (upper == "NEXT") return TokenType::KwNext;
+    if (upper == "GOSUB") return TokenType::KwGosub;
+    if (upper == "RETURN") return TokenType::KwReturn;
+    if (upper == "INPUT") return TokenType::KwInput;
+    if (upper == "REM") return TokenType::KwRem;
+    return TokenType::Identifier;
+}
+
+// Identifier-shaped words of the source, as the lexer would hand them over.
+std::vector<std::string_view> splitWords(std::string_view src) {
+    std::vector<std::string_view> words;
+    size_t i = 0;
+    while (i < src.size()) {
+        if (!std::isalpha(static_cast<unsigned char>(src[i]))) { ++i; continue; }
+        const size_t start = i;
+        while (i < src.size() && (std::isalnum(static_cast<unsigned char>(src[i])) || src[i] == '_')) ++i;
+        words.push_back(src.substr(start, i - start));
+    }
+    return words;
+}
+
+template <class F>
+void timeClassify(const char* label, const std::vector<std::string_view>& words, F&& classify) {
+    constexpr int kRounds = 5;
+    long long checksum = 0;
+    const auto t0 = Clock::now();
+    for (int r = 0; r < kRounds; ++r)
+        for (const auto w : words) checksum += static_cast<int>(classify(w));
+    const double ms = msSince(t0) / kRounds;
+    std::printf("%-28s %10.2f ms  %12.0f words/s   (checksum %lld)\n",
+                label, ms, words.size() / (ms / 1000.0), checksum / kRounds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long lines = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 1000000;
+    if (lines <= 0) { std::fprintf(stderr, "line count must be positive\n"); return 2; }
+
+    const std::string src = makeSource(lines);
+    const auto words = splitWords(src);
+    std::printf("input: %ld lines, %zu bytes, %zu words\n", lines, src.size(), words.size());
+
+    timeClassify("classify (copy + chain)", words, classifyByChain);
+    timeClassify("classify (keyword table)", words, lookupKeyword);
+
+    const auto t0 = Clock::now();
+    Lexer lex(src);
+    size_t tokens = 0;
+    while (lex.next().type != TokenType::EndOfFile) ++tokens;
+    const double ms = msSince(t0);
+    std::printf("%-28s %10.2f ms  %12.0f tokens/s  %8.1f MB/s\n",
+                "lexer (next)", ms, tokens / (ms / 1000.0), src.size() / (ms * 1000.0));
+    return 0;
+}
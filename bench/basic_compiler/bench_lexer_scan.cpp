@@ -0,0 +1,122 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/*
+ * Benchmark: Lexer run scanning
+ * Purpose: Measure raw throughput of the block-wise run scanners against a
+ *          byte-at-a-time loop, and whole-lexer throughput on a source with
+ *          long identifiers, literals and comments.
+ * Components Under Test: lexer/Scan.h kernels (SSE2/AVX2/NEON/scalar),
+ *          Lexer::next.
+ * Usage: basic_compiler_bench_lexer_scan [megabytes] (default 64)
+ * Output: one line per measurement (ms and GB/s).
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/lexer/Simd.h"
+
+using namespace gwbasic;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// Lines dominated by long runs: the shape that benefits from block scanning.
+std::string makeSource(size_t bytes) {
+    std::string src;
+    src.reserve(bytes + 256);
+    for (long ln = 1; src.size() < bytes; ++ln) {
+        src += std::to_string(ln);
+        switch (ln % 4) {
+            case 0: src += " LET ACCUMULATED_TOTAL_FOR_REPORT = ACCUMULATED_TOTAL_FOR_REPORT + 1234567.875\n"; break;
+            case 1: src += " PRINT \"a fairly long message that the scanner can skip in a few blocks\"\n"; break;
+            case 2: src += " REM a long remark explaining what the next few lines of the program do\n"; break;
+            default: src += "                                GOTO 10 ' trailing comment after indentation\n"; break;
+        }
+    }
+    return src;
+}
+
+template <class F>
+void timeScan(const char* label, const std::string& src, F&& scan) {
+    constexpr int kRounds = 5;
+    size_t checksum = 0;
+    const auto t0 = Clock::now();
+    for (int r = 0; r < kRounds; ++r) checksum += scan(src.data(), src.data() + src.size());
+    const double ms = msSince(t0) / kRounds;
+    std::printf("%-30s %10.2f ms  %8.2f GB/s  (checksum %zu)\n",
+                label, ms, src.size() / (ms * 1e6), checksum / kRounds);
+}
+
+// Visit every line as a comment would be skipped: find each '\n'.
+size_t linesScalar(const char* p, const char* end) {
+    size_t n = 0;
+    for (; p < end; ++p) n += *p == '\n';
+    return n;
+}
+
+size_t linesBlocked(const char* p, const char* end) {
+    size_t n = 0;
+    while ((p = scanLineEnd(p, end)) != end) { ++n; ++p; }
+    return n;
+}
+
+// Split into identifier-character runs and count them; separators are
+// skipped the same way in both variants so only the run scan differs.
+bool isIdent(char ch) {
+    const unsigned char c = static_cast<unsigned char>(ch);
+    const unsigned char l = static_cast<unsigned char>(c | 0x20);
+    return (l >= 'a' && l <= 'z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+size_t identRunsScalar(const char* p, const char* end) {
+    size_t n = 0;
+    while (p < end) {
+        if (!isIdent(*p)) { ++p; continue; }
+        ++n;
+        while (p < end && isIdent(*p)) ++p;
+    }
+    return n;
+}
+
+size_t identRunsBlocked(const char* p, const char* end) {
+    size_t n = 0;
+    while (p < end) {
+        if (!isIdent(*p)) { ++p; continue; }
+        ++n;
+        p = scanIdentChars(p, end);
+    }
+    return n;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long mb = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 64;
+    if (mb <= 0) { std::fprintf(stderr, "size must be positive\n"); return 2; }
+
+    const std::string src = makeSource(static_cast<size_t>(mb) << 20);
+    std::printf("input: %zu bytes, scanner isa: %s (%zu-byte blocks)\n", src.size(), simd::kIsa, simd::kWidth);
+
+    timeScan("line ends (byte loop)", src, linesScalar);
+    timeScan("line ends (scanLineEnd)", src, linesBlocked);
+    timeScan("newlines (countNewlines)", src, countNewlines);
+    timeScan("ident runs (byte loop)", src, identRunsScalar);
+    timeScan("ident runs (scanIdentChars)", src, identRunsBlocked);
+
+    const auto t0 = Clock::now();
+    Lexer lex(src);
+    size_t tokens = 0;
+    while (lex.next().type != TokenType::EndOfFile) ++tokens;
+    const double ms = msSince(t0);
+    std::printf("%-30s %10.2f ms  %8.2f GB/s  (%zu tokens)\n",
+                "lexer (next)", ms, src.size() / (ms * 1e6), tokens);
+    return 0;
+}
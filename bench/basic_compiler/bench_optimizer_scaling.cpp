@@ -0,0 +1,112 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/*
+ * Benchmark: Optimizer scaling
+ * Purpose: Show how the -O2 pass pipeline scales with program size on
+ *          random LET/IF/FOR/GOSUB/PRINT programs (constants, copies, jumps
+ *          in both directions, a few hundred variables), doubling the line
+ *          count each step. Time per line should stay roughly flat; a
+ *          pass that grows faster than the program shows up among the
+ *          slowest listed.
+ * Components Under Test: PassManager::forLevel(O2), the dataflow passes.
+ * Usage: basic_compiler_bench_optimizer_scaling [max-lines] [seed]
+ *        (defaults 64000 and 1)
+ * Output: one line per size (total ms, us/line, rounds) followed by the
+ *         passes that took the most time.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/PassManager.h"
+
+using namespace gwbasic;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// Small deterministic generator so every run compiles the same programs.
+struct Rng {
+    std::uint64_t s;
+    std::uint32_t next(std::uint32_t bound) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(s >> 33) % bound;
+    }
+};
+
+std::string makeSource(long lines, std::uint64_t seed) {
+    constexpr long kSubroutines = 8;
+    Rng rng{seed};
+    // A0..Z9 and the bare letters: a few hundred variables, so sets sized by
+    // the symbol count are not trivially small.
+    auto var = [&] {
+        std::string v(1, static_cast<char>('A' + rng.next(26)));
+        if (const std::uint32_t d = rng.next(11); d < 10) v += static_cast<char>('0' + d);
+        return v;
+    };
+    auto term = [&] { return rng.next(3) == 0 ? std::to_string(rng.next(10)) : var(); };
+    auto lineOf = [&](long i) { return std::to_string(i * 10); };
+    std::string src;
+    src.reserve(static_cast<std::size_t>(lines) * 32);
+    for (long i = 1; i <= lines; ++i) {
+        src += lineOf(i);
+        const std::uint32_t pick = rng.next(20);
+        if (pick < 5) {
+            src += " LET " + var() + " = " + term() + " + " + term();
+        } else if (pick < 8) {
+            src += " LET " + var() + " = " + var(); // copy
+        } else if (pick < 10) {
+            src += " LET " + var() + " = " + std::to_string(rng.next(100)); // constant
+        } else if (pick < 13) {
+            // Mostly short forward jumps, some backward ones (loops)
+            const long span = 1 + static_cast<long>(rng.next(20));
+            const long target = rng.next(4) == 0 ? std::max(1L, i - span) : std::min(lines, i + span);
+            src += " IF " + var() + " < " + term() + " THEN " + lineOf(target);
+        } else if (pick < 15) {
+            src += " FOR I = 1 TO " + std::to_string(1 + rng.next(9)) + " : " + var() + " = " + var() + " + I : NEXT I";
+        } else if (pick < 16) {
+            src += " GOSUB " + lineOf(lines + 2 + static_cast<long>(rng.next(kSubroutines)));
+        } else {
+            src += " PRINT " + term() + " * " + term();
+        }
+        src += "\n";
+    }
+    src += lineOf(lines + 1) + " END\n";
+    for (long k = 0; k < kSubroutines; ++k)
+        src += lineOf(lines + 2 + k) + " LET " + var() + " = " + term() + " + 1 : RETURN\n";
+    return src;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long maxLines = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 64000;
+    const auto seed = static_cast<std::uint64_t>(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1);
+    if (maxLines <= 0) { std::fprintf(stderr, "max-lines must be positive\n"); return 2; }
+    for (long lines = 1000; lines <= maxLines; lines *= 2) {
+        const std::string src = makeSource(lines, seed);
+        Lexer lex(src);
+        Parser parser(lex);
+        Program program = parser.parseProgram();
+        const auto t0 = Clock::now();
+        const PassStats stats = PassManager::forLevel(OptLevel::O2).run(program);
+        const double ms = msSince(t0);
+        std::printf("lines %7ld  %10.2f ms  %7.2f us/line  rounds %d%s\n", lines, ms, 1000.0 * ms / lines,
+                    stats.rounds, stats.converged ? "" : " (round limit)");
+        std::vector<PassStats::Pass> slowest = stats.passes;
+        std::sort(slowest.begin(), slowest.end(), [](const auto& a, const auto& b) { return a.ms > b.ms; });
+        for (std::size_t k = 0; k < slowest.size() && k < 3; ++k)
+            std::printf("    %-22.*s %10.2f ms\n", static_cast<int>(slowest[k].name.size()), slowest[k].name.data(), slowest[k].ms);
+    }
+    return 0;
+}
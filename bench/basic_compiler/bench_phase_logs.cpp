@@ -0,0 +1,79 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/*
+ * Benchmark: Phase logging overhead
+ * Purpose: Measure a full compile with every phase log disabled and with
+ *          the lex/syntax/semantic/codegen logs all enabled (as the CLI
+ *          does by default) in text and binary form, to show what logging
+ *          costs in time and disk.
+ * Components Under Test: logging::Channel (Text/Binary), GWBASIC_LOG call
+ *          sites in the lexer, parser and code generator.
+ * Usage: basic_compiler_bench_phase_logs [lines] [log-dir]
+ *        (defaults 200000 and the system temp directory)
+ * Output: one line per configuration (ms, lines/s, log bytes written).
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+std::string makeSource(long lines) {
+    std::string src;
+    src.reserve(static_cast<size_t>(lines) * 48);
+    for (long i = 1; i <= lines; ++i) {
+        src += std::to_string(i * 10);
+        switch (i % 4) {
+            case 0: src += " LET TOTAL = TOTAL + X * 2 - Y / 3\n"; break;
+            case 1: src += " PRINT \"progress\"\n"; break;
+            case 2: src += " IF TOTAL > 100 THEN " + std::to_string(i * 10 + 10) + "\n"; break;
+            default: src += " FOR K = 1 TO 4: LET X = X + K: NEXT K\n"; break;
+        }
+    }
+    src += std::to_string(lines * 10 + 10) + " END\n";
+    return src;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long lines = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 200000;
+    if (lines <= 0) { std::fprintf(stderr, "line count must be positive\n"); return 2; }
+    const std::filesystem::path dir = argc > 2 ? std::filesystem::path(argv[2]) : std::filesystem::temp_directory_path();
+
+    const std::string src = makeSource(lines);
+    const std::string base = (dir / "gwbasic_bench_phase_logs").string();
+
+    auto t0 = Clock::now();
+    size_t irBytes = Compiler::compileString(src).size();
+    double ms = msSince(t0);
+    std::printf("%-14s %10.2f ms  %10.0f lines/s  (ir %zu bytes)\n", "logs off", ms, lines / (ms / 1e3), irBytes);
+
+    for (const auto format : {logging::Format::Text, logging::Format::Binary}) {
+        t0 = Clock::now();
+        irBytes = Compiler::compileStringWithPhaseLogs(src, base + ".lex.log", base + ".syntax.log",
+                                                       base + ".semantic.log", base + ".codegen.log", format).size();
+        ms = msSince(t0);
+        std::uintmax_t logBytes = 0;
+        for (const char* ext : {".lex.log", ".syntax.log", ".semantic.log", ".codegen.log"}) {
+            std::error_code ec;
+            logBytes += std::filesystem::file_size(base + ext, ec);
+            std::filesystem::remove(base + ext, ec);
+        }
+        std::printf("%-14s %10.2f ms  %10.0f lines/s  (ir %zu bytes, logs %ju bytes)\n",
+                    format == logging::Format::Text ? "logs on (text)" : "logs on (bin)",
+                    ms, lines / (ms / 1e3), irBytes, logBytes);
+    }
+    return 0;
+}
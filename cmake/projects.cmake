@@ -9,6 +9,7 @@ include(cmake/projects/basic_compiler.cmake)
 include(cmake/projects/basic_compiler/tests/unit.cmake)
 include(cmake/projects/basic_compiler/tests/integration.cmake)
 include(cmake/projects/basic_compiler/tests/e2e.cmake)
+include(cmake/projects/basic_compiler/bench.cmake)
 
 # Provide an ordered ctest target (unit -> integration -> e2e)
 add_custom_target(ordered_ctest
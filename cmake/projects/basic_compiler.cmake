@@ -4,15 +4,32 @@
 
 # Auto-discover core sources (all but main.cpp)
 file(GLOB_RECURSE BASIC_COMPILER_CORE_SOURCES CONFIGURE_DEPENDS
+  ${PROJECT_SOURCE_DIR}/src/basic_compiler/ast/*.cpp
+  ${PROJECT_SOURCE_DIR}/src/basic_compiler/source/*.cpp
   ${PROJECT_SOURCE_DIR}/src/basic_compiler/lexer/*.cpp
   ${PROJECT_SOURCE_DIR}/src/basic_compiler/parser/*.cpp
+  ${PROJECT_SOURCE_DIR}/src/basic_compiler/cfg/*.cpp
   ${PROJECT_SOURCE_DIR}/src/basic_compiler/codegenerator/*.cpp
   ${PROJECT_SOURCE_DIR}/src/basic_compiler/optimizer/*.cpp
   ${PROJECT_SOURCE_DIR}/src/basic_compiler/compiler/*.cpp
+  ${PROJECT_SOURCE_DIR}/src/basic_compiler/log/*.cpp
 )
 
+# Lowest phase-log level compiled in; records below it are stripped (see log/Log.h)
+set(BASIC_COMPILER_LOG_LEVEL "TRACE" CACHE STRING "Lowest phase-log level compiled in")
+set(_basic_compiler_log_levels TRACE DEBUG INFO WARN ERROR OFF)
+set_property(CACHE BASIC_COMPILER_LOG_LEVEL PROPERTY STRINGS ${_basic_compiler_log_levels})
+list(FIND _basic_compiler_log_levels "${BASIC_COMPILER_LOG_LEVEL}" BASIC_COMPILER_LOG_LEVEL_INDEX)
+if (BASIC_COMPILER_LOG_LEVEL_INDEX LESS 0)
+  message(FATAL_ERROR "BASIC_COMPILER_LOG_LEVEL must be one of: ${_basic_compiler_log_levels}")
+endif()
+
 add_library(basic_compiler_lib STATIC ${BASIC_COMPILER_CORE_SOURCES})
 target_include_directories(basic_compiler_lib PUBLIC ${PROJECT_SOURCE_DIR}/include)
+target_compile_definitions(basic_compiler_lib PUBLIC GWBASIC_LOG_LEVEL=${BASIC_COMPILER_LOG_LEVEL_INDEX})
+# Phase logs are written by a background thread (log/AsyncWriter.h)
+find_package(Threads REQUIRED)
+target_link_libraries(basic_compiler_lib PUBLIC Threads::Threads)
 
 # Ensure hello_world builds first as a bootstrap sanity check
 add_dependencies(basic_compiler_lib hello_world)
@@ -20,6 +37,8 @@ add_dependencies(basic_compiler_lib hello_world)
 # Build the CLI as a project with IR/BC artifacts for all sources (auto-discovered plus main)
 build_project(basic_compiler ${BASIC_COMPILER_CORE_SOURCES} ${PROJECT_SOURCE_DIR}/src/basic_compiler/main.cpp)
 target_include_directories(basic_compiler PRIVATE ${PROJECT_SOURCE_DIR}/include)
+target_compile_definitions(basic_compiler PRIVATE GWBASIC_LOG_LEVEL=${BASIC_COMPILER_LOG_LEVEL_INDEX})
+target_link_libraries(basic_compiler PRIVATE Threads::Threads)
 
 # Enforce hello_world to build before the compiler and its IR/BC artifacts
 add_dependencies(basic_compiler hello_world)
@@ -31,3 +50,9 @@ if (CLANG_EXECUTABLE)
 else()
   target_compile_definitions(basic_compiler PRIVATE CLANG_PATH="clang")
 endif()
+
+# Offline renderer for binary phase logs (log/LogFormat.h)
+add_executable(basic_compiler-logdump ${PROJECT_SOURCE_DIR}/src/basic_compiler/tools/logdump.cpp)
+target_link_libraries(basic_compiler-logdump PRIVATE basic_compiler_lib)
+set_target_properties(basic_compiler-logdump PROPERTIES
+  RUNTIME_OUTPUT_DIRECTORY "${PROJECT_SOURCE_DIR}/build/basic_compiler")
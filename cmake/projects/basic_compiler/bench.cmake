@@ -0,0 +1,18 @@
+# File: cmake/projects/basic_compiler/bench.cmake
+# (c) 2025 Sam Caldwell. All Rights Reserved.
+# Purpose: Basic compiler microbenchmarks (one executable per source; not run by ctest).
+
+# Collect all benchmark sources under bench/basic_compiler
+file(GLOB BASIC_COMPILER_BENCH_SOURCES CONFIGURE_DEPENDS ${PROJECT_SOURCE_DIR}/bench/basic_compiler/*.cpp)
+
+set(BASIC_COMPILER_BENCH_TARGETS)
+foreach(bench_src ${BASIC_COMPILER_BENCH_SOURCES})
+  get_filename_component(bench_name ${bench_src} NAME_WE)
+  add_executable(basic_compiler_${bench_name} ${bench_src})
+  target_include_directories(basic_compiler_${bench_name} PRIVATE ${PROJECT_SOURCE_DIR}/include)
+  target_link_libraries(basic_compiler_${bench_name} PRIVATE basic_compiler_lib)
+  list(APPEND BASIC_COMPILER_BENCH_TARGETS basic_compiler_${bench_name})
+endforeach()
+
+# Build every benchmark with: cmake --build <dir> --target basic_compiler_benchmarks
+add_custom_target(basic_compiler_benchmarks DEPENDS ${BASIC_COMPILER_BENCH_TARGETS})
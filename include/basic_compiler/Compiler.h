@@ -2,9 +2,12 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "basic_compiler/Lexer.h"
 #include "basic_compiler/Parser.h"
+#include "basic_compiler/SourceBuffer.h"
 #include "basic_compiler/codegen/CodeGenerator.h"
+#include "basic_compiler/opt/PassManager.h"
 
 namespace gwbasic {
 
@@ -20,15 +23,14 @@ public:
      * compileString: Compile a GW-BASIC program string to LLVM IR.
      *
      * Inputs:
-     *  - source: Program text.
+     *  - source: Program text (viewed, not copied).
      *
      * Outputs:
      *  - std::string: LLVM IR text (.ll).
      */
-    static std::string compileString(const std::string& source) {
+    static std::string compileString(std::string_view source) {
         Lexer lex(source);
-        auto tokens = lex.tokenize();
-        Parser parser(std::move(tokens));
+        Parser parser(lex);
         auto program = parser.parseProgram();
         CodeGenerator gen;
         return gen.generate(program);
@@ -38,7 +40,7 @@ public:
      * compileFile: Compile a GW-BASIC source file to LLVM IR.
      *
      * Inputs:
-     *  - path: Filesystem path to a .bas file.
+     *  - path: Filesystem path to a .bas file (memory-mapped, see SourceBuffer).
      *
      * Outputs:
      *  - std::string: LLVM IR text (.ll).
@@ -53,7 +55,7 @@ public:
      * Outputs:
      *  - std::string: LLVM IR text (.ll)
      */
-    static std::string compileStringWithLog(const std::string& source, const std::string& logPath);
+    static std::string compileStringWithLog(std::string_view source, const std::string& logPath);
 
     /**
      * compileFileWithLog: Compile a source file and emit a codegen log.
@@ -65,21 +67,54 @@ public:
      */
     static std::string compileFileWithLog(const std::string& path, const std::string& logPath);
 
-    /** Compile with phase logs: lex + syntax + semantic (+ optional codegen). */
-    static std::string compileStringWithPhaseLogs(const std::string& source,
+    /**
+     * Compile with phase logs: lex + syntax + semantic (+ optional codegen).
+     * logFormat selects text lines or binary records (render binary logs
+     * with basic_compiler-logdump). options select the AST pass pipeline
+     * run before codegen (PassManager::forLevel); its statistics are stored
+     * in passStats when given.
+     */
+    static std::string compileStringWithPhaseLogs(std::string_view source,
                                                   const std::string& lexLogPath,
                                                   const std::string& syntaxLogPath,
                                                   const std::string& semanticLogPath,
-                                                  const std::string& codegenLogPath);
+                                                  const std::string& codegenLogPath,
+                                                  logging::Format logFormat = logging::Format::Text,
+                                                  const OptOptions& options = {},
+                                                  PassStats* passStats = nullptr);
 
     static std::string compileFileWithPhaseLogs(const std::string& path,
                                                 const std::string& lexLogPath,
                                                 const std::string& syntaxLogPath,
                                                 const std::string& semanticLogPath,
-                                                const std::string& codegenLogPath);
+                                                const std::string& codegenLogPath,
+                                                logging::Format logFormat = logging::Format::Text,
+                                                const OptOptions& options = {},
+                                                PassStats* passStats = nullptr);
+
+    /** Phase-logged compile streaming IR into out (file, pipe, stdout). */
+    static void compileStringWithPhaseLogs(std::string_view source,
+                                           const std::string& lexLogPath,
+                                           const std::string& syntaxLogPath,
+                                           const std::string& semanticLogPath,
+                                           const std::string& codegenLogPath,
+                                           IrSink& out,
+                                           logging::Format logFormat = logging::Format::Text,
+                                           const OptOptions& options = {},
+                                           PassStats* passStats = nullptr);
+
+    static void compileFileWithPhaseLogs(const std::string& path,
+                                         const std::string& lexLogPath,
+                                         const std::string& syntaxLogPath,
+                                         const std::string& semanticLogPath,
+                                         const std::string& codegenLogPath,
+                                         IrSink& out,
+                                         logging::Format logFormat = logging::Format::Text,
+                                         const OptOptions& options = {},
+                                         PassStats* passStats = nullptr);
 
-    /** Compile with AST optimization prior to codegen. */
-    static std::string compileStringOptimized(const std::string& source);
+    /** Compile with the AST pass pipeline of options prior to codegen. */
+    static std::string compileStringOptimized(std::string_view source, const OptOptions& options = OptLevel::O2);
 };
 
 } // namespace gwbasic
@@ -2,9 +2,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <stdexcept>
-#include <fstream>
+#include "basic_compiler/log/Log.h"
 #include "basic_compiler/token/Token.h"
 
 namespace gwbasic {
@@ -38,10 +39,11 @@ public:
      * Construct a lexer.
      *
      * Inputs:
-     *  - source: Entire GW-BASIC program as a string.
+     *  - source: Entire GW-BASIC program (e.g., SourceBuffer::text()). Not
+     *    copied: token lexemes view this text, so it must outlive them.
      */
-    explicit Lexer(std::string source)
-        : src_(std::move(source)) {}
+    explicit Lexer(std::string_view source)
+        : src_(source) {}
 
     /**
      * Tokenize: Produce the complete list of tokens for the source.
@@ -57,11 +59,27 @@ public:
      */
     std::vector<Token> tokenize();
 
+    /**
+     * next: Scan and return a single token.
+     *
+     * Inputs:
+     *  - none (continues where the previous call stopped).
+     *
+     * Outputs:
+     *  - Token: Next token; EndOfFile repeatedly once input is exhausted.
+     *
+     * Purpose:
+     *  - Pull interface for TokenStream so the parser can consume tokens
+     *    as they are scanned without materializing the full list.
+     */
+    Token next();
+
     /**
      * setLexLogPath: Enable lexical logging to a file.
      *
      * Inputs:
      *  - path: Filesystem path to write token stream diagnostics.
+     *  - format: Text lines (default) or binary records (see log/LogFormat.h).
      *
      * Outputs:
      *  - void (opens/initializes internal log file state)
@@ -70,14 +88,15 @@ public:
      *  - When enabled, each produced token is logged as: 
      *    "token <TYPE> @ <line>:<col> \"<lexeme>\"".
      */
-    void setLexLogPath(const std::string& path);
+    void setLexLogPath(const std::string& path, logging::Format format = logging::Format::Text);
 
 private:
-    std::string src_{};
+    std::string_view src_{};
     size_t pos_{0};
     int line_{1};
-    int col_{1};
+    size_t lineStart_{0}; // offset of the current line's first byte
     bool bol_{true}; // beginning of line (before optional line number)
+    bool eofEmitted_{false}; // EndOfFile already logged
 
     bool atEnd() const { return pos_ >= src_.size(); }
 
@@ -85,6 +104,15 @@ private:
 
     char peekNext() const { return (pos_ + 1 < src_.size()) ? src_[pos_ + 1] : '\0'; }
 
+    /** col: 1-based column of pos_, derived from the line start on demand. */
+    int col() const { return static_cast<int>(pos_ - lineStart_) + 1; }
+
+    /** Raw cursor/limit for the run scanners in lexer/Scan.h. */
+    const char* cursor() const { return src_.data() + pos_; }
+    const char* limit() const { return src_.data() + src_.size(); }
+    /** skipTo: Move to p, which must not be past a newline. */
+    void skipTo(const char* p) { pos_ = static_cast<size_t>(p - src_.data()); }
+
     /** advance: Consume and return the current character. */
     char advance();
 
@@ -97,21 +125,36 @@ private:
     /** identifierOrKeyword: Scan identifier or recognized keyword. */
     Token identifierOrKeyword();
 
-    /** stringLiteral: Scan a double-quoted string with simple escapes. */
+    /** stringLiteral: Scan a double-quoted string; lexeme is the raw body. */
     Token stringLiteral();
 
     /** skipToEOL: Skip remaining characters until end-of-line. */
     void skipToEOL();
 
-    // Lexical logging
-    bool lexLogEnabled_{false};
-    std::ofstream lexLog_;
+    // Lexical logging (Trace: one record per token)
+    logging::Channel lexLog_;
 
-    /** Log a token to the lex log if enabled. */
+    /** Log a token to the lex log; callers check GWBASIC_LOG_ENABLED first. */
     void logToken(const Token& t);
 
     /** Escape text for readable logging. */
-    static std::string escapeForLog(const std::string& s);
+    static std::string escapeForLog(std::string_view s);
 };
 
+/**
+ * unescapeStringLiteral: Decode the body of a String token.
+ *
+ * Inputs:
+ *  - raw: Token lexeme (text between the quotes, escapes intact).
+ *
+ * Outputs:
+ *  - std::string: Literal value with \n, \t, \", \\ (and \<other> -> other)
+ *    decoded.
+ *
+ * Purpose:
+ *  - Called only for literals that actually contain a backslash; all other
+ *    lexemes are used as views without decoding.
+ */
+std::string unescapeStringLiteral(std::string_view raw);
+
 } // namespace gwbasic
@@ -4,9 +4,10 @@
 #include <stdexcept>
 #include <string>
 #include <vector>
-#include <memory>
-#include <fstream>
+#include "basic_compiler/log/Log.h"
 #include "basic_compiler/token/Token.h"
+#include "basic_compiler/token/TokenStream.h"
+#include "basic_compiler/ast/NumType.h"
 #include "basic_compiler/ast/Program.h"
 
 namespace gwbasic {
@@ -39,6 +40,16 @@ public:
     explicit Parser(std::vector<Token> tokens)
         : tokens_(std::move(tokens)) {}
 
+    /**
+     * Construct a streaming parser.
+     *
+     * Inputs:
+     *  - lexer: Source of tokens, pulled one at a time as parsing proceeds.
+     *    Must outlive the parser; lexer errors surface from parseProgram().
+     */
+    explicit Parser(Lexer& lexer)
+        : tokens_(lexer) {}
+
     /**
      * parseProgram: Parse all input tokens into a Program AST.
      *
@@ -51,15 +62,25 @@ public:
     Program parseProgram();
 
 private:
-    std::vector<Token> tokens_{};
-    size_t pos_{0};
-    // Syntax logging
-    bool syntaxLogEnabled_{false};
-    std::ofstream syntaxLog_;
+    // Two-token lookahead window over a vector or a live Lexer
+    TokenStream tokens_;
+    // Arena of the Program being built (set by parseProgram)
+    AstArena* arena_{nullptr};
+    // Shared scratch stack for statement lists; nested lists (FOR bodies
+    // inside a line) push above their parent's entries and pop when copied
+    // into the arena, so one buffer serves the whole parse.
+    std::vector<AstRef<Stmt>> stmtScratch_{};
+    // Type of suffix-less variables by first letter (DEFINT/DEFSNG/DEFDBL)
+    NumType defTypes_[26]{};
+    // Scratch buffer for canonical variable names (internVar)
+    std::string varName_{};
+    // Syntax logging (Debug: one record per statement)
+    logging::Channel syntaxLog_;
 
-    const Token& peek() const { return tokens_[pos_]; }
-    const Token& peekNext() const { return tokens_[pos_ + 1]; }
-    const Token& advance() { return tokens_[pos_++]; }
+    // peek() refers into the window: copy fields out before advance()
+    const Token& peek() const { return tokens_.peek(); }
+    const Token& peekNext() const { return tokens_.peekNext(); }
+    void advance() { tokens_.advance(); }
     bool atEnd() const { return peek().type == TokenType::EndOfFile; }
     bool check(const TokenType t) const { return peek().type == t; }
     bool match(const TokenType t) { if (check(t)) { advance(); return true; } return false; }
@@ -70,44 +91,43 @@ private:
     /** parseLine: Parse a numbered line and its statements. */
     Line parseLine();
     /** parseStatement: Parse a single statement. */
-    std::unique_ptr<Stmt> parseStatement();
+    AstRef<Stmt> parseStatement();
     /** parsePrint: Parse PRINT. */
-    std::unique_ptr<Stmt> parsePrint();
+    AstRef<Stmt> parsePrint();
     /** parseAssignOrLet: Parse assignment with or without LET. */
-    std::unique_ptr<Stmt> parseAssignOrLet();
+    AstRef<Stmt> parseAssignOrLet();
     /** parseIf: Parse IF ... THEN <line>. */
-    std::unique_ptr<Stmt> parseIf();
+    AstRef<Stmt> parseIf();
+    /** parseDefType: Parse DEFINT/DEFSNG/DEFDBL if present; false otherwise. */
+    bool parseDefType();
     /** parseFor: Parse single-line FOR ... NEXT. */
-    std::unique_ptr<Stmt> parseFor();
+    AstRef<Stmt> parseFor();
     /** Expression grammar helpers. */
-    std::unique_ptr<Expr> parseExpression();
-    std::unique_ptr<Expr> parseComparison();
-    std::unique_ptr<Expr> parseTerm();
-    std::unique_ptr<Expr> parseFactor();
-    std::unique_ptr<Expr> parseUnary();
-    std::unique_ptr<Expr> parsePrimary();
+    AstRef<Expr> parseExpression();
+    AstRef<Expr> parseComparison();
+    AstRef<Expr> parseTerm();
+    AstRef<Expr> parseFactor();
+    AstRef<Expr> parseUnary();
+    AstRef<Expr> parsePrimary();
+
+    /** takeStmtList: Copy scratch entries [mark, end) into the arena and pop them. */
+    AstList<Stmt> takeStmtList(size_t mark);
+
+    /** Token value helpers: lexemes are views, so convert without temporaries. */
+    static int lineNumberOf(const Token& t);
+    static double numberOf(const Token& t);
+    /** stringValueOf: Decode a String token and intern it in the arena. */
+    Symbol stringValueOf(const Token& t);
+    /** internVar: Intern a variable under its canonical typed name (see typeOfName). */
+    Symbol internVar(std::string_view lexeme);
 
 public:
     /** Enable syntax analysis logging to the specified file path. */
-    void setSyntaxLogPath(const std::string& path) {
-        if (syntaxLog_.is_open()) syntaxLog_.close();
-        syntaxLog_.open(path, std::ios::out | std::ios::trunc);
-        syntaxLogEnabled_ = syntaxLog_.is_open();
+    void setSyntaxLogPath(const std::string& path, logging::Format format = logging::Format::Text) {
+        syntaxLog_.open(path, logging::Level::Trace, format);
     }
 private:
-    void logSyntax(const std::string& msg) { if (syntaxLogEnabled_ && syntaxLog_.is_open()) syntaxLog_ << msg << '\n'; }
-    static const char* nodeName(const Stmt* s) {
-        if (dynamic_cast<const AssignStmt*>(s)) return "AssignStmt";
-        if (dynamic_cast<const PrintStmt*>(s)) return "PrintStmt";
-        if (dynamic_cast<const GotoStmt*>(s)) return "GotoStmt";
-        if (dynamic_cast<const GosubStmt*>(s)) return "GosubStmt";
-        if (dynamic_cast<const ReturnStmt*>(s)) return "ReturnStmt";
-        if (dynamic_cast<const IfStmt*>(s)) return "IfStmt";
-        if (dynamic_cast<const InputStmt*>(s)) return "InputStmt";
-        if (dynamic_cast<const ForStmt*>(s)) return "ForStmt";
-        if (dynamic_cast<const EndStmt*>(s)) return "EndStmt";
-        return "Stmt";
-    }
+    static const char* nodeName(const Stmt* s) { return kindName(s->kind); }
 };
 
 } // namespace gwbasic
@@ -0,0 +1,63 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace gwbasic {
+
+/**
+ * SourceBuffer: Read-only program text backing a compilation.
+ *
+ * Purpose:
+ *  - Give the lexer one contiguous view of the input without copying it:
+ *    files are memory-mapped, in-memory sources are held by value.
+ *
+ * Inputs:
+ *  - mapFile(path): Map a source file read-only (falls back to reading it
+ *    when the file cannot be mapped, e.g. pipes or empty files).
+ *  - fromString(text): Adopt an in-memory program.
+ *
+ * Outputs:
+ *  - text(): View of the whole program, valid for the buffer's lifetime.
+ *
+ * Theory of operation:
+ *  - Tokens hold std::string_view lexemes into text(), so the buffer must
+ *    outlive the token stream. The parser copies the few lexemes the AST
+ *    keeps (names, string literals) into the Program arena, after which the
+ *    buffer may be released.
+ */
+class SourceBuffer {
+public:
+    /** Map a file read-only; throws std::runtime_error if it cannot be opened. */
+    static SourceBuffer mapFile(const std::string& path);
+
+    /** Take ownership of an in-memory source string. */
+    static SourceBuffer fromString(std::string text);
+
+    SourceBuffer(SourceBuffer&& other) noexcept;
+    SourceBuffer& operator=(SourceBuffer&& other) noexcept;
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+    ~SourceBuffer();
+
+    /** Whole program text. */
+    std::string_view text() const {
+        if (mapped_) return {static_cast<const char*>(mapped_), mappedLen_};
+        return owned_;
+    }
+
+    /** True when text() points into a file mapping (diagnostics/tests). */
+    bool isMapped() const { return mapped_ != nullptr; }
+
+private:
+    SourceBuffer() = default;
+    void release() noexcept;
+
+    void* mapped_{nullptr};
+    std::size_t mappedLen_{0};
+    std::string owned_{};
+};
+
+} // namespace gwbasic
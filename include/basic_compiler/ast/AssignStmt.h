@@ -1,10 +1,11 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
-#include <string>
+#include <string_view>
 #include "basic_compiler/ast/Stmt.h"
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/AstRef.h"
+#include "basic_compiler/ast/SymbolTable.h"
 
 namespace gwbasic {
 
@@ -13,18 +14,23 @@ namespace gwbasic {
  * Purpose:
  *  - LET or implicit assignment of an expression to a variable.
  * Inputs:
- *  - name: Variable identifier
+ *  - name: Variable identifier (arena-owned text)
+ *  - sym: Interned id of name (kNoSymbol when built without the interner)
  *  - value: Expression to evaluate and store
  * Outputs:
  *  - Concrete Stmt node; codegen ensures allocation and store to the symbol
  * Theory of operation:
- *  - Codegen emits store to an alloca location tracked per variable name.
+ *  - Codegen emits store to an alloca location tracked per variable symbol.
  */
 struct AssignStmt : Stmt {
-    std::string name;
-    std::unique_ptr<Expr> value;
-    AssignStmt(std::string n, std::unique_ptr<Expr> v)
-        : name(std::move(n)), value(std::move(v)) {}
+    static constexpr StmtKind kKind = StmtKind::Assign;
+    std::string_view name;
+    SymbolId sym{kNoSymbol};
+    AstRef<Expr> value;
+    AssignStmt(std::string_view n, AstRef<Expr> v)
+        : Stmt(kKind), name(n), value(v) {}
+    AssignStmt(Symbol s, AstRef<Expr> v)
+        : Stmt(kKind), name(s.text), sym(s.id), value(v) {}
 };
 
 } // namespace gwbasic
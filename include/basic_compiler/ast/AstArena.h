@@ -0,0 +1,139 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "basic_compiler/ast/AstList.h"
+#include "basic_compiler/ast/AstPool.h"
+#include "basic_compiler/ast/AstRef.h"
+#include "basic_compiler/ast/SymbolTable.h"
+#include "basic_compiler/ast/AssignStmt.h"
+#include "basic_compiler/ast/PrintStmt.h"
+#include "basic_compiler/ast/GotoStmt.h"
+#include "basic_compiler/ast/GosubStmt.h"
+#include "basic_compiler/ast/ReturnStmt.h"
+#include "basic_compiler/ast/IfStmt.h"
+#include "basic_compiler/ast/InputStmt.h"
+#include "basic_compiler/ast/ForStmt.h"
+#include "basic_compiler/ast/EndStmt.h"
+#include "basic_compiler/ast/UnaryExpr.h"
+#include "basic_compiler/ast/BinaryExpr.h"
+#include "basic_compiler/ast/NumberExpr.h"
+#include "basic_compiler/ast/StringExpr.h"
+#include "basic_compiler/ast/VarExpr.h"
+
+namespace gwbasic {
+
+struct AnalysisCache;
+
+/**
+ * Type: AstArena
+ * Purpose:
+ *  - Owns every AST node, string and statement list of one compilation.
+ * Inputs:
+ *  - make<T>(args...): Build a node in the per-kind pool for T
+ *  - copyString(s): Copy identifier/literal text into arena storage
+ *  - makeList(items): Copy a finished statement list into arena storage
+ *  - intern(s): Copy text once per distinct spelling and number it
+ * Outputs:
+ *  - Stable pointers/views valid until the arena is destroyed
+ * Theory of operation:
+ *  - Known node kinds go to their own AstPool so nodes of one kind sit next
+ *    to each other and carry a dense 32-bit pool index. Variable-length data
+ *    (strings, lists) and node types outside the pool set (e.g., test-only
+ *    subclasses) are bump-allocated from large blocks. Nothing is destroyed
+ *    individually: teardown frees a handful of chunks and blocks.
+ */
+class AstArena {
+public:
+    AstArena() = default;
+    AstArena(const AstArena&) = delete;
+    AstArena& operator=(const AstArena&) = delete;
+
+    /** Construct a node of type T in arena storage (never destroyed, see AstPool). */
+    template <class T, class... Args>
+    T* make(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "AST nodes are never destroyed: members must be arena handles, views or scalars");
+        if constexpr (kPooled<T>) {
+            return std::get<AstPool<T>>(pools_).make(std::forward<Args>(args)...);
+        } else {
+            return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+    }
+
+    /** Access the pool holding every node of kind T (dense 32-bit indices). */
+    template <class T>
+    AstPool<T>& pool() { return std::get<AstPool<T>>(pools_); }
+
+    /** Copy text into the arena; the view stays valid for the arena's lifetime. */
+    std::string_view copyString(std::string_view s);
+
+    /** Intern identifier/literal text: first use copies it and assigns the next SymbolId. */
+    Symbol intern(std::string_view s);
+
+    /** The program's symbol table (ids handed out by intern()). */
+    SymbolTable& symbols() { return symbols_; }
+    const SymbolTable& symbols() const { return symbols_; }
+
+    /** Copy a finished list of handles into the arena. */
+    template <class T>
+    AstList<T> makeList(std::span<const AstRef<T>> items) {
+        if (items.size() > std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error("AST list too long");
+        if (items.empty()) return {};
+        auto* data = static_cast<AstRef<T>*>(allocate(items.size() * sizeof(AstRef<T>), alignof(AstRef<T>)));
+        std::uninitialized_copy(items.begin(), items.end(), data);
+        return AstList<T>(data, static_cast<std::uint32_t>(items.size()));
+    }
+
+    /** Total bytes reserved by pools and bump blocks (diagnostics/tests). */
+    std::size_t bytesReserved() const;
+
+    /**
+     * Optimizer analyses of the program these nodes form, kept between
+     * passes while its statements stay the same (AstOptimizer::analyze,
+     * opt/AnalysisCache.h); empty until a pass needs them.
+     */
+    std::shared_ptr<AnalysisCache>& analyses() { return analyses_; }
+
+private:
+    using Pools = std::tuple<
+        AstPool<AssignStmt>, AstPool<PrintStmt>, AstPool<GotoStmt>, AstPool<GosubStmt>,
+        AstPool<ReturnStmt>, AstPool<IfStmt>, AstPool<InputStmt>, AstPool<ForStmt>,
+        AstPool<EndStmt>, AstPool<UnaryExpr>, AstPool<BinaryExpr>, AstPool<NumberExpr>,
+        AstPool<StringExpr>, AstPool<VarExpr>>;
+
+    template <class T, class Tuple> struct HasPool;
+    template <class T, class... Ps>
+    struct HasPool<T, std::tuple<Ps...>> : std::bool_constant<(std::is_same_v<AstPool<T>, Ps> || ...)> {};
+    template <class T>
+    static constexpr bool kPooled = HasPool<T, Pools>::value;
+
+    static constexpr std::size_t kBlockBytes = 64 * 1024;
+
+    /** Bump-allocate raw storage; oversized requests get a dedicated block. */
+    void* allocate(std::size_t bytes, std::size_t align);
+
+    Pools pools_{};
+    SymbolTable symbols_{};
+    std::vector<std::unique_ptr<std::byte[]>> blocks_{};
+    std::byte* cur_{nullptr};
+    std::size_t left_{0};
+    std::size_t blockBytesTotal_{0};
+    std::shared_ptr<AnalysisCache> analyses_{};
+};
+
+} // namespace gwbasic
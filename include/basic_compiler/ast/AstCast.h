@@ -0,0 +1,38 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <type_traits>
+
+#include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/Stmt.h"
+
+namespace gwbasic {
+
+/**
+ * Function: astCast<T>
+ * Purpose:
+ *  - Checked downcast from Stmt/Expr to a concrete node type using the kind
+ *    tag (replacement for dynamic_cast in passes).
+ * Inputs:
+ *  - n: Node pointer (may be null)
+ * Outputs:
+ *  - T* when n is non-null and n->kind == T::kKind; nullptr otherwise
+ * Theory of operation:
+ *  - Each concrete node declares a static kKind and passes it to its base
+ *    constructor, so the check is a single byte compare and the cast is a
+ *    static_cast. Passes that handle several kinds should switch on
+ *    n->kind directly and static_cast inside each case.
+ */
+template <class T, class B>
+    requires std::is_base_of_v<Stmt, T> || std::is_base_of_v<Expr, T>
+T* astCast(B* n) {
+    return (n && n->kind == T::kKind) ? static_cast<T*>(n) : nullptr;
+}
+
+template <class T, class B>
+    requires std::is_base_of_v<Stmt, T> || std::is_base_of_v<Expr, T>
+const T* astCast(const B* n) {
+    return (n && n->kind == T::kKind) ? static_cast<const T*>(n) : nullptr;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,49 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "basic_compiler/ast/AstRef.h"
+
+namespace gwbasic {
+
+/**
+ * Type: AstList<T>
+ * Purpose:
+ *  - Fixed-size, arena-backed sequence of node handles (statement lists in
+ *    Line and ForStmt bodies).
+ * Inputs:
+ *  - data/count: Contiguous AstRef<T> array allocated by AstArena::makeList
+ * Outputs:
+ *  - Read/write random access and range-for iteration over the handles
+ * Theory of operation:
+ *  - Replaces std::vector<std::unique_ptr<Stmt>>: the array is built once
+ *    (the parser and optimizer collect into a scratch buffer, then copy it
+ *    into the arena), so there is no per-list heap block and no destructor.
+ *    To change a list, build a new one with AstArena::makeList and assign.
+ */
+template <class T>
+class AstList {
+public:
+    AstList() = default;
+    AstList(AstRef<T>* data, std::uint32_t count) : data_(data), count_(count) {}
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    AstRef<T>& operator[](std::size_t i) { return data_[i]; }
+    const AstRef<T>& operator[](std::size_t i) const { return data_[i]; }
+    AstRef<T>& back() { return data_[count_ - 1]; }
+    const AstRef<T>& back() const { return data_[count_ - 1]; }
+
+    AstRef<T>* begin() { return data_; }
+    AstRef<T>* end() { return data_ + count_; }
+    const AstRef<T>* begin() const { return data_; }
+    const AstRef<T>* end() const { return data_ + count_; }
+
+private:
+    AstRef<T>* data_{nullptr};
+    std::uint32_t count_{0};
+};
+
+} // namespace gwbasic
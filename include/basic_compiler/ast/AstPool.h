@@ -0,0 +1,61 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace gwbasic {
+
+/**
+ * Type: AstPool<T>
+ * Purpose:
+ *  - Contiguous storage for every node of one kind (e.g., all BinaryExpr),
+ *    addressed by a dense 32-bit index.
+ * Inputs:
+ *  - make(args...): Constructor arguments for a new node
+ * Outputs:
+ *  - Stable T* per node; operator[](index) for linear walks/side tables
+ * Theory of operation:
+ *  - Slots are carved out of fixed-size chunks (kChunkNodes per chunk), so
+ *    index i lives at chunks_[i / kChunkNodes][i % kChunkNodes] and a node
+ *    never moves once built. Destructors are never run: node members are
+ *    trivially destructible (arena strings/lists, handles, scalars; checked
+ *    by AstArena::make), so the owning AstArena just frees the chunks.
+ */
+template <class T>
+class AstPool {
+public:
+    static constexpr std::uint32_t kChunkNodes = 1024;
+
+    template <class... Args>
+    T* make(Args&&... args) {
+        if (count_ == std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error("AST pool exhausted (2^32 nodes of one kind)");
+        if (count_ % kChunkNodes == 0)
+            chunks_.emplace_back(new Slot[kChunkNodes]);
+        void* slot = &chunks_.back()[count_ % kChunkNodes];
+        ++count_;
+        return ::new (slot) T(std::forward<Args>(args)...);
+    }
+
+    std::uint32_t size() const { return count_; }
+
+    T& operator[](std::uint32_t i) {
+        return *std::launder(reinterpret_cast<T*>(&chunks_[i / kChunkNodes][i % kChunkNodes]));
+    }
+
+    std::size_t bytesReserved() const { return chunks_.size() * kChunkNodes * sizeof(Slot); }
+
+private:
+    struct Slot { alignas(T) std::byte raw[sizeof(T)]; };
+    std::vector<std::unique_ptr<Slot[]>> chunks_;
+    std::uint32_t count_{0};
+};
+
+} // namespace gwbasic
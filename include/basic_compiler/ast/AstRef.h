@@ -0,0 +1,46 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace gwbasic {
+
+/**
+ * Type: AstRef<T>
+ * Purpose:
+ *  - Non-owning handle to an AST node that lives in an AstArena pool.
+ * Inputs:
+ *  - p: Node pointer returned by AstArena::make<T>() (or nullptr)
+ * Outputs:
+ *  - Pointer-sized value with get()/operator-> accessors mirroring the
+ *    former std::unique_ptr links so traversal code reads the same.
+ * Theory of operation:
+ *  - Nodes are owned by the arena and released in one step when the Program
+ *    goes away, so a link never deletes what it points at. Copying a handle
+ *    is free; upcasts (AstRef<BinaryExpr> -> AstRef<Expr>) are implicit.
+ */
+template <class T>
+class AstRef {
+public:
+    AstRef() = default;
+    AstRef(std::nullptr_t) {}
+    AstRef(T* p) : p_(p) {}
+
+    template <class U>
+        requires std::is_convertible_v<U*, T*>
+    AstRef(AstRef<U> other) : p_(other.get()) {}
+
+    T* get() const { return p_; }
+    T* operator->() const { return p_; }
+    T& operator*() const { return *p_; }
+    explicit operator bool() const { return p_ != nullptr; }
+    void reset() { p_ = nullptr; }
+
+    friend bool operator==(AstRef a, AstRef b) { return a.p_ == b.p_; }
+
+private:
+    T* p_{nullptr};
+};
+
+} // namespace gwbasic
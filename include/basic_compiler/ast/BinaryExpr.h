@@ -1,8 +1,8 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/AstRef.h"
 #include "basic_compiler/ast/BinaryOp.h"
 
 namespace gwbasic {
@@ -13,7 +13,7 @@ namespace gwbasic {
  *  - Represent a binary operation with two operand expressions.
  * Inputs:
  *  - op: Operator kind (arithmetic or comparison)
- *  - lhs, rhs: Owned operand expressions
+ *  - lhs, rhs: Operand expressions (arena-owned)
  * Outputs:
  *  - Concrete Expr node; comparisons produce boolean-like numeric values
  * Theory of operation:
@@ -21,11 +21,29 @@ namespace gwbasic {
  *    fcmp with subsequent uitofp to produce 0.0/1.0 semantics.
  */
 struct BinaryExpr : Expr {
+    static constexpr ExprKind kKind = ExprKind::Binary;
     BinaryOp op;
-    std::unique_ptr<Expr> lhs;
-    std::unique_ptr<Expr> rhs;
-    BinaryExpr(BinaryOp o, std::unique_ptr<Expr> a, std::unique_ptr<Expr> b)
-        : op(o), lhs(std::move(a)), rhs(std::move(b)) {}
+    AstRef<Expr> lhs;
+    AstRef<Expr> rhs;
+    BinaryExpr(BinaryOp o, AstRef<Expr> a, AstRef<Expr> b)
+        : Expr(kKind), op(o), lhs(a), rhs(b) { retype(); }
+
+    /**
+     * retype: GW-BASIC mixed-mode rules. Arithmetic happens in the wider
+     * operand type ('/' in at least Single); a comparison yields a flexible
+     * Int (0 or 1). The result is flexible only when both operands are.
+     */
+    void retype() {
+        if (!lhs || !rhs) return;
+        if (op >= BinaryOp::Eq) {
+            type = NumType::Int;
+            flexible = true;
+            return;
+        }
+        type = wider(lhs->type, rhs->type);
+        if (op == BinaryOp::Div) type = wider(type, NumType::Single);
+        flexible = lhs->flexible && rhs->flexible;
+    }
 };
 
 } // namespace gwbasic
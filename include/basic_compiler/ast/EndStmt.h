@@ -15,6 +15,9 @@ namespace gwbasic {
  * Theory of operation:
  *  - Subsequent lines are not executed.
  */
-struct EndStmt : Stmt {};
+struct EndStmt : Stmt {
+    static constexpr StmtKind kKind = StmtKind::End;
+    EndStmt() : Stmt(kKind) {}
+};
 
 } // namespace gwbasic
@@ -1,6 +1,8 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
+#include "basic_compiler/ast/NodeKind.h"
+#include "basic_compiler/ast/NumType.h"
 #include "basic_compiler/ast/SourcePos.h"
 
 namespace gwbasic {
@@ -11,16 +13,29 @@ namespace gwbasic {
  *  - Common base for all expression nodes (numeric, string, variable,
  *    unary/binary operations, etc.).
  * Inputs:
+ *  - kind: ExprKind tag set by the concrete subclass constructor
  *  - pos: Source position captured by the parser for diagnostics/logging
  * Outputs:
- *  - Virtual base enabling polymorphic handling of expressions
+ *  - Base enabling kind-tagged handling of expressions
  * Theory of operation:
- *  - Concrete subclasses implement specific expression forms. Ownership is
- *    typically via std::unique_ptr<Expr> in parent nodes.
+ *  - Concrete subclasses implement specific expression forms. Nodes live in
+ *    the Program's AstArena and are linked via AstRef<Expr>; the arena frees
+ *    them wholesale, so subclasses must only hold trivially destructible
+ *    members (handles, AstList, string_view, scalars); AstArena::make
+ *    static_asserts it, so there is no virtual destructor.
+ *  - Passes dispatch on kind (switch or astCast<T>) rather than RTTI.
+ *  - type/flexible are inferred bottom-up by each node's constructor (and
+ *    refreshed with retype() after a pass replaces operands). A flexible
+ *    type (literals, comparison results) is only a lower bound: the value
+ *    adopts the type of whatever it is combined with or assigned to.
  */
 struct Expr {
-    virtual ~Expr() = default;
+    Expr() = default;
+    explicit Expr(ExprKind k) : kind(k) {}
+    const ExprKind kind{ExprKind::Unknown};
     SourcePos pos{};
+    NumType type{NumType::Double};
+    bool flexible{false};
 };
 
 } // namespace gwbasic
@@ -1,11 +1,13 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
-#include <string>
-#include <vector>
+#include <cstdint>
+#include <string_view>
 #include "basic_compiler/ast/Stmt.h"
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/AstList.h"
+#include "basic_compiler/ast/AstRef.h"
+#include "basic_compiler/ast/SymbolTable.h"
 
 namespace gwbasic {
 
@@ -16,23 +18,31 @@ namespace gwbasic {
  *    at the matching NEXT.
  * Inputs:
  *  - var: Induction variable name
+ *  - varSym: Interned id of var (kNoSymbol when built without the interner)
  *  - start: Initial value expression
  *  - end: Terminal bound (inclusive)
  *  - step: Optional step (defaults to 1.0 when null)
- *  - body: Owned statements executed each iteration
+ *  - body: Statements executed each iteration (arena list)
+ *  - unrolled: Copies of the source body per iteration, >1 once
+ *    AstOptimizer::unrollLoops has unrolled the loop
  * Outputs:
  *  - Concrete Stmt node; codegen emits PHI-like loop with compare/inc
  * Theory of operation:
  *  - Generator lowers to labeled blocks with loop cond/body/inc structure.
  */
 struct ForStmt : Stmt {
-    std::string var;
-    std::unique_ptr<Expr> start;
-    std::unique_ptr<Expr> end;
-    std::unique_ptr<Expr> step; // may be null -> default 1
-    std::vector<std::unique_ptr<Stmt>> body; // inline for body until NEXT (same line)
-    ForStmt(std::string v, std::unique_ptr<Expr> s, std::unique_ptr<Expr> e, std::unique_ptr<Expr> st)
-        : var(std::move(v)), start(std::move(s)), end(std::move(e)), step(std::move(st)) {}
+    static constexpr StmtKind kKind = StmtKind::For;
+    std::string_view var;
+    SymbolId varSym{kNoSymbol};
+    AstRef<Expr> start;
+    AstRef<Expr> end;
+    AstRef<Expr> step; // may be null -> default 1
+    AstList<Stmt> body; // inline for body until NEXT (same line)
+    std::uint8_t unrolled{1};
+    ForStmt(std::string_view v, AstRef<Expr> s, AstRef<Expr> e, AstRef<Expr> st)
+        : Stmt(kKind), var(v), start(s), end(e), step(st) {}
+    ForStmt(Symbol v, AstRef<Expr> s, AstRef<Expr> e, AstRef<Expr> st)
+        : Stmt(kKind), var(v.text), varSym(v.id), start(s), end(e), step(st) {}
 };
 
 } // namespace gwbasic
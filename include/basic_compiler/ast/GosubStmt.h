@@ -12,13 +12,15 @@ namespace gwbasic {
  * Inputs:
  *  - targetLine: Destination subroutine line number
  * Outputs:
- *  - Concrete Stmt node; codegen emits inline expansion with return label
+ *  - Concrete Stmt node; codegen pushes a return-site id and branches to
+ *    the target line (tiny leaf subroutines are expanded inline instead)
  * Theory of operation:
- *  - Current lowering may inline GOSUB bodies and synthesize a return path.
+ *  - See CodeGenerator::emitGosub.
  */
 struct GosubStmt : Stmt {
+    static constexpr StmtKind kKind = StmtKind::Gosub;
     int targetLine;
-    explicit GosubStmt(int ln) : targetLine(ln) {}
+    explicit GosubStmt(int ln) : Stmt(kKind), targetLine(ln) {}
 };
 
 } // namespace gwbasic
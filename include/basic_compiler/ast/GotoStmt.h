@@ -17,8 +17,9 @@ namespace gwbasic {
  *  - Line numbers are mapped to basic blocks with labels “line_<N>”.
  */
 struct GotoStmt : Stmt {
+    static constexpr StmtKind kKind = StmtKind::Goto;
     int targetLine;
-    explicit GotoStmt(int ln) : targetLine(ln) {}
+    explicit GotoStmt(int ln) : Stmt(kKind), targetLine(ln) {}
 };
 
 } // namespace gwbasic
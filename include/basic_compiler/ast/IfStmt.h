@@ -1,9 +1,9 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
 #include "basic_compiler/ast/Stmt.h"
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/AstRef.h"
 
 namespace gwbasic {
 
@@ -20,9 +20,10 @@ namespace gwbasic {
  *  - Comparisons produce 0.0/1.0; codegen compares against 0.0 and branches.
  */
 struct IfStmt : Stmt {
-    std::unique_ptr<Expr> cond;
+    static constexpr StmtKind kKind = StmtKind::If;
+    AstRef<Expr> cond;
     int targetLine;
-    IfStmt(std::unique_ptr<Expr> c, int ln) : cond(std::move(c)), targetLine(ln) {}
+    IfStmt(AstRef<Expr> c, int ln) : Stmt(kKind), cond(c), targetLine(ln) {}
 };
 
 } // namespace gwbasic
@@ -1,8 +1,9 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <string>
+#include <string_view>
 #include "basic_compiler/ast/Stmt.h"
+#include "basic_compiler/ast/SymbolTable.h"
 
 namespace gwbasic {
 
@@ -12,14 +13,21 @@ namespace gwbasic {
  *  - Read a numeric value from stdin and assign to a variable.
  * Inputs:
  *  - name: Variable identifier to store into
+ *  - sym: Interned id of name (kNoSymbol when built without the interner)
+ *  - defTyped: DEFINT/DEFSNG gave the name's letter this Int or Single
+ *    type, so the bare base name ("N" for N%) denotes this variable here
  * Outputs:
  *  - Concrete Stmt node; codegen emits scanf-like logic (or stub)
  * Theory of operation:
  *  - Current implementation may be simplified; semantics logged for tracing.
  */
 struct InputStmt : Stmt {
-    std::string name;
-    explicit InputStmt(std::string n) : name(std::move(n)) {}
+    static constexpr StmtKind kKind = StmtKind::Input;
+    std::string_view name;
+    SymbolId sym{kNoSymbol};
+    bool defTyped{false};
+    explicit InputStmt(std::string_view n) : Stmt(kKind), name(n) {}
+    explicit InputStmt(Symbol s) : Stmt(kKind), name(s.text), sym(s.id) {}
 };
 
 } // namespace gwbasic
@@ -1,9 +1,8 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
-#include <vector>
 #include "basic_compiler/ast/Stmt.h"
+#include "basic_compiler/ast/AstList.h"
 
 namespace gwbasic {
 
@@ -13,7 +12,7 @@ namespace gwbasic {
  *  - Represent a numbered GW-BASIC line containing zero or more statements.
  * Inputs:
  *  - number: Line number (1..N, increasing)
- *  - statements: Owned list of statements in execution order
+ *  - statements: Statements in execution order (arena list)
  * Outputs:
  *  - Structural node used to organize Program content
  * Theory of operation:
@@ -21,7 +20,7 @@ namespace gwbasic {
  */
 struct Line {
     int number{0};
-    std::vector<std::unique_ptr<Stmt>> statements;
+    AstList<Stmt> statements;
 };
 
 } // namespace gwbasic
@@ -0,0 +1,65 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+
+namespace gwbasic {
+
+/**
+ * Enum: StmtKind
+ * Purpose:
+ *  - Discriminator stored in every Stmt so passes classify a statement with
+ *    one load and a switch instead of a chain of dynamic_casts.
+ * Members:
+ *  - Unknown: base/unrecognised statement (e.g., test-only subclasses)
+ *  - Assign, Print, Goto, Gosub, Return, If, Input, For, End: one per node
+ */
+enum class StmtKind : std::uint8_t {
+    Unknown,
+    Assign, Print, Goto, Gosub, Return, If, Input, For, End
+};
+
+/**
+ * Enum: ExprKind
+ * Purpose:
+ *  - Discriminator stored in every Expr (see StmtKind).
+ * Members:
+ *  - Unknown: base/unrecognised expression
+ *  - Number, String, Var, Unary, Binary: one per node
+ */
+enum class ExprKind : std::uint8_t {
+    Unknown,
+    Number, String, Var, Unary, Binary
+};
+
+/** Node class name for a statement kind (logging). */
+constexpr const char* kindName(StmtKind k) {
+    switch (k) {
+        case StmtKind::Assign: return "AssignStmt";
+        case StmtKind::Print: return "PrintStmt";
+        case StmtKind::Goto: return "GotoStmt";
+        case StmtKind::Gosub: return "GosubStmt";
+        case StmtKind::Return: return "ReturnStmt";
+        case StmtKind::If: return "IfStmt";
+        case StmtKind::Input: return "InputStmt";
+        case StmtKind::For: return "ForStmt";
+        case StmtKind::End: return "EndStmt";
+        case StmtKind::Unknown: break;
+    }
+    return "Stmt";
+}
+
+/** Node class name for an expression kind (logging). */
+constexpr const char* kindName(ExprKind k) {
+    switch (k) {
+        case ExprKind::Number: return "NumberExpr";
+        case ExprKind::String: return "StringExpr";
+        case ExprKind::Var: return "VarExpr";
+        case ExprKind::Unary: return "UnaryExpr";
+        case ExprKind::Binary: return "BinaryExpr";
+        case ExprKind::Unknown: break;
+    }
+    return "Expr";
+}
+
+} // namespace gwbasic
@@ -0,0 +1,49 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace gwbasic {
+
+/**
+ * Enum: NumType
+ * Purpose:
+ *  - GW-BASIC numeric type of a variable or expression, ordered narrowest
+ *    first so mixed-mode arithmetic converts to the larger of the two.
+ * Members:
+ *  - Int: '%' suffix / DEFINT; 16-bit integer variables, i32 arithmetic
+ *  - Single: '!' suffix / DEFSNG; IEEE float
+ *  - Double: '#' suffix / DEFDBL; IEEE double (names without a suffix or a
+ *    DEF declaration default to Double, as every variable was before types)
+ */
+enum class NumType : std::uint8_t { Int, Single, Double };
+
+/** wider: Type both operands of a mixed operation are converted to. */
+constexpr NumType wider(NumType a, NumType b) { return a > b ? a : b; }
+
+/** isTypeSuffix: Whether c is one of the identifier type suffixes % ! #. */
+constexpr bool isTypeSuffix(char c) { return c == '%' || c == '!' || c == '#'; }
+
+/** typeOfSuffix: Type selected by a suffix character (see isTypeSuffix). */
+constexpr NumType typeOfSuffix(char c) {
+    return c == '%' ? NumType::Int : c == '!' ? NumType::Single : NumType::Double;
+}
+
+/**
+ * typeOfName: Type of a variable from its canonical name. The parser
+ * canonicalises names (Parser::internVar) to base + '%' for Int and
+ * base + '!' for Single; Double names carry no suffix.
+ */
+constexpr NumType typeOfName(std::string_view name) {
+    return !name.empty() && isTypeSuffix(name.back()) ? typeOfSuffix(name.back()) : NumType::Double;
+}
+
+/**
+ * literalType: Narrowest type that holds a literal exactly, as GW-BASIC
+ * types constants: Int for whole numbers in -32768..32767, Single for at
+ * most 7 significant digits, otherwise Double.
+ */
+NumType literalType(double v);
+
+} // namespace gwbasic
@@ -14,11 +14,16 @@ namespace gwbasic {
  * Outputs:
  *  - Concrete Expr node used by codegen to materialize constants
  * Theory of operation:
- *  - Emitted as an SSA constant or loaded immediate in LLVM IR.
+ *  - Emitted as an SSA constant or loaded immediate in LLVM IR, in the
+ *    type its context needs (its own type is literalType(value), flexible).
  */
 struct NumberExpr : Expr {
+    static constexpr ExprKind kKind = ExprKind::Number;
     double value;
-    explicit NumberExpr(double v) : value(v) {}
+    explicit NumberExpr(double v) : Expr(kKind), value(v) {
+        type = literalType(v);
+        flexible = true;
+    }
 };
 
 } // namespace gwbasic
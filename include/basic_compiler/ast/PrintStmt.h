@@ -1,26 +1,32 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
 #include "basic_compiler/ast/Stmt.h"
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/AstRef.h"
 
 namespace gwbasic {
 
 /**
  * Type: PrintStmt
  * Purpose:
- *  - PRINT a string or numeric expression using printf.
+ *  - PRINT a string or numeric expression to the buffered output runtime.
  * Inputs:
  *  - value: Expression to print (StringExpr or numeric Expr)
+ *  - newline: false for text written exactly as it is (the output
+ *    AstOptimizer::evaluateProgram precomputed, newlines included)
  * Outputs:
- *  - Concrete Stmt node; codegen routes to @printf with proper format
+ *  - Concrete Stmt node; codegen calls the runtime entry point for its type
  * Theory of operation:
- *  - String literals use "%s\n"; numeric expressions use "%f\n".
+ *  - String literals go to rt_print_line (rt_print_str without the
+ *    newline); numeric expressions go to rt_print_num, which prints them
+ *    as "%f\n" would.
  */
 struct PrintStmt : Stmt {
-    std::unique_ptr<Expr> value; // may be StringExpr or other Expr
-    explicit PrintStmt(std::unique_ptr<Expr> v) : value(std::move(v)) {}
+    static constexpr StmtKind kKind = StmtKind::Print;
+    AstRef<Expr> value; // may be StringExpr or other Expr
+    bool newline{true};
+    explicit PrintStmt(AstRef<Expr> v) : Stmt(kKind), value(v) {}
 };
 
 } // namespace gwbasic
@@ -1,7 +1,10 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
+#include <memory>
 #include <vector>
+#include "basic_compiler/ast/AstArena.h"
+#include "basic_compiler/ast/AstCast.h"
 #include "basic_compiler/ast/Line.h"
 #include "basic_compiler/ast/AssignStmt.h"
 #include "basic_compiler/ast/PrintStmt.h"
@@ -27,14 +30,19 @@ namespace gwbasic {
  *    order and associated statements.
  * Inputs:
  *  - lines: Sequence of Line nodes, ascending by line number
+ *  - arena: Compilation-wide storage owning every node, string and list
+ *    reachable from lines
  * Outputs:
  *  - Structural root consumed by the CodeGenerator
  * Theory of operation:
  *  - Parser builds and returns a Program; downstream phases traverse it to
- *    analyze and emit LLVM IR.
+ *    analyze and emit LLVM IR and allocate any replacement nodes from the
+ *    same arena. Destroying the Program releases the whole tree at once.
+ *    The arena is held by pointer so moving a Program never moves nodes.
  */
 struct Program {
     std::vector<Line> lines;
+    std::unique_ptr<AstArena> arena{std::make_unique<AstArena>()};
 };
 
 } // namespace gwbasic
@@ -11,10 +11,15 @@ namespace gwbasic {
  *  - Return from a subroutine invoked via GOSUB.
  * Inputs: none
  * Outputs:
- *  - Concrete Stmt node; codegen branches to synthesized return label
+ *  - Concrete Stmt node; codegen branches to the shared return dispatcher,
+ *    which pops the GOSUB return-site stack (or ends the program when the
+ *    stack is empty)
  * Theory of operation:
  *  - Works in conjunction with GosubStmt lowering strategy.
  */
-struct ReturnStmt : Stmt { };
+struct ReturnStmt : Stmt {
+    static constexpr StmtKind kKind = StmtKind::Return;
+    ReturnStmt() : Stmt(kKind) {}
+};
 
 } // namespace gwbasic
@@ -1,6 +1,7 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
+#include "basic_compiler/ast/NodeKind.h"
 #include "basic_compiler/ast/SourcePos.h"
 
 namespace gwbasic {
@@ -11,15 +12,22 @@ namespace gwbasic {
  *  - Common base for all statements (PRINT, LET/assignment, control flow,
  *    loops, subroutine calls, etc.).
  * Inputs:
+ *  - kind: StmtKind tag set by the concrete subclass constructor
  *  - pos: Source position captured by the parser for diagnostics/logging
  * Outputs:
- *  - Virtual base enabling polymorphic statement handling
+ *  - Base enabling kind-tagged statement handling
  * Theory of operation:
- *  - Concrete statements subclass Stmt and are stored via
- *    std::unique_ptr<Stmt> in containing structures.
+ *  - Concrete statements subclass Stmt, live in the Program's AstArena and
+ *    are referenced via AstRef<Stmt>/AstList<Stmt> in containing structures.
+ *    Destructors are never run, so members must be trivially destructible
+ *    (AstArena::make static_asserts it; hence no virtual destructor).
+ *  - Passes dispatch on kind (switch or astCast<T>); a subclass that does not
+ *    pass a kind stays StmtKind::Unknown and is rejected by codegen.
  */
 struct Stmt {
-    virtual ~Stmt() = default;
+    Stmt() = default;
+    explicit Stmt(StmtKind k) : kind(k) {}
+    const StmtKind kind{StmtKind::Unknown};
     SourcePos pos{};
 };
 
@@ -1,8 +1,9 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <string>
+#include <string_view>
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/SymbolTable.h"
 
 namespace gwbasic {
 
@@ -11,16 +12,20 @@ namespace gwbasic {
  * Purpose:
  *  - Represent a string literal in the AST (without surrounding quotes).
  * Inputs:
- *  - value: Raw string contents
+ *  - value: Raw string contents (arena-owned text)
+ *  - sym: Interned id of value (kNoSymbol when built without the interner)
  * Outputs:
  *  - Concrete Expr node used by codegen to place literal data in .rodata
  * Theory of operation:
- *  - Codegen interns literals and emits global string constants with
- *    references via getelementptr for @printf calls.
+ *  - Codegen numbers literals by symbol id and emits global string
+ *    constants passed with their length to the output runtime.
  */
 struct StringExpr : Expr {
-    std::string value;
-    explicit StringExpr(std::string v) : value(std::move(v)) {}
+    static constexpr ExprKind kKind = ExprKind::String;
+    std::string_view value;
+    SymbolId sym{kNoSymbol};
+    explicit StringExpr(std::string_view v) : Expr(kKind), value(v) {}
+    explicit StringExpr(Symbol s) : Expr(kKind), value(s.text), sym(s.id) {}
 };
 
 } // namespace gwbasic
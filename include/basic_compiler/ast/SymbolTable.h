@@ -0,0 +1,67 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace gwbasic {
+
+/** Dense symbol number: 0, 1, 2, ... in first-interned order. */
+using SymbolId = std::uint32_t;
+
+/** Marks a node built without the interner (e.g., by hand in tests). */
+inline constexpr SymbolId kNoSymbol = ~SymbolId{0};
+
+/**
+ * Type: Symbol
+ * Purpose:
+ *  - Result of interning: the dense id plus a view of the stored text.
+ */
+struct Symbol {
+    SymbolId id{kNoSymbol};
+    std::string_view text{};
+};
+
+/**
+ * Class: SymbolTable
+ * Purpose:
+ *  - Map each distinct identifier or string-literal text of a program to a
+ *    dense SymbolId, so later phases key side tables by index instead of
+ *    by string.
+ * Inputs:
+ *  - find(text): Look up existing text
+ *  - add(text): Register new text; the view must stay valid for the
+ *    table's lifetime (AstArena::intern copies it into the arena first)
+ * Outputs:
+ *  - SymbolId per distinct text; name(id) returns the text
+ * Theory of operation:
+ *  - Hashing happens once per occurrence while parsing. Every consumer
+ *    after that works with the id alone, e.g., std::vector<T> indexed by
+ *    SymbolId sized with size().
+ */
+class SymbolTable {
+public:
+    SymbolId find(std::string_view text) const {
+        const auto it = ids_.find(text);
+        return it == ids_.end() ? kNoSymbol : it->second;
+    }
+
+    SymbolId add(std::string_view text) {
+        const auto id = static_cast<SymbolId>(names_.size());
+        names_.push_back(text);
+        ids_.emplace(text, id);
+        return id;
+    }
+
+    std::string_view name(SymbolId id) const { return names_[id]; }
+    std::size_t size() const { return names_.size(); }
+
+private:
+    std::vector<std::string_view> names_{};
+    std::unordered_map<std::string_view, SymbolId> ids_{};
+};
+
+} // namespace gwbasic
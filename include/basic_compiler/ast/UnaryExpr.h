@@ -1,8 +1,8 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/AstRef.h"
 
 namespace gwbasic {
 
@@ -12,16 +12,24 @@ namespace gwbasic {
  *  - Represent unary plus/minus applied to an expression.
  * Inputs:
  *  - op: '+' or '-'
- *  - inner: Owned operand expression
+ *  - inner: Operand expression (arena-owned)
  * Outputs:
  *  - Concrete Expr node interpreted as +x or -x
  * Theory of operation:
  *  - Codegen emits a no-op for unary '+' and an fneg for unary '-'.
  */
 struct UnaryExpr : Expr {
+    static constexpr ExprKind kKind = ExprKind::Unary;
     char op; // '+' or '-'
-    std::unique_ptr<Expr> inner;
-    UnaryExpr(char o, std::unique_ptr<Expr> e) : op(o), inner(std::move(e)) {}
+    AstRef<Expr> inner;
+    UnaryExpr(char o, AstRef<Expr> e) : Expr(kKind), op(o), inner(e) { retype(); }
+
+    /** retype: Take the operand's type. */
+    void retype() {
+        if (!inner) return;
+        type = inner->type;
+        flexible = inner->flexible;
+    }
 };
 
 } // namespace gwbasic
@@ -1,8 +1,9 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <string>
+#include <string_view>
 #include "basic_compiler/ast/Expr.h"
+#include "basic_compiler/ast/SymbolTable.h"
 
 namespace gwbasic {
 
@@ -11,16 +12,21 @@ namespace gwbasic {
  * Purpose:
  *  - Reference to a scalar variable by name.
  * Inputs:
- *  - name: Identifier (case-insensitive in BASIC semantics; stored raw)
+ *  - name: Identifier (case-insensitive in BASIC semantics; stored raw,
+ *    arena-owned text)
+ *  - sym: Interned id of name (kNoSymbol for nodes built without an arena
+ *    interner)
  * Outputs:
- *  - Concrete Expr node; codegen ensures allocation and loads/stores as needed
+ *  - Concrete Expr node typed by the name's suffix (see typeOfName)
  * Theory of operation:
- *  - Codegen maintains a symbol table mapping variable names to allocas
- *    within the current function scope.
+ *  - Codegen maps symbol ids to SSA slots (flat tables indexed by sym).
  */
 struct VarExpr : Expr {
-    std::string name;
-    explicit VarExpr(std::string n) : name(std::move(n)) {}
+    static constexpr ExprKind kKind = ExprKind::Var;
+    std::string_view name;
+    SymbolId sym{kNoSymbol};
+    explicit VarExpr(std::string_view n) : Expr(kKind), name(n) { type = typeOfName(name); }
+    explicit VarExpr(Symbol s) : Expr(kKind), name(s.text), sym(s.id) { type = typeOfName(name); }
 };
 
 } // namespace gwbasic
@@ -0,0 +1,77 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gwbasic {
+
+/**
+ * Class: BitSet
+ * Purpose:
+ *  - Fixed-size set of dense indices (definition ids, SymbolIds) used as
+ *    the lattice value of the dataflow analyses.
+ * Theory of operation:
+ *  - 64 indices per word; unite() and intersect() report whether the set
+ *    changed, which is all a worklist solver needs to decide whether to
+ *    revisit a node.
+ */
+class BitSet {
+public:
+    BitSet() = default;
+    explicit BitSet(std::size_t bits) : words_((bits + 63) / 64, 0) {}
+
+    bool test(std::size_t i) const { return (words_[i / 64] >> (i % 64)) & 1; }
+    void set(std::size_t i) { words_[i / 64] |= std::uint64_t{1} << (i % 64); }
+    void reset(std::size_t i) { words_[i / 64] &= ~(std::uint64_t{1} << (i % 64)); }
+    void clear() {
+        for (auto& w : words_) w = 0;
+    }
+
+    /** unite: this |= other (same size); true when a bit was added. */
+    bool unite(const BitSet& other) {
+        bool grew = false;
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            const std::uint64_t merged = words_[w] | other.words_[w];
+            grew = grew || merged != words_[w];
+            words_[w] = merged;
+        }
+        return grew;
+    }
+
+    /** intersect: this &= other (same size); true when a bit was removed. */
+    bool intersect(const BitSet& other) {
+        bool shrank = false;
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            const std::uint64_t merged = words_[w] & other.words_[w];
+            shrank = shrank || merged != words_[w];
+            words_[w] = merged;
+        }
+        return shrank;
+    }
+
+    /** overlaps: Whether the sets share a member (equal sizes). */
+    bool overlaps(const BitSet& other) const {
+        for (std::size_t w = 0; w < words_.size(); ++w)
+            if (words_[w] & other.words_[w]) return true;
+        return false;
+    }
+
+    /** forEach: Call f(index) for every member, ascending. */
+    template <class F>
+    void forEach(F&& f) const {
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            for (std::uint64_t bits = words_[w]; bits != 0; bits &= bits - 1)
+                f(w * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+        }
+    }
+
+    friend bool operator==(const BitSet&, const BitSet&) = default;
+
+private:
+    std::vector<std::uint64_t> words_;
+};
+
+} // namespace gwbasic
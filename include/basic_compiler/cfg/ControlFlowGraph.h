@@ -0,0 +1,82 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "basic_compiler/ast/Program.h"
+
+namespace gwbasic {
+
+/**
+ * Class: ControlFlowGraph
+ * Purpose:
+ *  - Line-level control-flow graph of a Program shared by the optimizer and
+ *    the code generator.
+ * Inputs:
+ *  - program: lines in any order (duplicates: the last one wins, as in the
+ *    former line map)
+ * Outputs:
+ *  - Dense line index (0..size()-1, ascending line number), resolved
+ *    GOTO/IF/GOSUB targets (targets()), reachability, and basic-block
+ *    leaders
+ * Theory of operation:
+ *  - Line numbers are resolved once, through a direct table when the
+ *    numbers are compact (always for GW-BASIC's 0..65529) and a sorted
+ *    search otherwise; afterwards everything is addressed by index.
+ *  - A line falls through unless it ends in GOTO, END or RETURN; GOSUB
+ *    enters its target and continues in the same line. Lines not reachable
+ *    from the first line by jumps or fall-through are dead.
+ *  - A reachable line starts a basic block (is a leader) when it is the
+ *    first line or a jump target; every other reachable line is entered
+ *    only by falling through from its predecessor and joins its block.
+ */
+class ControlFlowGraph {
+public:
+    static constexpr int kNone = -1;
+
+    ControlFlowGraph() = default;
+    explicit ControlFlowGraph(const Program& program) { build(program); }
+
+    /** build: (Re)analyze program; the Program must outlive the graph. */
+    void build(const Program& program);
+
+    std::size_t size() const { return lines_.size(); }
+    /** indexOf: Dense index of a line number, or kNone. */
+    int indexOf(int lineNumber) const;
+    int number(int idx) const { return lines_[static_cast<std::size_t>(idx)]->number; }
+    const Line& line(int idx) const { return *lines_[static_cast<std::size_t>(idx)]; }
+    /** find: Line with the given number, or nullptr. */
+    const Line* find(int lineNumber) const {
+        const int idx = indexOf(lineNumber);
+        return idx == kNone ? nullptr : lines_[static_cast<std::size_t>(idx)];
+    }
+
+    bool reachable(int idx) const { return flags_[static_cast<std::size_t>(idx)] & kReachable; }
+    bool isLeader(int idx) const { return flags_[static_cast<std::size_t>(idx)] & kLeader; }
+    bool fallsThrough(int idx) const { return flags_[static_cast<std::size_t>(idx)] & kFallsThrough; }
+    /** targets: Resolved jump targets of a line's statements, in statement order. */
+    std::span<const int> targets(int idx) const {
+        const auto i = static_cast<std::size_t>(idx);
+        return std::span<const int>(edges_).subspan(firstEdge_[i], firstEdge_[i + 1] - firstEdge_[i]);
+    }
+    /** reachableCount/blockCount: Live lines and basic blocks they form. */
+    std::size_t reachableCount() const { return reachableCount_; }
+    std::size_t blockCount() const { return blockCount_; }
+
+private:
+    enum : std::uint8_t { kReachable = 1, kLeader = 2, kFallsThrough = 4, kTarget = 8 };
+    static constexpr int kDenseLimit = 1 << 20; // largest line number given a direct slot
+
+    std::vector<const Line*> lines_; // by dense index
+    std::vector<std::uint8_t> flags_; // by dense index
+    std::vector<int> dense_; // line number -> index (kNone if absent); empty when sparse
+    std::vector<int> numbers_; // by dense index (sorted; used when sparse)
+    std::vector<int> edges_; // jump targets of every line, flat
+    std::vector<std::size_t> firstEdge_; // by dense index (+1 sentinel): start of its targets in edges_
+    std::size_t reachableCount_{0};
+    std::size_t blockCount_{0};
+};
+
+} // namespace gwbasic
@@ -0,0 +1,278 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "basic_compiler/ast/Program.h"
+#include "basic_compiler/cfg/BitSet.h"
+#include "basic_compiler/cfg/ControlFlowGraph.h"
+
+namespace gwbasic {
+
+/**
+ * Dataflow analyses over the line-level ControlFlowGraph
+ *
+ * Variables are identified by SymbolId (varOf), so every set is a BitSet
+ * indexed densely. AvailableCopies and Liveness store one set per basic
+ * block (at its leader line, so memory grows with jumps rather than with
+ * program size) and expose the per-statement transfer function: a client
+ * pass replays a block's lines from the stored set to get the facts at
+ * each statement. blockEnd() gives the last line of the block a leader
+ * starts. ReachingDefinitions, whose sets would grow with the program
+ * twice over (blocks times definitions), answers per read instead.
+ *
+ * Control transfers inside a line are followed where they happen: an IF
+ * leaves for its target after evaluating its condition and otherwise
+ * continues with the next statement; GOTO, END and RETURN end the line
+ * (statements after them never run, see reachableStatements). GOSUB is
+ * modelled context-insensitively: the statement after any GOSUB continues
+ * with what holds at every RETURN, and a RETURN sees what is needed after
+ * every GOSUB. A FOR statement is one node: its body (a single line, never
+ * containing jumps) runs zero or more times.
+ */
+
+/** varOf: Variable id of a name reference (interning by name for hand-built nodes); kNoSymbol if unknown. */
+inline SymbolId varOf(const SymbolTable& symbols, SymbolId sym, std::string_view name) {
+    return sym != kNoSymbol ? sym : symbols.find(name);
+}
+
+/** addReads: Add every variable e reads to vars (sized by symbol count). */
+void addReads(const SymbolTable& symbols, const Expr* e, BitSet& vars);
+
+/** blockEnd: Last line of the basic block that starts at leader (lines entered only by falling through). */
+inline int blockEnd(const ControlFlowGraph& cfg, int leader) {
+    int last = leader;
+    while (static_cast<std::size_t>(last) + 1 < cfg.size() && cfg.reachable(last + 1) && !cfg.isLeader(last + 1)) ++last;
+    return last;
+}
+
+/** reachableStatements: Statements of a line that can run (through the first GOTO/END/RETURN). */
+inline std::size_t reachableStatements(const Line& line) {
+    std::size_t k = 0;
+    while (k < line.statements.size()) {
+        const StmtKind kind = line.statements[k++]->kind;
+        if (kind == StmtKind::Goto || kind == StmtKind::End || kind == StmtKind::Return) break;
+    }
+    return k;
+}
+
+/**
+ * Type: Definition
+ * Purpose:
+ *  - One place a variable receives a value.
+ * Members:
+ *  - kind: Entry (the zero every variable starts with), Assign, Input,
+ *    Loop (a FOR variable or a variable assigned in a FOR body: whatever
+ *    value the loop leaves), or Join (the definitions merging where
+ *    control flow meets, see ReachingDefinitions::operands)
+ *  - var: variable defined
+ *  - stmt: defining statement (nullptr for Entry and Join)
+ */
+struct Definition {
+    enum class Kind : std::uint8_t { Entry, Assign, Input, Loop, Join };
+    Kind kind;
+    SymbolId var;
+    const Stmt* stmt;
+};
+
+/**
+ * Class: ReachingDefinitions
+ * Purpose:
+ *  - Factored use-def chains: for a variable at a statement, the single
+ *    definition reaching it, where a Join stands for the definitions that
+ *    meet at the start of a block (static single assignment form).
+ * Inputs:
+ *  - program, cfg: the Program and its ControlFlowGraph (both must outlive
+ *    the analysis and stay unchanged while it is used)
+ * Outputs:
+ *  - reaching(st, var): id (defs()) of the definition of var reaching st
+ *  - operands(join): the definitions a Join merges, one per incoming edge
+ * Theory of operation:
+ *  - build() cuts the reachable code into segments: a basic block, split
+ *    after each IF and GOSUB so that every segment is left at its end
+ *    (what follows a GOSUB continues from the RETURNs, which meet in one
+ *    pseudo segment; another one, holding the Entry zeros, leads to the
+ *    first line). It records each segment's definitions per variable
+ *    in statement order and its incoming edges with the statement each
+ *    leaves at, then computes the dominator tree of the segments and
+ *    places a Join for a variable at the iterated dominance frontier of
+ *    the segments defining it, so Joins exist only where different
+ *    definitions meet.
+ *  - reaching() takes the last definition of the variable before the
+ *    statement in its segment, else the segment's Join for it, else the
+ *    last one of the nearest dominating segment that defines it or joins
+ *    it: a binary search over those segments in dominator-tree order.
+ *    Nothing is propagated per block, so time and memory grow with the
+ *    program and its Joins rather than with blocks times definitions.
+ */
+class ReachingDefinitions {
+public:
+    ReachingDefinitions() = default;
+    ReachingDefinitions(const Program& program, const ControlFlowGraph& cfg) { build(program, cfg); }
+
+    /** build: (Re)analyze program. */
+    void build(const Program& program, const ControlFlowGraph& cfg);
+
+    /** defs: Every definition (reaching() appends a variable's Entry definition when first needed). */
+    const std::vector<Definition>& defs() const { return defs_; }
+    /** operands: Definitions a Join merges (empty for other kinds). */
+    std::span<const int> operands(int def) const {
+        const auto [first, count] = operandRange_[static_cast<std::size_t>(def)];
+        return std::span<const int>(operands_).subspan(first, count);
+    }
+    /** contains: Whether st is a reachable top-level statement of the program. */
+    bool contains(const Stmt& st) const {
+        const auto it = sites_.find(&st);
+        return it != sites_.end() && it->second.segment >= 0;
+    }
+    /**
+     * reaching: Definition of var reaching st (contains(st)), or -1. With
+     * after set it is the one holding right after st's own definitions, as
+     * a FOR's limits and body see them.
+     */
+    int reaching(const Stmt& st, SymbolId var, bool after = false);
+
+private:
+    struct Edge {
+        int from; // segment
+        int end; // statements of it that ran before leaving
+    };
+    struct Site {
+        int segment; // -1 when unreachable or the statement occurs more than once
+        int index;
+    };
+    struct Dominating {
+        int pre; // dominator-tree preorder number of the segment
+        int last; // largest preorder number below it
+        int segment;
+        int parent; // nearest entry of the same variable dominating it, or -1
+    };
+    static std::uint64_t key(int segment, SymbolId var) { return (std::uint64_t{static_cast<std::uint32_t>(segment)} << 32) | var; }
+    std::span<const Edge> edgesInto(int segment) const {
+        const auto s = static_cast<std::size_t>(segment);
+        return std::span<const Edge>(edges_).subspan(firstEdge_[s], firstEdge_[s + 1] - firstEdge_[s]);
+    }
+    int lastDefinition(int segment, int end, SymbolId var) const;
+    int atStart(int segment, SymbolId var);
+    int atEnd(int segment, SymbolId var);
+    int entryOf(SymbolId var);
+    void computeDominators(int segments);
+    void placeJoins(std::vector<std::pair<SymbolId, int>>& defining);
+
+    std::vector<Definition> defs_;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> operandRange_; // by definition: Join operands in operands_
+    std::vector<int> operands_;
+    std::vector<int> entry_; // by SymbolId: its Entry definition, or -1
+    std::unordered_map<const Stmt*, Site> sites_;
+    std::vector<std::pair<int, int>> placed_; // (statement index, definition), grouped by segment and variable
+    std::unordered_map<std::uint64_t, std::pair<std::uint32_t, std::uint32_t>> placedRange_; // key -> [first, last) in placed_
+    std::vector<Edge> edges_; // grouped by the segment they enter
+    std::vector<std::size_t> firstEdge_; // by segment (+1 sentinel): start of its edges in edges_
+    int start_{-1}; // pseudo segment the program starts from (Entry definitions)
+    std::vector<int> idom_; // by segment: immediate dominator, -1 for start_ and unreachable segments
+    std::vector<int> pre_; // by segment: dominator-tree preorder number, -1 when unreachable
+    std::vector<int> last_; // by segment: largest preorder number in its subtree
+    std::unordered_map<std::uint64_t, int> joins_; // key -> the Join of the variable at the segment
+    std::vector<Dominating> dominating_; // segments defining or joining a variable, grouped by variable, by pre
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> dominatingRange_; // by SymbolId: [first, last) in dominating_
+};
+
+/**
+ * Type: Copy
+ * Purpose:
+ *  - A top-level assignment `target = source` between two variables of
+ *    the same type.
+ */
+struct Copy {
+    SymbolId target;
+    SymbolId source;
+    const Stmt* stmt;
+};
+
+/**
+ * Class: AvailableCopies
+ * Purpose:
+ *  - For every basic block, the copies that hold on every path to its
+ *    first statement: the copy ran and neither of its variables has been
+ *    assigned since.
+ * Inputs:
+ *  - program, cfg: as for ReachingDefinitions
+ * Outputs:
+ *  - copies(): every Copy, indexed by copy id
+ *  - in(leader): BitSet of copy ids available at the start of a block
+ * Theory of operation:
+ *  - Forward worklist solver over blocks with intersection as the meet,
+ *    starting from nothing at line 0; a block's set is taken from its
+ *    first visit and only shrinks afterwards. Any definition of either
+ *    variable kills a copy (a FOR kills those of its variable and body
+ *    targets), and GOSUB kills every copy, so RETURN needs no edges.
+ */
+class AvailableCopies {
+public:
+    AvailableCopies(const Program& program, const ControlFlowGraph& cfg) { build(program, cfg); }
+
+    /** build: (Re)analyze program. */
+    void build(const Program& program, const ControlFlowGraph& cfg);
+
+    const std::vector<Copy>& copies() const { return copies_; }
+    const BitSet& in(int leader) const { return in_[static_cast<std::size_t>(leader)]; }
+    /** transfer: Advance state (copies available before st) past st. */
+    void transfer(const Stmt& st, BitSet& state) const;
+
+private:
+    const SymbolTable* symbols_{nullptr};
+    std::vector<Copy> copies_;
+    std::vector<std::vector<int>> varCopies_; // by SymbolId: copies reading or writing it
+    std::unordered_map<const Stmt*, int> copyOf_; // statement -> copy id
+    std::vector<BitSet> in_; // by dense line index; sized for leaders only
+};
+
+/**
+ * Class: Liveness
+ * Purpose:
+ *  - For every basic block, the variables whose current value may still
+ *    be read.
+ * Inputs:
+ *  - program, cfg: as for ReachingDefinitions
+ * Outputs:
+ *  - in(leader): BitSet of SymbolIds live at the start of a block
+ *  - out(last): live after the last line of a block (blockEnd)
+ * Theory of operation:
+ *  - Backward worklist solver over blocks with union as the meet, starting
+ *    from every block with nothing live after END or the last line. A
+ *    change to a block's set revisits its predecessors (jumps and
+ *    fall-through); a GOSUB merges what is live after it into the shared
+ *    continuation set and revisits every block containing a RETURN.
+ *  - PRINT, IF and expressions read; assignments and INPUT kill. A FOR
+ *    kills only its variable (the body may run zero times) and reads
+ *    everything its limits and body read.
+ */
+class Liveness {
+public:
+    Liveness(const Program& program, const ControlFlowGraph& cfg) { build(program, cfg); }
+
+    /** build: (Re)analyze program. */
+    void build(const Program& program, const ControlFlowGraph& cfg);
+
+    const BitSet& in(int leader) const { return in_[static_cast<std::size_t>(leader)]; }
+    BitSet out(int last) const {
+        const auto next = static_cast<std::size_t>(last) + 1;
+        if (cfg_->fallsThrough(last) && next < in_.size()) return in_[next];
+        return BitSet(symbols_->size());
+    }
+    /** transfer: Turn live (variables live after st) into those live before it. */
+    void transfer(const Stmt& st, BitSet& live) const;
+
+private:
+    const SymbolTable* symbols_{nullptr};
+    const ControlFlowGraph* cfg_{nullptr};
+    std::vector<BitSet> in_; // by dense line index; sized for leaders only
+    BitSet continuations_; // live after any GOSUB (what a RETURN leads to)
+};
+
+} // namespace gwbasic
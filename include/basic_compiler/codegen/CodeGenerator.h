@@ -1,15 +1,16 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <map>
-#include <set>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <fstream>
-#include <sstream>
 
 #include "basic_compiler/ast/Program.h"
+#include "basic_compiler/cfg/ControlFlowGraph.h"
 #include "basic_compiler/codegen/CodeGenError.h"
+#include "basic_compiler/codegen/IrSink.h"
+#include "basic_compiler/log/Log.h"
 
 namespace gwbasic {
 
@@ -20,109 +21,195 @@ namespace gwbasic {
  * Inputs:
  *  - program: Parsed program to compile
  * Outputs:
- *  - std::string: Complete LLVM IR module as text
+ *  - LLVM IR module as text, streamed into an IrSink (file, pipe, memory)
  * Theory of operation:
- *  - Two-phase approach: collect declarations (variables, strings), then
- *    emit module header/globals and lower each line’s statements into IR.
- *  - Logging hooks provide detailed mapping from AST to emitted IR.
+ *  - Two-phase approach: collect declarations (variables, strings) and
+ *    the line CFG, then emit module header/globals and lower each live
+ *    line's statements into IR. Lines that are not jump targets continue
+ *    the previous line's basic block; dead lines are not emitted.
+ *  - Emission writes straight into the sink; no intermediate copy of the
+ *    module is built unless the caller asks for a string.
+ *  - Logging hooks provide detailed mapping from AST to emitted IR; records
+ *    go through GWBASIC_LOG and cost nothing unless the log is enabled.
  */
 class CodeGenerator {
 public:
     CodeGenerator() = default;
 
-    /** Convert Program to LLVM IR (text form). */
+    /** Convert Program to LLVM IR (text form), streaming it into out. */
+    void generate(const Program& program, IrSink& out);
+    /** Convert Program to LLVM IR (text form) held in memory. */
     std::string generate(const Program& program);
 
 private:
-    // Counters and symbol maps
+    // Counters and symbol tables. Variables and string literals are keyed by
+    // the parser's SymbolId, so the per-node lookups below are vector indexing.
     int tempCounter_{0};
     int strCounter_{0};
-    std::set<std::string> variables_;
-    std::map<std::string, std::string> varAllocaName_;
-    std::map<std::string, int> strLiteralId_; // string -> id
-    std::vector<int> lineNumbers_; // sorted line numbers
-    std::map<int, const Line*> lineMap_;
+    AstArena* arena_{nullptr}; // owns the interner of the Program being compiled
+    std::vector<SymbolId> variables_; // assigned variables, by SSA slot
+    std::vector<NumType> slotTypes_; // by SSA slot (from the canonical name)
+    std::vector<int> varSlot_; // by SymbolId; -1 when never assigned (reads 0.0)
+    std::vector<int> strLiteralId_; // by SymbolId; -1 when not a literal
+    std::vector<SymbolId> strLiterals_; // by literal id
+    ControlFlowGraph cfg_; // dense line index, reachability, block leaders
     int currentLine_{0};
 
-    // Phase logging
-    bool logEnabled_{false};
-    std::string logPath_{};
-    std::ofstream logFile_;
-    bool semLogEnabled_{false};
-    std::string semLogPath_{};
-    std::ofstream semLogFile_;
+    // GOSUB lowering. Tiny leaf subroutines (at most kInlineStmtLimit
+    // assignments/PRINTs, then RETURN) are expanded at the call site. Every
+    // other subroutine exists once, as its ordinary lines: GOSUB pushes a
+    // return-site id onto a fixed stack in main's frame and RETURN branches
+    // to one dispatcher that pops it and switches to the continuation.
+    static constexpr int kGosubDepth = 1024;
+    static constexpr std::size_t kInlineStmtLimit = 4;
+    bool useReturnStack_{false};
+    std::vector<std::string> returnSites_; // continuation label by return-site id - 1
+
+    // SSA construction. Variables live in registers, not memory: values_
+    // holds each slot's current value (register or literal) at the emission
+    // point. Joins (leader lines, FOR headers, the return dispatcher) get
+    // phis. Edges from already-emitted blocks are recorded with their
+    // values; back edges (to a line at or before the jumping one) go
+    // through an edge block whose name is fixed in advance by planJoins,
+    // where the outgoing values are given names the phi refers to ahead.
+    struct Edge {
+        std::string block; // predecessor label
+        std::vector<std::string> values; // by slot
+    };
+    std::vector<std::string> values_; // by slot
+    std::string curBlock_; // label of the block being emitted
+    int currentIndex_{0}; // dense index of the line being emitted
+    std::vector<std::vector<Edge>> lineEdges_; // forward edges by dense line index
+    std::vector<std::vector<std::string>> backEdges_; // edge-block labels by dense line index
+    std::vector<Edge> returnEdges_; // RETURN sites feeding %gosub_return
+    bool usesInput_{false}; // INPUT needs %input.tmp for scanf
+
+    // Output runtime (emitRuntime). PRINT appends to a kOutputBuffer-byte
+    // buffer through internal rt_print_* functions emitted into the module;
+    // it is written with write(2) when full, before INPUT and at exit.
+    static constexpr int kOutputBuffer = 1 << 16;
+    bool usesPrint_{false}; // PRINT needs the runtime
+
+    // Numeric types. Expressions are computed as i32 (Int), float (Single)
+    // or double (Double); Int variables are stored as i16 values and
+    // widened on read. Converting to Int rounds half to even (llvm.rint).
+    static const char* irType(NumType t) { return t == NumType::Int ? "i32" : t == NumType::Single ? "float" : "double"; }
+    static const char* storageType(NumType t) { return t == NumType::Int ? "i16" : irType(t); }
+    static const std::string& zeroOf(NumType t) {
+        static const std::string intZero = "0", floatZero = "0.0";
+        return t == NumType::Int ? intZero : floatZero;
+    }
+    const char* slotType(int slot) const { return storageType(slotTypes_[static_cast<std::size_t>(slot)]); }
+
+    // Phase logging (codegen: Trace per instruction, Debug per line/global;
+    // semantic: Debug per event)
+    logging::Channel codegenLog_;
+    logging::Channel semLog_;
 
     // Naming helpers
     std::string nextTemp() { std::string s = "%t"; s += std::to_string(++tempCounter_); return s; }
     static std::string globalStringName(int id) { std::string s = "@.str."; s += std::to_string(id); return s; }
     static std::string lineLabelName(int ln) { std::string s = "line"; s += std::to_string(ln); return s; }
+    /** ssaName: Register for slot's value named after a block ("%X.line10", "%N$i.line10" for N%). */
+    std::string ssaName(int slot, std::string_view block) const {
+        std::string s = "%";
+        for (const char c : arena_->symbols().name(variables_[static_cast<std::size_t>(slot)])) {
+            if (c == '%') s += "$i";
+            else if (c == '!') s += "$s";
+            else s += c;
+        }
+        s += '.'; s += block; return s;
+    }
+    void beginBlock(IrSink& out, const std::string& label) { out << label << ":\n"; curBlock_ = label; }
+    /** valueOf: Current SSA value of a variable, in its storage type. */
+    const std::string& valueOf(SymbolId sym) const {
+        const int slot = varSlot_[sym];
+        return slot < 0 ? zeroOf(typeOfName(arena_->symbols().name(sym))) : values_[static_cast<std::size_t>(slot)];
+    }
 
     // Declaration collection
+    /** symbolOf: Node's interned id (interning name for hand-built nodes); grows the tables. */
+    SymbolId symbolOf(SymbolId sym, std::string_view name);
+    /** declareVar: Give an assigned variable its SSA slot. */
+    void declareVar(SymbolId sym);
     void collectDecls(const Program& program);
     void collectExprVars(const Expr* e);
     void collectStmtVars(const Stmt* s);
 
     // Emission helpers
-    void emitHeader(std::ostringstream& out);
-    void emitGlobals(std::ostringstream& out);
-    void emitMainPrologue(std::ostringstream& out);
-
-    static void emitMainEpilogue(std::ostringstream& out);
-    void emitLineBlock(std::ostringstream& out, const Line& line, int lineIndex, int lastIndex);
-    void emitFor(std::ostringstream& out, const ForStmt* fs, const std::string& currLineLabel, int& localCounter);
-    void emitSubroutineInline(std::ostringstream& out, int targetLine, const std::string& entryLabel, const std::string& returnLabel);
+    void emitHeader(IrSink& out);
+    void emitGlobals(IrSink& out);
+    /** emitRuntime: Buffered output functions rt_flush, rt_print_str, rt_print_line and rt_print_num. */
+    void emitRuntime(IrSink& out);
+    /** emitPrint: Lower a PRINT to a call into the output runtime. */
+    void emitPrint(IrSink& out, const PrintStmt* pr);
+    void emitMainPrologue(IrSink& out);
+
+    void emitMainEpilogue(IrSink& out);
+    void emitLineBlock(IrSink& out, int lineIndex);
+    void emitFor(IrSink& out, const ForStmt* fs, const std::string& currLineLabel, int& localCounter);
+    /** emitForBody: Lower a FOR body (assignments and PRINTs) into the current block. */
+    void emitForBody(IrSink& out, const ForStmt* fs);
+    /** countedLoopStep: Step of a FOR that can count in i64 (emitCountedFor), else 0. */
+    long long countedLoopStep(const ForStmt* fs);
+    /** emitCountedFor: FOR as a guarded do-while over an i64 induction variable. */
+    void emitCountedFor(IrSink& out, const ForStmt* fs, long long step, const std::string& currLineLabel, int& localCounter);
+    /** emitIndex: Integral loop bound as an i64 value. */
+    std::string emitIndex(IrSink& out, const Expr* e);
+    /** exprReads: Whether e reads variable sym. */
+    bool exprReads(const Expr* e, SymbolId sym);
+    void emitGosub(IrSink& out, const GosubStmt* gs, int stmt, const std::string& currLineLabel, int& localCounter);
+    void emitSubroutineInline(IrSink& out, int targetLine, const std::string& entryLabel, const std::string& returnLabel);
+    void emitReturnDispatch(IrSink& out);
+
+    // SSA joins and edges
+    /** planJoins: Name the back-edge blocks into every leader line. */
+    void planJoins();
+    /** emitJoin: Phis (or inherited values) at the top of leader line idx. */
+    void emitJoin(IrSink& out, int lineIndex);
+    /** edgeTo: Branch label for a jump to line idx from statement stmt of the current line. */
+    std::string edgeTo(int lineIndex, int stmt);
+    /** emitBackEdge: Edge block for a back edge returned by edgeTo. */
+    void emitBackEdge(IrSink& out, const std::string& label, int lineIndex);
+    /** assign: Bind a variable to a new SSA value. */
+    void assign(SymbolId sym, const std::string& value);
+
+    // Subroutine planning
+    /** isTinyLeafSubroutine: Whether GOSUB targetLine is expanded inline. */
+    bool isTinyLeafSubroutine(int targetLine) const;
+    /** planSubroutines: Decide whether the return-site stack is needed. */
+    void planSubroutines();
 
     // Expression lowering
-    std::string emitExpr(std::ostringstream& out, const Expr* e, const std::string& currBlockSuffix);
-    std::string emitComparison(std::ostringstream& out, const BinaryExpr* c);
+    /** emitExpr: Value of e computed as type want (see Expr::flexible). */
+    std::string emitExpr(IrSink& out, const Expr* e, NumType want);
+    std::string emitComparison(IrSink& out, const BinaryExpr* c);
+    /** emitConvert: Convert value v between computation types. */
+    std::string emitConvert(IrSink& out, const std::string& v, NumType from, NumType to);
+    /** emitValueFor: Value of e in the storage type of variable sym. */
+    std::string emitValueFor(IrSink& out, const Expr* e, SymbolId sym);
+    /** emitWiden/emitNarrow: i16 storage <-> i32 computation for Int values. */
+    std::string emitWiden(IrSink& out, const std::string& v);
+    std::string emitNarrow(IrSink& out, const std::string& v);
 
     // Utilities
     static std::string escapeForIR(const std::string& s);
     const Line* findLine(int line) const;
-    void ensureVarAllocated(std::ostringstream& out, const std::string& name);
 
     // Logging utilities
-    void log(const std::string& msg) {
-        if (logEnabled_ && logFile_.is_open()) logFile_ << msg << "\n";
-    }
-    void logSem(const std::string& msg) {
-        if (semLogEnabled_ && semLogFile_.is_open()) semLogFile_ << msg << "\n";
-    }
-    static const char* nodeName(const Stmt* s) {
-        if (dynamic_cast<const AssignStmt*>(s)) return "AssignStmt";
-        if (dynamic_cast<const PrintStmt*>(s)) return "PrintStmt";
-        if (dynamic_cast<const GotoStmt*>(s)) return "GotoStmt";
-        if (dynamic_cast<const GosubStmt*>(s)) return "GosubStmt";
-        if (dynamic_cast<const ReturnStmt*>(s)) return "ReturnStmt";
-        if (dynamic_cast<const IfStmt*>(s)) return "IfStmt";
-        if (dynamic_cast<const InputStmt*>(s)) return "InputStmt";
-        if (dynamic_cast<const ForStmt*>(s)) return "ForStmt";
-        if (dynamic_cast<const EndStmt*>(s)) return "EndStmt";
-        return "Stmt";
-    }
-    static const char* nodeName(const Expr* e) {
-        if (dynamic_cast<const NumberExpr*>(e)) return "NumberExpr";
-        if (dynamic_cast<const StringExpr*>(e)) return "StringExpr";
-        if (dynamic_cast<const VarExpr*>(e)) return "VarExpr";
-        if (dynamic_cast<const UnaryExpr*>(e)) return "UnaryExpr";
-        if (dynamic_cast<const BinaryExpr*>(e)) return "BinaryExpr";
-        return "Expr";
-    }
+    static const char* nodeName(const Stmt* s) { return kindName(s->kind); }
+    static const char* nodeName(const Expr* e) { return kindName(e->kind); }
 
 public:
     /** Enable code generation logging to the specified file path. */
-    void setLogPath(const std::string& path) {
-        logPath_ = path;
-        logEnabled_ = true;
-        if (logFile_.is_open()) logFile_.close();
-        logFile_.open(logPath_, std::ios::out | std::ios::trunc);
+    void setLogPath(const std::string& path, logging::Level threshold = logging::Level::Trace,
+                    logging::Format format = logging::Format::Text) {
+        codegenLog_.open(path, threshold, format);
     }
     /** Enable semantic analysis logging to the specified file path. */
-    void setSemanticLogPath(const std::string& path) {
-        semLogPath_ = path;
-        semLogEnabled_ = true;
-        if (semLogFile_.is_open()) semLogFile_.close();
-        semLogFile_.open(semLogPath_, std::ios::out | std::ios::trunc);
+    void setSemanticLogPath(const std::string& path, logging::Level threshold = logging::Level::Trace,
+                            logging::Format format = logging::Format::Text) {
+        semLog_.open(path, threshold, format);
     }
 };
 
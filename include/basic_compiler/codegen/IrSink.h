@@ -0,0 +1,160 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace gwbasic {
+
+/**
+ * Class: IrSink
+ * Purpose:
+ *  - Destination for emitted IR text. Codegen writes into it piece by piece
+ *    instead of building the module in an ostringstream and copying it out.
+ * Inputs:
+ *  - write()/operator<<: text, characters and integers, in emission order
+ * Outputs:
+ *  - Bytes delivered to the concrete sink in large chunks via sinkWrite()
+ * Theory of operation:
+ *  - A fixed kBufferBytes staging buffer collects small writes; when full
+ *    (or on flush()) it is handed to sinkWrite() in one call. Writes larger
+ *    than the buffer bypass it. Nothing but the buffer is retained, so
+ *    streaming to a file or pipe never holds the whole module in memory.
+ *    Concrete sinks flush in their destructors; call flush() explicitly to
+ *    observe errors.
+ */
+class IrSink {
+public:
+    static constexpr std::size_t kBufferBytes = 64 * 1024;
+
+    IrSink() : buf_(new char[kBufferBytes]) {}
+    IrSink(const IrSink&) = delete;
+    IrSink& operator=(const IrSink&) = delete;
+    virtual ~IrSink() = default;
+
+    void write(std::string_view s);
+    void put(char c) {
+        if (used_ == kBufferBytes) flush();
+        buf_[used_++] = c;
+    }
+    /** Deliver buffered bytes to the destination. */
+    void flush();
+
+    IrSink& operator<<(std::string_view s) { write(s); return *this; }
+    IrSink& operator<<(const std::string& s) { write(s); return *this; }
+    IrSink& operator<<(const char* s) { write(s); return *this; }
+    IrSink& operator<<(char c) { put(c); return *this; }
+
+    template <class T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>)
+    IrSink& operator<<(T v) {
+        char tmp[24];
+        const auto r = std::to_chars(tmp, tmp + sizeof(tmp), v);
+        write(std::string_view(tmp, static_cast<std::size_t>(r.ptr - tmp)));
+        return *this;
+    }
+
+protected:
+    /** Deliver one chunk to the destination; throws on failure. */
+    virtual void sinkWrite(const char* data, std::size_t n) = 0;
+
+private:
+    std::unique_ptr<char[]> buf_;
+    std::size_t used_{0};
+};
+
+/**
+ * Class: StringSink
+ * Purpose:
+ *  - Growable in-memory sink (tests, string-returning Compiler helpers).
+ * Outputs:
+ *  - take(): the accumulated text, moved out (no copy)
+ */
+class StringSink final : public IrSink {
+public:
+    ~StringSink() override = default;
+    std::string take() { flush(); return std::move(text_); }
+
+protected:
+    void sinkWrite(const char* data, std::size_t n) override { text_.append(data, n); }
+
+private:
+    std::string text_{};
+};
+
+/**
+ * Class: FileSink
+ * Purpose:
+ *  - Sink writing to a file descriptor: a new/truncated file by path, or a
+ *    borrowed descriptor such as stdout (fd 1).
+ * Inputs (ctor):
+ *  - path: File to create (throws "Unable to open output file: <path>")
+ *  - fd: Already-open descriptor, not closed by the sink
+ * Theory of operation:
+ *  - Chunks go straight to write(2) (fwrite where POSIX I/O is absent).
+ */
+class FileSink final : public IrSink {
+public:
+    explicit FileSink(const std::string& path);
+    explicit FileSink(int fd) : fd_(fd) {}
+    ~FileSink() override;
+
+protected:
+    void sinkWrite(const char* data, std::size_t n) override;
+
+private:
+    int fd_{-1};
+    bool owned_{false};
+    std::FILE* file_{nullptr}; // fallback when POSIX I/O is unavailable
+};
+
+/**
+ * Class: PipeSink
+ * Purpose:
+ *  - Sink feeding the standard input of a child process (e.g., clang reading
+ *    IR from "-"), so IR never touches a temporary file.
+ * Inputs (ctor):
+ *  - command: Shell command to start (throws if it cannot be started)
+ * Outputs:
+ *  - close(): flushes, closes the pipe and returns the command's exit status
+ */
+class PipeSink final : public IrSink {
+public:
+    explicit PipeSink(const std::string& command);
+    ~PipeSink() override;
+    int close();
+
+protected:
+    void sinkWrite(const char* data, std::size_t n) override;
+
+private:
+    std::FILE* pipe_{nullptr};
+};
+
+/**
+ * Class: TeeSink
+ * Purpose:
+ *  - Fan one emission out to several sinks (e.g., the .ll file and a clang
+ *    pipe) so codegen runs once no matter how many outputs were requested.
+ */
+class TeeSink final : public IrSink {
+public:
+    explicit TeeSink(std::vector<IrSink*> targets) : targets_(std::move(targets)) {}
+    ~TeeSink() override = default;
+
+protected:
+    void sinkWrite(const char* data, std::size_t n) override {
+        for (IrSink* t : targets_) t->write(std::string_view(data, n));
+    }
+
+private:
+    std::vector<IrSink*> targets_;
+};
+
+} // namespace gwbasic
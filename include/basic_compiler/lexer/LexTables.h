@@ -0,0 +1,162 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "basic_compiler/token/TokenType.h"
+
+namespace gwbasic::lex {
+
+/**
+ * Operator/punctuation specification. Each row is a spelling and the token
+ * it produces; the byte-class and DFA tables below are derived from it at
+ * compile time, and the longest matching spelling wins (so "<>" beats "<").
+ * Adding an operator (e.g., "^") is a new TokenType plus a row here;
+ * word operators such as MOD belong in token/KeywordTable.h.
+ */
+struct OperatorSpec {
+    std::string_view text;
+    TokenType type;
+};
+
+inline constexpr OperatorSpec kOperators[] = {
+    {"+", TokenType::Plus},
+    {"-", TokenType::Minus},
+    {"*", TokenType::Star},
+    {"/", TokenType::Slash},
+    {"(", TokenType::LParen},
+    {")", TokenType::RParen},
+    {":", TokenType::Colon},
+    {",", TokenType::Comma},
+    {"=", TokenType::Assign},
+    {"<", TokenType::Less},
+    {">", TokenType::Greater},
+    {"<=", TokenType::LessEqual},
+    {"<>", TokenType::NotEqual},
+    {">=", TokenType::GreaterEqual},
+};
+
+/**
+ * Enum: Start
+ * Purpose:
+ *  - What a token beginning with a given byte is, so Lexer::next picks its
+ *    scanner with one table load instead of ctype calls and a branch chain.
+ * Members:
+ *  - Invalid: byte cannot start a token (LexError)
+ *  - Newline, Digit, Letter, Quote: dedicated scanners
+ *  - Operator: run the operator DFA
+ */
+enum class Start : std::uint8_t { Invalid, Newline, Digit, Letter, Quote, Operator };
+
+constexpr std::array<Start, 256> buildStartTable() {
+    std::array<Start, 256> t{};
+    t['\n'] = Start::Newline;
+    for (unsigned c = '0'; c <= '9'; ++c) t[c] = Start::Digit;
+    for (unsigned c = 'A'; c <= 'Z'; ++c) t[c] = t[c + ('a' - 'A')] = Start::Letter;
+    t['"'] = Start::Quote;
+    for (const auto& op : kOperators) t[static_cast<unsigned char>(op.text[0])] = Start::Operator;
+    return t;
+}
+
+/** Start class of every byte value (ASCII only; locale-independent). */
+inline constexpr std::array<Start, 256> kStart = buildStartTable();
+
+constexpr std::size_t operatorClassCount() {
+    std::array<bool, 256> seen{};
+    std::size_t n = 1; // class 0: byte not used by any operator
+    for (const auto& op : kOperators)
+        for (const char c : op.text)
+            if (!seen[static_cast<unsigned char>(c)]) { seen[static_cast<unsigned char>(c)] = true; ++n; }
+    return n;
+}
+
+constexpr std::size_t operatorStateBound() {
+    std::size_t n = 1; // state 0: start (never re-entered, doubles as "no transition")
+    for (const auto& op : kOperators) n += op.text.size();
+    return n;
+}
+
+/**
+ * Type: OperatorDfa
+ * Purpose:
+ *  - Compact DFA recognising every spelling in kOperators.
+ * Theory of operation:
+ *  - Bytes map to dense classes (only bytes used by some operator get a
+ *    class of their own), states are the nodes of the spelling trie, and
+ *    next[state][class] is the following state or 0 when the DFA is stuck.
+ *    accept[state] is 1 + the kOperators row ending there (0: none). The
+ *    scanner steps until stuck and keeps the last accepting state.
+ */
+struct OperatorDfa {
+    static constexpr std::size_t kClasses = operatorClassCount();
+    static constexpr std::size_t kMaxStates = operatorStateBound();
+
+    std::array<std::uint8_t, 256> byteClass{};
+    std::array<std::array<std::uint8_t, kClasses>, kMaxStates> next{};
+    std::array<std::uint8_t, kMaxStates> accept{};
+    std::size_t states{1};
+    bool duplicate{false};
+};
+
+constexpr OperatorDfa buildOperatorDfa() {
+    OperatorDfa d{};
+    std::uint8_t cls = 1;
+    for (const auto& op : kOperators)
+        for (const char c : op.text)
+            if (!d.byteClass[static_cast<unsigned char>(c)]) d.byteClass[static_cast<unsigned char>(c)] = cls++;
+    for (std::size_t i = 0; i < std::size(kOperators); ++i) {
+        std::size_t s = 0;
+        for (const char c : kOperators[i].text) {
+            const std::uint8_t k = d.byteClass[static_cast<unsigned char>(c)];
+            if (!d.next[s][k]) d.next[s][k] = static_cast<std::uint8_t>(d.states++);
+            s = d.next[s][k];
+        }
+        if (d.accept[s]) d.duplicate = true;
+        d.accept[s] = static_cast<std::uint8_t>(i + 1);
+    }
+    return d;
+}
+
+inline constexpr OperatorDfa kOperatorDfa = buildOperatorDfa();
+
+static_assert(OperatorDfa::kMaxStates <= 255 && std::size(kOperators) < 255, "operator DFA uses 8-bit states");
+static_assert(!kOperatorDfa.duplicate, "operator spelled twice in kOperators");
+
+constexpr bool operatorsStartCleanly() {
+    for (const auto& op : kOperators) {
+        if (op.text.empty()) return false;
+        const char c = op.text[0];
+        if ((c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '"' || c == '\n' ||
+            c == ' ' || c == '\t' || c == '\r' || c == '\'')
+            return false;
+    }
+    return true;
+}
+
+static_assert(operatorsStartCleanly(), "operator must not start like a number, word, string, blank or comment");
+
+/**
+ * Function: matchOperator
+ * Inputs:
+ *  - p/end: Source bytes starting at an Operator start byte
+ * Outputs:
+ *  - const OperatorSpec*: Longest spelling matching at p (length is
+ *    text.size()), or nullptr when no spelling matches
+ * Theory of operation:
+ *  - Table walk with a single exit test per byte; no per-operator branches.
+ */
+constexpr const OperatorSpec* matchOperator(const char* p, const char* end) {
+    std::size_t s = 0;
+    std::uint8_t best = 0;
+    for (; p < end; ++p) {
+        s = kOperatorDfa.next[s][kOperatorDfa.byteClass[static_cast<unsigned char>(*p)]];
+        if (!s) break;
+        if (kOperatorDfa.accept[s]) best = kOperatorDfa.accept[s];
+    }
+    return best ? &kOperators[best - 1] : nullptr;
+}
+
+} // namespace gwbasic::lex
@@ -0,0 +1,41 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+
+namespace gwbasic {
+
+/**
+ * Lexer run scanners.
+ *
+ * Purpose:
+ *  - Find the end of a run of same-class bytes (blanks, digits, identifier
+ *    characters, string body, comment) in one call, 16-32 bytes per step on
+ *    SSE2/AVX2/NEON (see lexer/Simd.h), scalar elsewhere.
+ *
+ * Inputs:
+ *  - p/end: Byte range to scan (end is one past the last readable byte).
+ *
+ * Outputs:
+ *  - Pointer to the first byte that ends the run, or end.
+ */
+
+/** scanBlanks: Skip ' ', '\t' and '\r'. */
+const char* scanBlanks(const char* p, const char* end);
+
+/** scanDigits: Skip '0'..'9'. */
+const char* scanDigits(const char* p, const char* end);
+
+/** scanIdentChars: Skip ASCII letters, digits and '_'. */
+const char* scanIdentChars(const char* p, const char* end);
+
+/** scanStringBody: Stop at the first '"' or '\\'. */
+const char* scanStringBody(const char* p, const char* end);
+
+/** scanLineEnd: Stop at the first '\n'. */
+const char* scanLineEnd(const char* p, const char* end);
+
+/** countNewlines: Number of '\n' bytes in [p, end). */
+std::size_t countNewlines(const char* p, const char* end);
+
+} // namespace gwbasic
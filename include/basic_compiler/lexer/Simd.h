@@ -0,0 +1,140 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GWBASIC_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GWBASIC_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define GWBASIC_SIMD_NEON 1
+#endif
+
+namespace gwbasic::simd {
+
+/**
+ * Type: Block / Mask
+ * Purpose:
+ *  - Portable byte-block primitives for the lexer's run scanners: load
+ *    kWidth source bytes, build per-byte predicates, and turn a predicate
+ *    into a bit mask whose lowest set bit is the first matching byte.
+ * Theory of operation:
+ *  - AVX2 (32 bytes) when the compiler targets it, SSE2 (16 bytes, always
+ *    present on x86_64), NEON (16 bytes, aarch64), otherwise one byte at a
+ *    time. NEON has no movemask, so its Mask keeps 4 bits per byte (the
+ *    shrn-by-4 trick); kBitsPerByte hides the difference from callers.
+ *  - Loads are unaligned and never cross the caller's end pointer; tails
+ *    shorter than kWidth go through the scalar predicate.
+ */
+#if defined(GWBASIC_SIMD_AVX2)
+using Block = __m256i;
+using Mask = std::uint32_t;
+inline constexpr std::size_t kWidth = 32;
+inline constexpr unsigned kBitsPerByte = 1;
+inline constexpr const char* kIsa = "avx2";
+
+inline Block load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+inline Block eq(Block v, char c) { return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)); }
+inline Block inRange(Block v, char lo, char hi) {
+    const Block t = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(static_cast<char>(hi - lo))), t);
+}
+inline Block lower(Block v) { return _mm256_or_si256(v, _mm256_set1_epi8(0x20)); }
+inline Block any(Block a, Block b) { return _mm256_or_si256(a, b); }
+inline Mask mask(Block v) { return static_cast<Mask>(_mm256_movemask_epi8(v)); }
+inline Mask invert(Mask m) { return ~m; }
+#elif defined(GWBASIC_SIMD_SSE2)
+using Block = __m128i;
+using Mask = std::uint32_t;
+inline constexpr std::size_t kWidth = 16;
+inline constexpr unsigned kBitsPerByte = 1;
+inline constexpr const char* kIsa = "sse2";
+
+inline Block load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+inline Block eq(Block v, char c) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+inline Block inRange(Block v, char lo, char hi) {
+    const Block t = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(static_cast<char>(hi - lo))), t);
+}
+inline Block lower(Block v) { return _mm_or_si128(v, _mm_set1_epi8(0x20)); }
+inline Block any(Block a, Block b) { return _mm_or_si128(a, b); }
+inline Mask mask(Block v) { return static_cast<Mask>(_mm_movemask_epi8(v)); }
+inline Mask invert(Mask m) { return ~m & 0xFFFFu; }
+#elif defined(GWBASIC_SIMD_NEON)
+using Block = uint8x16_t;
+using Mask = std::uint64_t;
+inline constexpr std::size_t kWidth = 16;
+inline constexpr unsigned kBitsPerByte = 4;
+inline constexpr const char* kIsa = "neon";
+
+inline Block load(const char* p) { return vld1q_u8(reinterpret_cast<const std::uint8_t*>(p)); }
+inline Block eq(Block v, char c) { return vceqq_u8(v, vdupq_n_u8(static_cast<std::uint8_t>(c))); }
+inline Block inRange(Block v, char lo, char hi) {
+    const Block t = vsubq_u8(v, vdupq_n_u8(static_cast<std::uint8_t>(lo)));
+    return vcleq_u8(t, vdupq_n_u8(static_cast<std::uint8_t>(hi - lo)));
+}
+inline Block lower(Block v) { return vorrq_u8(v, vdupq_n_u8(0x20)); }
+inline Block any(Block a, Block b) { return vorrq_u8(a, b); }
+inline Mask mask(Block v) {
+    const uint8x8_t nib = vshrn_n_u16(vreinterpretq_u16_u8(v), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nib), 0);
+}
+inline Mask invert(Mask m) { return ~m; }
+#else
+using Block = unsigned char;
+using Mask = std::uint32_t;
+inline constexpr std::size_t kWidth = 1;
+inline constexpr unsigned kBitsPerByte = 1;
+inline constexpr const char* kIsa = "scalar";
+
+inline Block load(const char* p) { return static_cast<unsigned char>(*p); }
+inline Block eq(Block v, char c) { return v == static_cast<unsigned char>(c) ? 0xFF : 0; }
+inline Block inRange(Block v, char lo, char hi) {
+    return static_cast<unsigned char>(v - static_cast<unsigned char>(lo)) <= static_cast<unsigned char>(hi - lo) ? 0xFF : 0;
+}
+inline Block lower(Block v) { return static_cast<Block>(v | 0x20); }
+inline Block any(Block a, Block b) { return static_cast<Block>(a | b); }
+inline Mask mask(Block v) { return v ? 1u : 0u; }
+inline Mask invert(Mask m) { return ~m & 1u; }
+#endif
+
+/** Index of the first flagged byte in a non-zero mask. */
+inline std::size_t firstIndex(Mask m) { return static_cast<std::size_t>(std::countr_zero(m)) / kBitsPerByte; }
+
+/** Number of flagged bytes in a mask. */
+inline std::size_t countFlagged(Mask m) { return static_cast<std::size_t>(std::popcount(m)) / kBitsPerByte; }
+
+/**
+ * Function: findFirst
+ * Inputs:
+ *  - p/end: Byte range to scan
+ *  - Class: Type with static `Block vec(Block)` and `bool byte(unsigned char)`
+ *    describing the byte class (vector and scalar forms must agree)
+ *  - Stop: true to stop at the first byte in the class, false to stop at
+ *    the first byte outside it
+ * Outputs:
+ *  - const char*: First stopping byte, or end
+ * Theory of operation:
+ *  - Whole blocks are classified kWidth bytes at a time; the first block
+ *    with a stopping byte yields its position from the mask. The tail is
+ *    finished with the scalar form.
+ */
+template <class Class, bool Stop>
+inline const char* findFirst(const char* p, const char* end) {
+    while (static_cast<std::size_t>(end - p) >= kWidth) {
+        Mask m = mask(Class::vec(load(p)));
+        if constexpr (!Stop) m = invert(m);
+        if (m) return p + firstIndex(m);
+        p += kWidth;
+    }
+    while (p < end && Class::byte(static_cast<unsigned char>(*p)) != Stop) ++p;
+    return p;
+}
+
+} // namespace gwbasic::simd
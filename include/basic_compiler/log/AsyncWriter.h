@@ -0,0 +1,80 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <thread>
+
+#include "basic_compiler/log/MpmcRing.h"
+
+namespace gwbasic::logging {
+
+/**
+ * Type: Batch
+ * Purpose:
+ *  - A block of complete log lines bound for one file, written with a
+ *    single call by the writer thread.
+ * Members:
+ *  - file: destination (owned by the submitting Channel)
+ *  - pending: the Channel's in-flight counter, decremented once written
+ *  - size/data: payload
+ */
+struct Batch {
+    static constexpr std::size_t kBytes = 64 * 1024;
+    std::ofstream* file{nullptr};
+    std::atomic<std::uint32_t>* pending{nullptr};
+    std::size_t size{0};
+    char data[kBytes];
+};
+
+/**
+ * Class: AsyncWriter
+ * Purpose:
+ *  - Process-wide background thread that performs all phase-log file I/O,
+ *    so compile threads only copy bytes into memory.
+ * Inputs:
+ *  - submit(): full batches from any thread (multi-producer)
+ * Outputs:
+ *  - Batches written in submission order per producer; Batch::pending
+ *    decremented after each write (waitFor() blocks until it reaches 0)
+ * Theory of operation:
+ *  - Producers take an empty Batch from a free ring (or allocate one), fill
+ *    it, and push it onto the lock-free full ring. The writer pops batches,
+ *    writes them, and recycles them. When the full ring is empty the writer
+ *    sleeps on an atomic counter that submit() bumps; when it is full the
+ *    producer yields (back-pressure bounds memory to kInFlight batches).
+ *  - Started on first use; the destructor drains the ring and joins.
+ */
+class AsyncWriter {
+public:
+    static constexpr std::size_t kInFlight = 64;
+
+    static AsyncWriter& instance();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+    ~AsyncWriter();
+
+    /** acquire: Empty batch for a producer to fill. */
+    Batch* acquire();
+    /** submit: Queue a filled batch (file/pending/size set) for writing. */
+    void submit(Batch* b);
+    /** waitFor: Block until every batch counted in pending has been written. */
+    void waitFor(const std::atomic<std::uint32_t>& pending);
+
+private:
+    AsyncWriter();
+    void run();
+    void recycle(Batch* b);
+
+    MpmcRing<Batch*, kInFlight> full_;
+    MpmcRing<Batch*, kInFlight> free_;
+    std::atomic<std::uint32_t> wake_{0};
+    std::atomic<std::uint32_t> written_{0}; // bumped after each batch; waitFor() sleeps on it
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+};
+
+} // namespace gwbasic::logging
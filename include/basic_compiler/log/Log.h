@@ -0,0 +1,222 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "basic_compiler/log/AsyncWriter.h"
+#include "basic_compiler/log/LogFormat.h"
+
+namespace gwbasic::logging {
+
+/**
+ * Enum: Level
+ * Purpose:
+ *  - Severity of a phase-log record.
+ * Members:
+ *  - Trace: per token / per emitted instruction
+ *  - Debug: per statement, line, or semantic event
+ *  - Info, Warn, Error: coarse progress and problems
+ *  - Off: threshold only; disables every record
+ */
+enum class Level : std::uint8_t { Trace, Debug, Info, Warn, Error, Off };
+
+// Minimum level compiled in (0=Trace .. 5=Off), set by the build
+// (BASIC_COMPILER_LOG_LEVEL). Records below it vanish at compile time.
+#ifndef GWBASIC_LOG_LEVEL
+#define GWBASIC_LOG_LEVEL 0
+#endif
+
+inline constexpr Level kCompiledLevel = static_cast<Level>(GWBASIC_LOG_LEVEL);
+
+/** compiledIn: True when records at level l survive the build-time threshold. */
+constexpr bool compiledIn(Level l) { return l >= kCompiledLevel && l != Level::Off; }
+
+/**
+ * Enum: Format
+ * Purpose:
+ *  - On-disk form of a channel: Text lines, or compact Binary records
+ *    (log/LogFormat.h) rendered back to the same text by
+ *    basic_compiler-logdump.
+ */
+enum class Format : std::uint8_t { Text, Binary };
+
+/**
+ * Type: Site
+ * Purpose:
+ *  - Identity of one GWBASIC_LOG call site (a static local in the macro).
+ *    Binary channels describe a site's constant text once per file and then
+ *    refer to it by id. Ids are assigned process-wide on first use.
+ */
+struct Site {
+    std::atomic<std::uint32_t> id{0};
+    std::uint32_t get();
+};
+
+template <class T>
+concept LogNumber = std::is_arithmetic_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>;
+
+/** Append one message fragment; numbers are formatted with to_chars. */
+inline void append(std::string& s, std::string_view v) { s.append(v); }
+inline void append(std::string& s, const char* v) { s.append(v); }
+inline void append(std::string& s, char c) { s.push_back(c); }
+template <LogNumber T>
+void append(std::string& s, T v) {
+    char tmp[32];
+    std::to_chars_result r;
+    if constexpr (std::is_floating_point_v<T>) r = std::to_chars(tmp, tmp + sizeof(tmp), static_cast<double>(v));
+    else r = std::to_chars(tmp, tmp + sizeof(tmp), v);
+    s.append(tmp, r.ptr);
+}
+
+/**
+ * describe/encode: Binary form of one fragment. String literals (char
+ * arrays) are constant text, described once per site; everything else is
+ * an argument slot whose value is encoded in each record. Both are
+ * templates so the array overload is always the more specialised match
+ * (a non-template const char* overload would win for literals).
+ */
+template <std::size_t N>
+void describe(std::string& s, const char (&lit)[N]) {
+    const std::string_view text(lit, std::strlen(lit));
+    s.push_back(wire::kLiteral);
+    wire::putVarint(s, text.size());
+    s.append(text);
+}
+template <class T>
+void describe(std::string& s, const T&) {
+    if constexpr (std::is_same_v<T, char>) s.push_back(wire::kChar);
+    else if constexpr (std::is_floating_point_v<T>) s.push_back(wire::kFloat);
+    else if constexpr (LogNumber<T> && std::is_signed_v<T>) s.push_back(wire::kSigned);
+    else if constexpr (LogNumber<T>) s.push_back(wire::kUnsigned);
+    else s.push_back(wire::kString);
+}
+
+template <std::size_t N>
+void encode(std::string&, const char (&)[N], wire::StringCache&, std::string&) {}
+template <class T>
+void encode(std::string& s, const T& v, wire::StringCache& c, std::string& prev) {
+    if constexpr (std::is_same_v<T, char>) {
+        s.push_back(v);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        std::uint64_t bits = std::bit_cast<std::uint64_t>(static_cast<double>(v));
+        for (int i = 0; i < 8; ++i, bits >>= 8) s.push_back(static_cast<char>(bits & 0xFF));
+    } else if constexpr (LogNumber<T> && std::is_signed_v<T>) {
+        wire::putVarint(s, wire::zigzag(v));
+    } else if constexpr (LogNumber<T>) {
+        wire::putVarint(s, v);
+    } else {
+        wire::putString(s, std::string_view(v), c, prev);
+    }
+}
+
+/**
+ * Class: Channel
+ * Purpose:
+ *  - One phase log (lex, syntax, semantic, codegen): a destination file plus
+ *    a runtime threshold.
+ * Inputs:
+ *  - open(): path (truncated), runtime threshold and Format
+ *  - write(): call site and message fragments, concatenated into one line
+ * Outputs:
+ *  - Lines appended to the file, in write() order
+ * Theory of operation:
+ *  - Callers go through GWBASIC_LOG, which tests the compile-time level and
+ *    then enabled() before evaluating any fragment, so a disabled record
+ *    costs one predictable branch (nothing at all when compiled out).
+ *    Enabled records are assembled in a reused buffer, never a stream.
+ *  - Lines are copied into a 64 KiB Batch; full batches go to the shared
+ *    AsyncWriter thread, so the compile thread never blocks on file I/O.
+ *    flush()/close() hand over the partial batch and wait until every
+ *    batch of this channel is written. A Channel is used by one thread at
+ *    a time; different channels may log from different threads.
+ */
+class Channel {
+public:
+    Channel() = default;
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+    ~Channel() { close(); }
+
+    /** Open (truncate) path; returns false and stays disabled on failure. */
+    bool open(const std::string& path, Level threshold = Level::Trace, Format format = Format::Text);
+    /** Write everything logged so far to the file and wait for it. */
+    void flush();
+    void close();
+
+    bool enabled(Level l) const { return l >= threshold_; }
+
+    template <class... Parts>
+    void write(Site& site, const Parts&... parts) {
+        line_.clear();
+        if (format_ == Format::Text) {
+            (append(line_, parts), ...);
+            line_.push_back('\n');
+        } else {
+            const std::uint32_t id = site.get();
+            if (!defined(id)) {
+                wire::putVarint(line_, 0);
+                wire::putVarint(line_, id);
+                wire::putVarint(line_, sizeof...(Parts));
+                (describe(line_, parts), ...);
+            }
+            wire::putVarint(line_, id);
+            std::string* prev = previous(id, sizeof...(Parts));
+            (encode(line_, parts, *cache_, *prev++), ...);
+        }
+        commit(line_);
+    }
+
+private:
+    /** commit: Copy one formatted line into the current batch. */
+    void commit(std::string_view line);
+    /** submitBatch: Hand the current batch (if any) to the writer thread. */
+    void submitBatch();
+    /** defined: Whether site id was described in this file; marks it so. */
+    bool defined(std::uint32_t id);
+    /** previous: Last value of each of site id's parts (string delta base). */
+    std::string* previous(std::uint32_t id, std::size_t parts);
+
+    std::ofstream file_;
+    Level threshold_{Level::Off};
+    Format format_{Format::Text};
+    std::string line_;
+    std::vector<std::uint8_t> sitesDefined_; // by site id (binary)
+    std::vector<std::vector<std::string>> sitePrevious_; // by site id, then part (binary)
+    std::unique_ptr<wire::StringCache> cache_; // binary only
+    Batch* batch_{nullptr};
+    std::atomic<std::uint32_t> pending_{0};
+};
+
+} // namespace gwbasic::logging
+
+/**
+ * Macro: GWBASIC_LOG(channel, level, parts...)
+ * Purpose:
+ *  - Write one record built from parts to channel at the given Level member
+ *    (Trace, Debug, ...). parts are evaluated only when the record is both
+ *    compiled in and enabled at runtime.
+ */
+#define GWBASIC_LOG(channel, level, ...)                                                        \
+    do {                                                                                        \
+        if constexpr (::gwbasic::logging::compiledIn(::gwbasic::logging::Level::level)) {       \
+            if ((channel).enabled(::gwbasic::logging::Level::level)) {                          \
+                static ::gwbasic::logging::Site gwbasicLogSite_;                                \
+                (channel).write(gwbasicLogSite_, __VA_ARGS__);                                  \
+            }                                                                                   \
+        }                                                                                       \
+    } while (0)
+
+/** Macro: GWBASIC_LOG_ENABLED(channel, level) — guard for records built by a helper. */
+#define GWBASIC_LOG_ENABLED(channel, level)                                   \
+    (::gwbasic::logging::compiledIn(::gwbasic::logging::Level::level) &&      \
+     (channel).enabled(::gwbasic::logging::Level::level))
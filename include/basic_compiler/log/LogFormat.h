@@ -0,0 +1,148 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gwbasic {
+class IrSink;
+}
+
+namespace gwbasic::logging::wire {
+
+/**
+ * Binary phase-log format (logging::Format::Binary)
+ *
+ *  file    := kMagic record*
+ *  record  := varint 0 siteDef | varint siteId payload
+ *  siteDef := varint siteId varint partCount part*
+ *  part    := 'L' varint len bytes      constant text (string literal)
+ *           | 'i' | 'u' | 'c' | 'f' | 's'  argument slot (signed, unsigned,
+ *                                         char, double, string)
+ *  payload := one value per argument slot, in order:
+ *             i: zigzag varint   u: varint   c: 1 byte   f: 8 bytes (LE)
+ *             s: varint (slot << 1)              same text as cache slot
+ *              | varint (midLen << 1 | 1) varint prefix varint suffix mid
+ *                  previous value of this site argument with its middle
+ *                  replaced: prev[0, prefix) + mid + prev[size - suffix, size)
+ *
+ * A site is one GWBASIC_LOG call; its constant text is written once per
+ * file, so a record is just the site id, varint positions/line numbers and
+ * strings. Repeated strings (names, token types) collapse to a cache slot;
+ * other strings are sent as a delta against the same argument's previous
+ * value, which turns successive IR lines from one call site
+ * ("%t1 = load double, ptr %A" then "%t5 = load ...") into a few bytes.
+ * Only strings up to kCacheMaxLen bytes are cached: long ones (IR text)
+ * rarely repeat exactly and are not worth hashing.
+ * The string cache is direct-mapped (kCacheSlots entries, FNV-1a) and,
+ * like the per-argument previous values, mirrored exactly by the decoder,
+ * so memory stays bounded on both sides. Rendering a record concatenates
+ * its parts as the text format does and appends '\n'.
+ */
+inline constexpr char kMagic[8] = {'G', 'W', 'B', 'L', 'O', 'G', '\x01', '\n'};
+inline constexpr std::size_t kCacheSlots = 4096;
+inline constexpr std::size_t kCacheMaxLen = 32; // longer strings are always delta-coded
+
+enum PartCode : char {
+    kLiteral = 'L',
+    kSigned = 'i',
+    kUnsigned = 'u',
+    kChar = 'c',
+    kFloat = 'f',
+    kString = 's',
+};
+
+inline void putVarint(std::string& out, std::uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<char>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<char>(v));
+}
+
+/** getVarint: Decode at p (advanced past it); false on truncated/overlong input. */
+inline bool getVarint(const char*& p, const char* end, std::uint64_t& v) {
+    v = 0;
+    for (unsigned shift = 0; p < end && shift < 64; shift += 7) {
+        const auto b = static_cast<unsigned char>(*p++);
+        v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+constexpr std::uint64_t zigzag(std::int64_t v) {
+    return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63);
+}
+constexpr std::int64_t unzigzag(std::uint64_t v) {
+    return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+}
+
+/**
+ * Class: StringCache
+ * Purpose:
+ *  - Direct-mapped table of recently seen strings shared (by construction)
+ *    between the encoder of a channel and the decoder of its file.
+ */
+class StringCache {
+public:
+    StringCache() : slots_(kCacheSlots) {}
+
+    static std::size_t slotOf(std::string_view s) {
+        std::uint32_t h = 2166136261u;
+        for (const char c : s) h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+        return h & (kCacheSlots - 1);
+    }
+    bool holds(std::size_t slot, std::string_view s) const { return slots_[slot] == s; }
+    void store(std::size_t slot, std::string_view s) { slots_[slot].assign(s); }
+    const std::string& at(std::size_t slot) const { return slots_[slot]; }
+
+private:
+    std::vector<std::string> slots_;
+};
+
+/**
+ * putString: Encode s as a cache reference, or as a delta against prev (the
+ * argument's previous value) and cache it. prev becomes s either way.
+ */
+inline void putString(std::string& out, std::string_view s, StringCache& cache, std::string& prev) {
+    const bool cacheable = s.size() <= kCacheMaxLen;
+    const std::size_t slot = cacheable ? StringCache::slotOf(s) : 0;
+    if (cacheable && cache.holds(slot, s)) {
+        putVarint(out, static_cast<std::uint64_t>(slot) << 1);
+    } else {
+        const std::size_t limit = std::min(prev.size(), s.size());
+        std::size_t pre = 0;
+        while (pre < limit && prev[pre] == s[pre]) ++pre;
+        std::size_t suf = 0;
+        while (suf < limit - pre && prev[prev.size() - 1 - suf] == s[s.size() - 1 - suf]) ++suf;
+        const std::string_view mid = s.substr(pre, s.size() - pre - suf);
+        putVarint(out, (static_cast<std::uint64_t>(mid.size()) << 1) | 1);
+        putVarint(out, pre);
+        putVarint(out, suf);
+        out.append(mid);
+        if (cacheable) cache.store(slot, s);
+    }
+    prev.assign(s);
+}
+
+/**
+ * Function: decodeLog
+ * Inputs:
+ *  - data: contents of a binary phase log (starting with kMagic)
+ *  - out: destination for the rendered text lines
+ * Outputs:
+ *  - void (throws std::runtime_error on malformed input)
+ */
+void decodeLog(std::string_view data, IrSink& out);
+
+/** isBinaryLog: True when data starts with kMagic. */
+inline bool isBinaryLog(std::string_view data) {
+    return data.substr(0, sizeof(kMagic)) == std::string_view(kMagic, sizeof(kMagic));
+}
+
+} // namespace gwbasic::logging::wire
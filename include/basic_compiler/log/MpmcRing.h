@@ -0,0 +1,88 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace gwbasic::logging {
+
+/**
+ * Class: MpmcRing<T, N>
+ * Purpose:
+ *  - Bounded lock-free multi-producer/multi-consumer FIFO used to pass log
+ *    batches between compile threads and the writer thread.
+ * Inputs:
+ *  - tryPush(v): enqueue; false when the ring is full
+ * Outputs:
+ *  - tryPop(v): dequeue into v; false when the ring is empty
+ * Theory of operation:
+ *  - Vyukov's bounded queue: each cell carries a sequence number telling
+ *    whether it is free for the producer at a given ticket or holds data for
+ *    the consumer at that ticket. Producers and consumers claim tickets with
+ *    a CAS on their own counter, so there is no lock and no shared write
+ *    between the two sides except the cell itself. N must be a power of two.
+ */
+template <class T, std::size_t N>
+class MpmcRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "MpmcRing size must be a power of two");
+
+public:
+    MpmcRing() {
+        for (std::size_t i = 0; i < N; ++i) cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+
+    bool tryPush(const T& v) {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& c = cells_[pos & (N - 1)];
+            const std::size_t seq = c.seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    c.value = v;
+                    c.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPop(T& v) {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& c = cells_[pos & (N - 1)];
+            const std::size_t seq = c.seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    v = c.value;
+                    c.seq.store(pos + N, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t kLine = 64;
+    struct Cell {
+        std::atomic<std::size_t> seq;
+        T value{};
+    };
+    std::array<Cell, N> cells_;
+    alignas(kLine) std::atomic<std::size_t> tail_{0};
+    alignas(kLine) std::atomic<std::size_t> head_{0};
+};
+
+} // namespace gwbasic::logging
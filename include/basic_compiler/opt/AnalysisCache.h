@@ -0,0 +1,56 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "basic_compiler/ast/Program.h"
+#include "basic_compiler/cfg/ControlFlowGraph.h"
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+/**
+ * Type: AnalysisCache
+ * Purpose:
+ *  - Analyses that several optimizer passes share, kept in the program's
+ *    arena (AstArena::analyses) so a pass that only rewrites expressions
+ *    does not make the next one rebuild them.
+ * Members:
+ *  - shape: what the analyses depend on (shapeOf); any pass that changes
+ *    statements builds new nodes or lists, so the shape differs and the
+ *    next user rebuilds (AstOptimizer::analyze)
+ *  - symbols: the program's symbol table (for varOf)
+ *  - cfg, rd: graph and reaching definitions of the program
+ *  - constants: per definition of rd, the constant it stores (Known), none
+ *    (Varies), or nothing yet (Unknown: never reached by any value)
+ *  - users: per definition, the Joins and assignments that read it
+ * Theory of operation:
+ *  - Rewriting an expression keeps its value, so every fact here stays
+ *    true while the shape is unchanged. rd adds a variable's Entry
+ *    definition when a read first needs it; constants and users grow with
+ *    it (AstOptimizer::solveConstants).
+ */
+struct AnalysisCache {
+    struct Constant {
+        enum class State : std::uint8_t { Unknown, Known, Varies };
+        State state{State::Unknown};
+        double value{0.0};
+    };
+
+    std::vector<std::uintptr_t> shape;
+    const SymbolTable* symbols{nullptr};
+    ControlFlowGraph cfg;
+    ReachingDefinitions rd;
+    std::vector<Constant> constants;
+    std::vector<std::vector<int>> users;
+
+    /**
+     * shapeOf: The program's lines (address of the line array and each
+     * number), every statement node, every FOR body statement and every
+     * jump target, in order.
+     */
+    static std::vector<std::uintptr_t> shapeOf(const Program& program);
+};
+
+} // namespace gwbasic
@@ -1,11 +1,22 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <memory>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <vector>
+
 #include "basic_compiler/ast/Program.h"
+#include "basic_compiler/opt/Specialization.h"
 
 namespace gwbasic {
 
+class BitSet;
+class ControlFlowGraph;
+struct AnalysisCache;
+struct ValueTable;
+
 /**
  * Type: AstOptimizer
  * Purpose:
@@ -17,8 +28,28 @@ namespace gwbasic {
  *  - Algebraic identities (x+0, 0+x, x-0, x*1, 1*x, x/1, x*0 -> 0)
  *  - IF with constant condition -> replace with GOTO or remove
  *  - STEP 1.0 in FOR -> null step (use a default path in codegen)
+ *  - Lines unreachable from the first line (ControlFlowGraph) -> removed
+ *  - Loop-invariant expressions in FOR bodies -> computed once before the
+ *    loop into a compiler temporary
+ *  - Across statements and lines (cfg/Dataflow.h): reads of variables
+ *    whose reaching definitions all store one constant or copy another
+ *    variable -> the constant or that variable; repeated computations in
+ *    a basic block -> one computation (value numbering); assignments to
+ *    variables that are never read afterwards (liveness) -> removed
+ *  - FOR loops with literal limits -> unrolled fully, or by 4/8 with the
+ *    remaining iterations unrolled after the loop (code-size budget)
+ *  - FOR loops whose body only accumulates (X = X + c, X = X * c, ...)
+ *    or whose trip count is a known constant -> closed-form assignments
+ *  - Programs (or their prefixes up to the first INPUT) that run without
+ *    input -> the text they print, computed at compile time
+ *  - INPUT of a variable given a value with --specialize -> an
+ *    assignment of that value, which the other passes then fold
  * Theory of operation:
- *  - The optimizer walks statements and expressions, rewriting in place.
+ *  - Each pass walks statements and expressions, rewriting in place, and
+ *    reports whether it changed anything so PassManager can iterate the
+ *    pipeline to a fixpoint.
+ *    Replacement nodes come from the Program's arena; nodes that become
+ *    unreachable simply stay there until the Program is released.
  *    Expression-level rules are defined in a separate translation unit
  *    from statement-level rules for clarity and maintainability.
  */
@@ -36,6 +67,121 @@ public:
      */
     static auto optimize(Program &program) -> void;
 
+    /**
+     * Method: simplifyStatements
+     * Purpose:
+     *  - Expression folding/identities in every statement, constant IF
+     *    reduction and FOR step canonicalization (one pass over the AST).
+     * Outputs:
+     *  - bool: true when anything was rewritten
+     */
+    static bool simplifyStatements(Program& program);
+
+    /**
+     * Method: removeDeadLines
+     * Purpose:
+     *  - Drop lines unreachable from the first line (ControlFlowGraph).
+     * Outputs:
+     *  - bool: true when a line was removed
+     */
+    static bool removeDeadLines(Program& program);
+
+    /**
+     * Method: hoistLoopInvariants
+     * Purpose:
+     *  - Loop-invariant code motion: move Single/Double subexpressions of a
+     *    FOR body that read nothing the loop assigns into assignments to
+     *    fresh temporaries placed just before the FOR.
+     * Outputs:
+     *  - bool: true when an expression was hoisted
+     */
+    static bool hoistLoopInvariants(Program& program);
+
+    /**
+     * Method: propagateConstants
+     * Purpose:
+     *  - Replace a variable read by a literal when every definition
+     *    reaching it (ReachingDefinitions) stores the same constant,
+     *    including the zero a variable starts with, then refold.
+     * Outputs:
+     *  - bool: true when a read was replaced
+     */
+    static bool propagateConstants(Program& program);
+
+    /**
+     * Method: propagateCopies
+     * Purpose:
+     *  - Replace a read of `v` by `w` when the copy `v = w` (same type) is
+     *    available there (AvailableCopies).
+     * Outputs:
+     *  - bool: true when a read was replaced
+     */
+    static bool propagateCopies(Program& program);
+
+    /**
+     * Method: eliminateCommonSubexpressions
+     * Purpose:
+     *  - Local value numbering per basic block: a Single/Double operation
+     *    computed earlier in the block is reused from the variable it was
+     *    assigned to, or from a temporary placed before its first use.
+     * Outputs:
+     *  - bool: true when a computation was reused
+     */
+    static bool eliminateCommonSubexpressions(Program& program);
+
+    /**
+     * Method: removeDeadStores
+     * Purpose:
+     *  - Drop assignments (including ones in FOR bodies) whose value no
+     *    later statement can read (Liveness).
+     * Outputs:
+     *  - bool: true when a statement was removed
+     */
+    static bool removeDeadStores(Program& program);
+
+    /**
+     * Method: closeRecurrences
+     * Purpose:
+     *  - Replace a FOR whose body only updates variables by recurrences
+     *    with a known final value (closeLoop) by assignments of those
+     *    final values and of the loop variable's exit value.
+     * Outputs:
+     *  - bool: true when a loop was replaced
+     */
+    static bool closeRecurrences(Program& program);
+
+    /**
+     * Method: unrollLoops
+     * Purpose:
+     *  - Unroll FOR loops with a known trip count (unrollLoop) while the
+     *    body nodes added per loop stay within `threshold`.
+     * Outputs:
+     *  - bool: true when a loop was unrolled
+     */
+    static bool unrollLoops(Program& program, int threshold);
+
+    /**
+     * Method: evaluateProgram
+     * Purpose:
+     *  - Interpret the program from its first line for at most `steps`
+     *    statements and replace the part that ran without input by one
+     *    PRINT of its output (plus the variables' values when it stopped
+     *    early).
+     * Outputs:
+     *  - bool: true when the program was rewritten
+     */
+    static bool evaluateProgram(Program& program, std::int64_t steps);
+
+    /**
+     * Method: specializeInputs
+     * Purpose:
+     *  - Replace every INPUT of a specialized variable by an assignment of
+     *    its fixed value.
+     * Outputs:
+     *  - bool: true when an INPUT was replaced
+     */
+    static bool specializeInputs(Program& program, std::span<const Specialization> values);
+
 private:
     /**
      * Method: optExpr
@@ -44,11 +190,13 @@ private:
      *    identities. Eliminates unary plus and folds unary minus for
      *    numeric literals.
      * Inputs:
-     *  - e: Owned expression to simplify (may be null)
+     *  - arena: Program arena for any replacement nodes
+     *  - e: Expression to simplify (may be null)
+     *  - changed: set to true when any node is replaced
      * Outputs:
      *  - Returns simplified expression, possibly a new node.
      */
-    static std::unique_ptr<Expr> optExpr(std::unique_ptr<Expr> e);
+    static AstRef<Expr> optExpr(AstArena& arena, AstRef<Expr> e, bool& changed);
 
     /** Determine whether the expression equals numeric 0.0. */
     static bool isZero(const Expr* e);
@@ -58,6 +206,182 @@ private:
 
     /** Extract numeric value if `e` is a NumberExpr; returns success. */
     static bool asNumber(const Expr* e, double& out);
+
+    /** Value of NumberExpr `e` as an operand computed in `want`; returns success. */
+    static bool numberIn(const Expr* e, NumType want, double& out);
+
+    /** Literal holding `v` with `like`'s type and flexibility (nullptr if not finite). */
+    static AstRef<Expr> makeNumber(AstArena& arena, double v, const Expr& like);
+
+    /** Convert `v` to computation type `to` as the IR does; false when that is undefined (fptosi overflow). */
+    static bool convert(double v, NumType to, double& out);
+
+    /** Value a variable of `type` holds after storing `v` (wrapped to 16 bits for Int). */
+    static double storedValue(double v, NumType type);
+
+    /**
+     * Method: analyze
+     * Purpose:
+     *  - The analyses propagateConstants and closeRecurrences share
+     *    (AstArena::analyses), rebuilt and solved first when the program's
+     *    statements changed since they were made (AnalysisCache::shapeOf).
+     */
+    static AnalysisCache& analyze(Program& program);
+
+    /** Give every definition added to `facts.rd` since the last call its constant, to a fixpoint. */
+    static void solveConstants(AnalysisCache& facts);
+
+    /** Constant `var` holds at `st` (after its own definitions when `after`), as stored; false when none. */
+    static bool constantAt(AnalysisCache& facts, const Stmt& st, SymbolId var, bool after, double& out);
+
+    /** Value of a variable read for evaluate; false when unknown. */
+    using ValueLookup = std::function<bool(const VarExpr&, double& out)>;
+
+    /**
+     * Method: evaluate
+     * Purpose:
+     *  - Compute `e` in `want` exactly as the generated code would.
+     * Inputs:
+     *  - e: Expression (may be null)
+     *  - want: Type the value is needed in
+     *  - valueOf: Values of the variables read
+     *  - out: Receives the result
+     * Outputs:
+     *  - bool: false when a read is unknown or the result is undefined
+     */
+    static bool evaluate(const Expr* e, NumType want, const ValueLookup& valueOf, double& out);
+
+    /** Deep copy of `e` (nullptr for nullptr). */
+    static AstRef<Expr> cloneExpr(AstArena& arena, const Expr* e);
+
+    /**
+     * Type: LoopTrips
+     * Purpose:
+     *  - How a FOR with literal limits runs (constantTrips): its trip
+     *    count, the counter value of each iteration and its exit value.
+     * Members:
+     *  - counted: CodeGenerator's counted (i64) loop; values follow from
+     *    first and step, otherwise they are listed in values
+     */
+    struct LoopTrips {
+        NumType type{NumType::Double};
+        bool counted{false};
+        std::int64_t count{0};
+        double first{0.0};
+        double step{1.0};
+        std::vector<double> values;
+        double exit{0.0};
+
+        /** at: Counter value during iteration k (0-based), as the variable holds it. */
+        double at(std::int64_t k) const {
+            if (!counted) return values[static_cast<std::size_t>(k)];
+            const std::int64_t v = static_cast<std::int64_t>(first) + k * static_cast<std::int64_t>(step);
+            if (type == NumType::Int) return static_cast<std::int16_t>(static_cast<std::uint16_t>(v));
+            if (type == NumType::Single) return static_cast<float>(v);
+            return static_cast<double>(v);
+        }
+    };
+
+    /** Whether `fs` compiles to the counted loop (CodeGenerator::countedLoopStep, body aside); sets `step`. */
+    static bool countedShape(const ForStmt& fs, double& step);
+
+    /** Trip count and counter values of a FOR with literal start, end and step; false otherwise. */
+    static bool constantTrips(const ForStmt& fs, LoopTrips& out);
+
+    /**
+     * Method: closeLoop
+     * Purpose:
+     *  - Compute the statements that leave the same values as a FOR loop
+     *    (see closeRecurrences).
+     * Inputs:
+     *  - arena: Program arena for the new statements
+     *  - fs: The loop
+     *  - before: Constant values of variables right before the loop
+     *  - out: Receives the replacement statements on success
+     * Outputs:
+     *  - bool: false when some body variable has no closed form
+     */
+    static bool closeLoop(AstArena& arena, const ForStmt& fs, const ValueLookup& before,
+                          std::vector<AstRef<Stmt>>& out);
+
+    /**
+     * Method: unrollLoop
+     * Purpose:
+     *  - Compute the unrolled replacement of one FOR (see unrollLoops).
+     * Inputs:
+     *  - arena: Program arena for the new statements
+     *  - fs: The loop
+     *  - threshold: Expression and statement nodes the copies may add
+     *  - out: Receives the replacement statements on success
+     * Outputs:
+     *  - bool: false when the loop stays as it is
+     */
+    static bool unrollLoop(AstArena& arena, ForStmt& fs, int threshold, std::vector<AstRef<Stmt>>& out);
+
+    /** Fold a binary operation on two literals as the generated code would compute it. */
+    static AstRef<Expr> foldBinary(AstArena& arena, const BinaryExpr& b);
+
+    /** Intern a fresh temporary `prefix<n>` whose name carries `type`. */
+    static Symbol makeTemp(AstArena& arena, std::string_view prefix, NumType type);
+
+    /**
+     * Method: replaceVars
+     * Purpose:
+     *  - Substitute variable reads in an expression tree.
+     * Inputs:
+     *  - e: Expression (may be null)
+     *  - with: Replacement for a VarExpr, or nullptr to keep it
+     *  - changed: set when a read is replaced
+     * Outputs:
+     *  - Returns `e` or its replacement.
+     */
+    static AstRef<Expr> replaceVars(AstRef<Expr> e, const std::function<AstRef<Expr>(const VarExpr&)>& with,
+                                    bool& changed);
+
+    /** Replacement for a variable read given the facts holding there (nullptr keeps it). */
+    using ReadRewriter = std::function<AstRef<Expr>(const VarExpr&, const BitSet& facts)>;
+
+    /**
+     * Method: rewriteReads
+     * Purpose:
+     *  - Offer every variable read of the program's reachable statements to
+     *    `with` together with the facts of a forward analysis at that read;
+     *    refold the expressions it rewrites.
+     * Inputs:
+     *  - program, cfg: Program and its graph
+     *  - in, transfer: The analysis' block entry sets and transfer function
+     *  - with: see ReadRewriter
+     * Outputs:
+     *  - bool: true when a read was replaced
+     */
+    static bool rewriteReads(Program& program, const ControlFlowGraph& cfg,
+                             const std::function<const BitSet&(int leader)>& in,
+                             const std::function<void(const Stmt&, BitSet&)>& transfer, const ReadRewriter& with);
+
+    /** Value-number `slot`'s tree bottom-up, registering first occurrences in `table`. */
+    static int valueNumber(AstRef<Expr>& slot, ValueTable& table);
+
+    /** Replace the topmost subtrees of `slot` that `table` has seen computed earlier. */
+    static void reuseValues(AstArena& arena, AstRef<Expr>& slot, ValueTable& table, bool& changed);
+
+    /** Determine whether `e` reads any of the named variables. */
+    static bool readsAny(const Expr* e, std::span<const std::string_view> names);
+
+    /**
+     * Method: hoistExpr
+     * Purpose:
+     *  - Replace the maximal invariant subtrees of `e` (see
+     *    hoistLoopInvariants) with temporaries.
+     * Inputs:
+     *  - arena: Program arena for temporaries and their assignments
+     *  - e: Body expression
+     *  - variant: names the loop assigns (its variable and body targets)
+     *  - hoisted: receives one AssignStmt per temporary, in order
+     * Outputs:
+     *  - Returns `e`, or the temporary that replaces it.
+     */
+    static AstRef<Expr> hoistExpr(AstArena& arena, AstRef<Expr> e, std::span<const std::string_view> variant,
+                                  std::vector<AstRef<Stmt>>& hoisted);
 };
 
 } // namespace gwbasic
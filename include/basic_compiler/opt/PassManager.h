@@ -0,0 +1,119 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "basic_compiler/ast/Program.h"
+#include "basic_compiler/opt/Specialization.h"
+
+namespace gwbasic {
+
+/**
+ * Enum: OptLevel
+ * Purpose:
+ *  - Optimization level chosen with -O0/-O1/-O2/-O3/-Os. Selects the AST
+ *    pass pipeline and is forwarded to clang for the backend.
+ */
+enum class OptLevel : std::uint8_t { O0, O1, O2, O3, Os };
+
+/**
+ * Type: OptOptions
+ * Purpose:
+ *  - Settings of the AST pass pipeline: the -O level and the knobs that
+ *    override its defaults. A bare OptLevel converts to these defaults.
+ * Members:
+ *  - level: -O level
+ *  - unrollThreshold: node budget per unrolled loop (--unroll-threshold);
+ *    negative selects the level's default, 0 disables unrolling
+ *  - specializations: INPUT values fixed at compile time (--specialize);
+ *    applied at every level, -O0 included
+ */
+struct OptOptions {
+    OptLevel level{OptLevel::O0};
+    int unrollThreshold{-1};
+    std::vector<Specialization> specializations;
+
+    OptOptions() = default;
+    OptOptions(OptLevel l) : level(l) {} // NOLINT(google-explicit-constructor)
+};
+
+/** effectiveUnrollThreshold: The unroll budget options select (0 at -O0, -O1 and -Os by default). */
+int effectiveUnrollThreshold(const OptOptions& options);
+
+/** parseOptLevel: Map "-O0".."-O3"/"-Os" to a level; false for anything else. */
+bool parseOptLevel(std::string_view flag, OptLevel& out);
+
+/** optLevelFlag: The clang flag for a level ("-O2"). */
+const char* optLevelFlag(OptLevel level);
+
+/**
+ * Type: PassStats
+ * Purpose:
+ *  - What one PassManager::run did: per pass, how often it ran, how often
+ *    it changed the program and the time it took; the number of rounds and
+ *    whether the pipeline reached a fixpoint within its round limit.
+ */
+struct PassStats {
+    struct Pass {
+        std::string_view name;
+        int runs{0};
+        int changes{0};
+        double ms{0.0};
+    };
+    std::vector<Pass> passes;
+    int rounds{0};
+    bool converged{true};
+
+    /** print: One line per pass plus a summary line. */
+    void print(std::ostream& os) const;
+};
+
+/**
+ * Class: PassManager
+ * Purpose:
+ *  - Run an ordered pipeline of AST passes over a Program before codegen.
+ * Inputs:
+ *  - options: select the pipeline (forLevel); add() appends custom passes
+ * Outputs:
+ *  - run(): the rewritten Program (in place) and PassStats
+ * Theory of operation:
+ *  - A pass is a callable bool(Program&) that rewrites in place and returns
+ *    whether it changed anything. run() executes the pipeline in order,
+ *    round after round, until a whole round changes nothing or the round
+ *    limit is hit (one pass enabling another, e.g. a folded IF making lines
+ *    dead, is picked up by the next round).
+ *  - -O0 runs nothing but specialize-inputs; -O1 runs the pipeline once;
+ *    -O2, -O3 and -Os iterate up to kMaxRounds.
+ */
+class PassManager {
+public:
+    using Pass = std::function<bool(Program&)>;
+    static constexpr int kMaxRounds = 8;
+    static constexpr std::int64_t kEvaluationSteps = 1000000; // evaluate-program's statement budget
+
+    PassManager() = default;
+    /** forLevel: The standard pipeline for an optimization level and its options. */
+    static PassManager forLevel(const OptOptions& options);
+
+    /** add: Append a pass; name must outlive the manager (a literal). */
+    void add(std::string_view name, Pass pass) { passes_.push_back({name, std::move(pass)}); }
+    void setMaxRounds(int rounds) { maxRounds_ = rounds; }
+    bool empty() const { return passes_.empty(); }
+
+    /** run: Execute the pipeline on program until it stops changing. */
+    PassStats run(Program& program) const;
+
+private:
+    struct Entry {
+        std::string_view name;
+        Pass pass;
+    };
+    std::vector<Entry> passes_;
+    int maxRounds_{kMaxRounds};
+};
+
+} // namespace gwbasic
@@ -0,0 +1,30 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace gwbasic {
+
+/**
+ * Type: Specialization
+ * Purpose:
+ *  - A value fixed at compile time for a variable the program reads with
+ *    INPUT (--specialize VAR=value).
+ * Members:
+ *  - name: canonical variable name ("N", "N%", "N!"; a '#' suffix is
+ *    dropped, as Parser::internVar does for Double)
+ *  - value: what every INPUT of that variable reads
+ */
+struct Specialization {
+    std::string name;
+    double value{0.0};
+};
+
+/**
+ * parseSpecialization: Parse "VAR=value" (a letter, letters or digits, an
+ * optional % ! # suffix, then a finite number); false when malformed.
+ */
+bool parseSpecialization(std::string_view text, Specialization& out);
+
+} // namespace gwbasic
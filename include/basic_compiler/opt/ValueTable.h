@@ -0,0 +1,91 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "basic_compiler/ast/Program.h"
+
+namespace gwbasic {
+
+/**
+ * Type: ValueTable
+ * Purpose:
+ *  - State of local value numbering over one basic block, shared by
+ *    AstOptimizer::valueNumber, reuseValues and
+ *    eliminateCommonSubexpressions.
+ * Members:
+ *  - vars: value number each variable holds at the current statement
+ *  - literals/ops: value numbers of constants and of operations, keyed by
+ *    operator, operand value numbers and result type
+ *  - available: for each operation's value number, where it was first
+ *    computed and the temporary holding it (once one was needed)
+ *  - holders: a variable assigned each value (valid while vars agrees)
+ *  - numbered: value number of each node of the current statement
+ *  - inserts: temporaries' assignments, per dense line index, to be placed
+ *    in front of the statement that first computed them
+ *  - line/stmt: position being numbered; order: post-order node counter
+ *  - symbols: the program's symbol table (ids of hand-built nodes)
+ * Theory of operation:
+ *  - Two expressions with the same value number compute the same value:
+ *    same operator and type on operands with the same value numbers. A
+ *    variable gets a fresh number whenever it may change, so entries for
+ *    its old value never match again.
+ */
+struct ValueTable {
+    struct Key {
+        int op; // BinaryOp, '-' for unary minus, or kLiteral/kFlexibleLiteral
+        std::int64_t lhs; // operand value number (literal: value bits)
+        int rhs;
+        NumType type;
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& k) const noexcept {
+            std::uint64_t h = static_cast<std::uint64_t>(k.lhs) * 0x9E3779B97F4A7C15ull;
+            h ^= (static_cast<std::uint64_t>(static_cast<std::uint32_t>(k.rhs)) << 8) ^ static_cast<std::uint64_t>(k.op + 1024) ^
+                 (static_cast<std::uint64_t>(k.type) << 40);
+            return static_cast<std::size_t>(h ^ (h >> 29));
+        }
+    };
+    struct Available {
+        AstRef<Expr>* slot; // first occurrence; holds the temporary once made
+        int line;
+        std::size_t stmt;
+        int order;
+        Symbol temp;
+    };
+    struct Insert {
+        std::size_t stmt;
+        int order;
+        AstRef<Stmt> assign;
+    };
+    static constexpr int kLiteral = -1;
+    static constexpr int kFlexibleLiteral = -2;
+
+    std::unordered_map<SymbolId, int> vars;
+    std::unordered_map<Key, int, KeyHash> literals;
+    std::unordered_map<Key, int, KeyHash> ops;
+    std::unordered_map<int, Available> available;
+    std::unordered_map<int, SymbolId> holders;
+    std::unordered_map<const Expr*, int> numbered;
+    std::vector<std::vector<Insert>> inserts;
+    int next{0};
+    int order{0};
+    int line{0};
+    std::size_t stmt{0};
+    const SymbolTable* symbols{nullptr};
+
+    int fresh() { return next++; }
+    /** reset: Forget everything but literals (block boundary, GOSUB). */
+    void reset() {
+        vars.clear();
+        ops.clear();
+        available.clear();
+        holders.clear();
+    }
+};
+
+} // namespace gwbasic
@@ -0,0 +1,138 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "basic_compiler/token/TokenType.h"
+
+namespace gwbasic {
+
+namespace keyword_detail {
+
+struct Entry {
+    std::string_view name; // upper-case spelling
+    TokenType type;
+};
+
+/**
+ * Reserved words recognised by the lexer, upper-case, any order. New
+ * GW-BASIC keywords only need a row here; the bucket index below is
+ * rebuilt at compile time.
+ */
+inline constexpr Entry kKeywords[] = {
+    {"LET", TokenType::KwLet},
+    {"PRINT", TokenType::KwPrint},
+    {"IF", TokenType::KwIf},
+    {"THEN", TokenType::KwThen},
+    {"GOTO", TokenType::KwGoto},
+    {"END", TokenType::KwEnd},
+    {"REM", TokenType::KwRem},
+    {"FOR", TokenType::KwFor},
+    {"TO", TokenType::KwTo},
+    {"STEP", TokenType::KwStep},
+    {"NEXT", TokenType::KwNext},
+    {"GOSUB", TokenType::KwGosub},
+    {"RETURN", TokenType::KwReturn},
+    {"INPUT", TokenType::KwInput},
+    {"DEFINT", TokenType::KwDefint},
+    {"DEFSNG", TokenType::KwDefsng},
+    {"DEFDBL", TokenType::KwDefdbl},
+};
+
+inline constexpr std::size_t kCount = std::size(kKeywords);
+
+constexpr char upper(char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c; }
+
+constexpr std::size_t maxLength() {
+    std::size_t n = 0;
+    for (const auto& k : kKeywords) n = k.name.size() > n ? k.name.size() : n;
+    return n;
+}
+
+inline constexpr std::size_t kMaxLen = maxLength();
+
+/** Bucket of keywords sharing (length, first letter). */
+constexpr std::size_t bucketOf(std::size_t len, char first) {
+    return (len - 1) * 26 + static_cast<std::size_t>(first - 'A');
+}
+
+inline constexpr std::size_t kBuckets = kMaxLen * 26;
+
+/**
+ * Type: Index
+ * Purpose:
+ *  - Keywords grouped by (length, first letter): entries[begin[b]..begin[b+1])
+ *    hold every keyword of bucket b.
+ * Theory of operation:
+ *  - Built by a counting sort in a constexpr function, so the table lives in
+ *    read-only data and costs nothing at startup.
+ */
+struct Index {
+    std::array<std::uint16_t, kBuckets + 1> begin{};
+    std::array<Entry, kCount> entries{};
+};
+
+constexpr Index buildIndex() {
+    Index ix{};
+    std::array<std::uint16_t, kBuckets + 1> count{};
+    for (const auto& k : kKeywords) ++count[bucketOf(k.name.size(), k.name[0]) + 1];
+    for (std::size_t b = 0; b < kBuckets; ++b) ix.begin[b + 1] = static_cast<std::uint16_t>(ix.begin[b] + count[b + 1]);
+    std::array<std::uint16_t, kBuckets + 1> fill = ix.begin;
+    for (const auto& k : kKeywords) ix.entries[fill[bucketOf(k.name.size(), k.name[0])]++] = k;
+    return ix;
+}
+
+inline constexpr Index kIndex = buildIndex();
+
+constexpr bool wellFormed() {
+    for (const auto& k : kKeywords) {
+        if (k.name.empty()) return false;
+        for (const char c : k.name)
+            if (c < 'A' || c > 'Z') return false;
+    }
+    for (std::size_t i = 0; i < kCount; ++i)
+        for (std::size_t j = i + 1; j < kCount; ++j)
+            if (kKeywords[i].name == kKeywords[j].name) return false;
+    return true;
+}
+
+static_assert(wellFormed(), "keywords must be unique, non-empty and upper-case A-Z");
+
+} // namespace keyword_detail
+
+/**
+ * Function: lookupKeyword
+ * Inputs:
+ *  - word: Identifier-shaped lexeme in any letter case
+ * Outputs:
+ *  - TokenType: Keyword token type, or Identifier when word is not reserved
+ * Theory of operation:
+ *  - Length and first letter select a bucket of the compile-time index
+ *    (one or two entries in practice, and still a handful with the full
+ *    GW-BASIC word list); candidates are compared with ASCII case folding
+ *    directly against the lexeme, so no temporary string is built.
+ */
+constexpr TokenType lookupKeyword(std::string_view word) {
+    using namespace keyword_detail;
+    if (word.empty() || word.size() > kMaxLen) return TokenType::Identifier;
+    const char first = upper(word[0]);
+    if (first < 'A' || first > 'Z') return TokenType::Identifier;
+    const std::size_t b = bucketOf(word.size(), first);
+    for (std::size_t i = kIndex.begin[b]; i < kIndex.begin[b + 1]; ++i) {
+        const std::string_view kw = kIndex.entries[i].name;
+        std::size_t j = 1;
+        while (j < kw.size() && upper(word[j]) == kw[j]) ++j;
+        if (j == kw.size()) return kIndex.entries[i].type;
+    }
+    return TokenType::Identifier;
+}
+
+static_assert(lookupKeyword("print") == TokenType::KwPrint);
+static_assert(lookupKeyword("GoSub") == TokenType::KwGosub);
+static_assert(lookupKeyword("PRINTX") == TokenType::Identifier);
+static_assert(lookupKeyword("X") == TokenType::Identifier);
+
+} // namespace gwbasic
@@ -38,6 +38,9 @@ inline std::string to_string(TokenType t) {
         case TokenType::KwGosub: return "GOSUB";
         case TokenType::KwReturn: return "RETURN";
         case TokenType::KwInput: return "INPUT";
+        case TokenType::KwDefint: return "DEFINT";
+        case TokenType::KwDefsng: return "DEFSNG";
+        case TokenType::KwDefdbl: return "DEFDBL";
         case TokenType::Plus: return "+";
         case TokenType::Minus: return "-";
         case TokenType::Star: return "*";
@@ -1,8 +1,7 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #pragma once
 
-#include <string>
-#include <utility>
+#include <string_view>
 
 #include "basic_compiler/token/TokenType.h"
 
@@ -15,20 +14,25 @@ namespace gwbasic {
  *    parser and for logging/diagnostics.
  * Inputs (ctor):
  *  - type: TokenType classification
- *  - lexeme: Original text (when applicable)
+ *  - lexeme: View of the original text in the lexer's source (or a static
+ *    spelling for punctuation); String tokens carry the raw text between
+ *    the quotes with escapes still in place
  *  - line/col: 1-based source position
  * Outputs:
  *  - Plain value object moved around by the lexer and parser
+ * Theory of operation:
+ *  - Tokens never own text, so lexing allocates nothing per token; the
+ *    source buffer must outlive the token stream.
  */
 struct Token {
     TokenType type{};
-    std::string lexeme{};
+    std::string_view lexeme{};
     int line{1};
     int col{1};
 
     Token() = default;
-    Token(TokenType t, std::string lx, int ln, int cl)
-        : type(t), lexeme(std::move(lx)), line(ln), col(cl) {}
+    Token(TokenType t, std::string_view lx, int ln, int cl)
+        : type(t), lexeme(lx), line(ln), col(cl) {}
 };
 
 } // namespace gwbasic
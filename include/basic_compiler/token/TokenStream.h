@@ -0,0 +1,60 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "basic_compiler/token/Token.h"
+
+namespace gwbasic {
+
+class Lexer;
+
+/**
+ * Class: TokenStream
+ * Purpose:
+ *  - Token source for the parser with a fixed two-token lookahead window
+ *    (peek/peekNext), fed either from a pre-built token vector or pulled
+ *    on demand from a Lexer.
+ * Inputs (ctor):
+ *  - tokens: Complete token list (buffered mode, e.g., from tokenize())
+ *  - lexer: Lexer to pull from one token at a time (streaming mode)
+ * Outputs:
+ *  - peek()/peekNext(): current and following token; advance() slides the
+ *    window by one
+ * Theory of operation:
+ *  - The window is two Token values refilled by pull() on every advance,
+ *    so peeks never branch on the mode. In streaming mode no token list is
+ *    ever materialized: memory for tokens is constant regardless of program
+ *    size, and scanning interleaves with parsing. Past the end, both modes
+ *    keep yielding EndOfFile. The source text (and, in streaming mode, the
+ *    Lexer) must outlive the stream.
+ */
+class TokenStream {
+public:
+    explicit TokenStream(std::vector<Token> tokens)
+        : buffered_(std::move(tokens)) { prime(); }
+    explicit TokenStream(Lexer& lexer)
+        : lexer_(&lexer) { prime(); }
+
+    const Token& peek() const { return cur_; }
+    const Token& peekNext() const { return next_; }
+    void advance() { cur_ = next_; next_ = pull(); }
+
+    /** True when tokens are pulled from a Lexer rather than a vector. */
+    bool streaming() const { return lexer_ != nullptr; }
+
+private:
+    /** Produce the token after next_ from the active source. */
+    Token pull();
+    void prime() { cur_ = pull(); next_ = pull(); }
+
+    std::vector<Token> buffered_{};
+    std::size_t pos_{0};
+    Lexer* lexer_{nullptr};
+    Token cur_{};
+    Token next_{};
+};
+
+} // namespace gwbasic
@@ -12,7 +12,7 @@ namespace gwbasic {
  *  - Special: EndOfFile, NewLine
  *  - Literals: Integer, Float, String, Identifier
  *  - Keywords: Let, Print, If, Then, Goto, End, Rem, For, To, Step, Next,
- *              Gosub, Return, Input
+ *              Gosub, Return, Input, Defint, Defsng, Defdbl
  *  - Operators/punct: arithmetic, comparison, parens, colon, comma
  */
 enum class TokenType {
@@ -41,6 +41,9 @@ enum class TokenType {
     KwGosub,
     KwReturn,
     KwInput,
+    KwDefint,
+    KwDefsng,
+    KwDefdbl,
 
     // Operators / punctuation
     Plus,
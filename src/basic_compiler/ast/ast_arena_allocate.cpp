@@ -0,0 +1,49 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/ast/AstArena.h"
+
+namespace gwbasic {
+
+void* AstArena::allocate(const std::size_t bytes, const std::size_t align) {
+    /*
+     * Function: AstArena::allocate
+     * Inputs:
+     *  - bytes: size of the requested region
+     *  - align: required alignment (power of two)
+     * Outputs:
+     *  - void*: uninitialized storage owned by the arena
+     * Theory of operation:
+     *  - Aligns the bump cursor inside the current block and carves the
+     *    region out of it. When the block is exhausted a new kBlockBytes
+     *    block is started; requests larger than a quarter block get their
+     *    own exact-size block so they do not waste the tail of the current one.
+     */
+    auto misalign = reinterpret_cast<std::uintptr_t>(cur_) & (align - 1);
+    std::size_t pad = misalign ? align - misalign : 0;
+    if (cur_ && pad + bytes <= left_) {
+        std::byte* p = cur_ + pad;
+        cur_ = p + bytes;
+        left_ -= pad + bytes;
+        return p;
+    }
+    if (bytes > kBlockBytes / 4) {
+        auto block = std::make_unique<std::byte[]>(bytes + align);
+        std::byte* base = block.get();
+        misalign = reinterpret_cast<std::uintptr_t>(base) & (align - 1);
+        pad = misalign ? align - misalign : 0;
+        blockBytesTotal_ += bytes + align;
+        blocks_.emplace_back(std::move(block)); // cur_/left_ keep bumping the open block
+        return base + pad;
+    }
+    blocks_.emplace_back(std::make_unique<std::byte[]>(kBlockBytes));
+    blockBytesTotal_ += kBlockBytes;
+    cur_ = blocks_.back().get();
+    left_ = kBlockBytes;
+    misalign = reinterpret_cast<std::uintptr_t>(cur_) & (align - 1);
+    pad = misalign ? align - misalign : 0;
+    std::byte* p = cur_ + pad;
+    cur_ = p + bytes;
+    left_ -= pad + bytes;
+    return p;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,21 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/ast/AstArena.h"
+
+namespace gwbasic {
+
+std::size_t AstArena::bytesReserved() const {
+    /*
+     * Function: AstArena::bytesReserved
+     * Inputs:
+     *  - none
+     * Outputs:
+     *  - std::size_t: bytes held by all node pools plus bump blocks
+     * Theory of operation:
+     *  - Sums each pool's chunk reservation with the bump block total.
+     */
+    std::size_t total = blockBytesTotal_;
+    std::apply([&](const auto&... pool) { ((total += pool.bytesReserved()), ...); }, pools_);
+    return total;
+}
+
+} // namespace gwbasic
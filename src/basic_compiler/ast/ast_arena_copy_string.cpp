@@ -0,0 +1,23 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/ast/AstArena.h"
+
+namespace gwbasic {
+
+std::string_view AstArena::copyString(const std::string_view s) {
+    /*
+     * Function: AstArena::copyString
+     * Inputs:
+     *  - s: text to retain (identifier, string literal contents)
+     * Outputs:
+     *  - std::string_view: view of the arena-owned copy
+     * Theory of operation:
+     *  - Bump-allocates s.size() bytes (no terminator is needed; consumers
+     *    use the view's length) and copies the characters.
+     */
+    if (s.empty()) return {};
+    auto* p = static_cast<char*>(allocate(s.size(), alignof(char)));
+    std::memcpy(p, s.data(), s.size());
+    return {p, s.size()};
+}
+
+} // namespace gwbasic
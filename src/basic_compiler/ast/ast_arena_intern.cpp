@@ -0,0 +1,23 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/ast/AstArena.h"
+
+namespace gwbasic {
+
+Symbol AstArena::intern(const std::string_view s) {
+    /*
+     * Function: AstArena::intern
+     * Inputs:
+     *  - s: identifier or string-literal text (may view transient storage)
+     * Outputs:
+     *  - Symbol: dense id and a view of the arena-owned text
+     * Theory of operation:
+     *  - Looks the text up in the symbol table; new text is copied into the
+     *    arena before it is registered, so every occurrence of a name shares
+     *    one copy and one id.
+     */
+    if (const SymbolId id = symbols_.find(s); id != kNoSymbol) return {id, symbols_.name(id)};
+    const std::string_view text = copyString(s);
+    return {symbols_.add(text), text};
+}
+
+} // namespace gwbasic
@@ -0,0 +1,29 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "basic_compiler/ast/NumType.h"
+
+namespace gwbasic {
+
+NumType literalType(const double v) {
+    /*
+     * Function: literalType
+     * Inputs:
+     *  - v: literal value
+     * Outputs:
+     *  - NumType: Int, Single or Double
+     * Theory of operation:
+     *  - Whole numbers in the 16-bit range are Int. Otherwise the value is
+     *    printed with 7 significant digits; if that text reads back as the
+     *    same double, the literal was written with at most 7 digits and is
+     *    a Single constant.
+     */
+    if (v == std::floor(v) && v >= -32768.0 && v <= 32767.0) return NumType::Int;
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.7g", v);
+    return std::strtod(buf, nullptr) == v ? NumType::Single : NumType::Double;
+}
+
+} // namespace gwbasic
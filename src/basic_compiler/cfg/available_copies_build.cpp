@@ -0,0 +1,99 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+void AvailableCopies::build(const Program& program, const ControlFlowGraph& cfg) {
+    /*
+     * Function: AvailableCopies::build
+     * Inputs:
+     *  - program: AST to analyze
+     *  - cfg: its ControlFlowGraph
+     * Outputs:
+     *  - void (copies(), in() and transfer() describe program)
+     * Theory of operation:
+     *  - Numbers the copies of every line and indexes them by variable,
+     *    then runs the forward worklist described on the class. A block
+     *    not yet visited has no set; its first incoming state becomes it.
+     */
+    symbols_ = &program.arena->symbols();
+    copies_.clear();
+    copyOf_.clear();
+    varCopies_.assign(symbols_->size(), {});
+    const int n = static_cast<int>(cfg.size());
+    for (int i = 0; i < n; ++i) {
+        for (const auto& st : cfg.line(i).statements) {
+            const auto* asg = astCast<AssignStmt>(st.get());
+            const auto* src = asg ? astCast<VarExpr>(asg->value.get()) : nullptr;
+            if (!src || src->type != typeOfName(asg->name)) continue;
+            const SymbolId target = varOf(*symbols_, asg->sym, asg->name);
+            const SymbolId source = varOf(*symbols_, src->sym, src->name);
+            if (target == kNoSymbol || source == kNoSymbol || target == source) continue;
+            const int id = static_cast<int>(copies_.size());
+            copies_.push_back({target, source, st.get()});
+            copyOf_.emplace(st.get(), id);
+            varCopies_[target].push_back(id);
+            varCopies_[source].push_back(id);
+        }
+    }
+
+    in_.assign(static_cast<std::size_t>(n), BitSet());
+    if (n == 0) return;
+    std::vector<std::uint8_t> seen(static_cast<std::size_t>(n), 0);
+    std::vector<std::uint8_t> queued(static_cast<std::size_t>(n), 0);
+    in_[0] = BitSet(copies_.size());
+    seen[0] = queued[0] = 1;
+    std::vector<int> work{0};
+    auto mergeAt = [&](int t, const BitSet& state) {
+        if (t == ControlFlowGraph::kNone || !cfg.isLeader(t)) return;
+        const auto ti = static_cast<std::size_t>(t);
+        bool changed = !seen[ti];
+        if (changed) {
+            seen[ti] = 1;
+            in_[ti] = state;
+        } else {
+            changed = in_[ti].intersect(state);
+        }
+        if (changed && !queued[ti]) {
+            queued[ti] = 1;
+            work.push_back(t);
+        }
+    };
+    BitSet state;
+    while (!work.empty()) {
+        const int leader = work.back();
+        work.pop_back();
+        queued[static_cast<std::size_t>(leader)] = 0;
+        state = in_[static_cast<std::size_t>(leader)];
+        const int last = blockEnd(cfg, leader);
+        bool ended = false;
+        for (int i = leader; i <= last && !ended; ++i) {
+            for (const auto& st : cfg.line(i).statements) {
+                switch (st->kind) {
+                    case StmtKind::If:
+                        mergeAt(cfg.indexOf(static_cast<const IfStmt*>(st.get())->targetLine), state);
+                        break;
+                    case StmtKind::Goto:
+                        mergeAt(cfg.indexOf(static_cast<const GotoStmt*>(st.get())->targetLine), state);
+                        ended = true;
+                        break;
+                    case StmtKind::Gosub:
+                        mergeAt(cfg.indexOf(static_cast<const GosubStmt*>(st.get())->targetLine), state);
+                        transfer(*st, state);
+                        break;
+                    case StmtKind::Return:
+                    case StmtKind::End:
+                        ended = true;
+                        break;
+                    default:
+                        transfer(*st, state);
+                        break;
+                }
+                if (ended) break;
+            }
+        }
+        if (!ended && cfg.fallsThrough(last) && last + 1 < n) mergeAt(last + 1, state);
+    }
+}
+
+} // namespace gwbasic
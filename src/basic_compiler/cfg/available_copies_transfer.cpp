@@ -0,0 +1,51 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+void AvailableCopies::transfer(const Stmt& st, BitSet& state) const {
+    /*
+     * Function: AvailableCopies::transfer
+     * Inputs:
+     *  - st: statement (of the analyzed program)
+     *  - state: copies available before st
+     * Outputs:
+     *  - void (state holds the copies available after st)
+     * Theory of operation:
+     *  - Assigning a variable kills every copy that reads or writes it; a
+     *    copy statement then makes itself available. INPUT and FOR kill
+     *    the same way for each variable they assign; GOSUB kills all.
+     */
+    auto kill = [&](SymbolId sym, std::string_view name) {
+        const SymbolId var = varOf(*symbols_, sym, name);
+        if (var == kNoSymbol || var >= varCopies_.size()) return;
+        for (const int c : varCopies_[var]) state.reset(static_cast<std::size_t>(c));
+    };
+    switch (st.kind) {
+        case StmtKind::Assign: {
+            const auto* asg = static_cast<const AssignStmt*>(&st);
+            kill(asg->sym, asg->name);
+            if (const auto it = copyOf_.find(&st); it != copyOf_.end()) state.set(static_cast<std::size_t>(it->second));
+            break;
+        }
+        case StmtKind::Input: {
+            const auto* in = static_cast<const InputStmt*>(&st);
+            kill(in->sym, in->name);
+            break;
+        }
+        case StmtKind::For: {
+            const auto* fs = static_cast<const ForStmt*>(&st);
+            kill(fs->varSym, fs->var);
+            for (const auto& bs : fs->body)
+                if (const auto* basg = astCast<AssignStmt>(bs.get())) kill(basg->sym, basg->name);
+            break;
+        }
+        case StmtKind::Gosub:
+            state.clear();
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace gwbasic
@@ -0,0 +1,106 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/ControlFlowGraph.h"
+#include <algorithm>
+
+namespace gwbasic {
+
+void ControlFlowGraph::build(const Program& program) {
+    /*
+     * Function: ControlFlowGraph::build
+     * Inputs:
+     *  - program: AST to analyze
+     * Outputs:
+     *  - void (index, flags and counts describe program)
+     * Theory of operation:
+     *  - Orders lines by number (keeping the last of duplicates), builds the
+     *    number -> index table, then collects each line's resolved jump
+     *    targets into one flat edge array (kept for targets()) while noting
+     *    whether it falls through. A worklist walk from line 0 marks
+     *    reachable lines and, for edges leaving reachable lines, jump
+     *    targets; leaders follow.
+     *    Targets that name no line contribute no edge (codegen reports them).
+     */
+    lines_.clear();
+    lines_.reserve(program.lines.size());
+    for (const auto& l : program.lines) lines_.push_back(&l);
+    std::ranges::stable_sort(lines_, {}, [](const Line* l) { return l->number; });
+    // Keep the last line of each run of equal numbers.
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < lines_.size(); ++i) {
+        if (i + 1 < lines_.size() && lines_[i + 1]->number == lines_[i]->number) continue;
+        lines_[kept++] = lines_[i];
+    }
+    lines_.resize(kept);
+    const std::size_t n = lines_.size();
+
+    numbers_.resize(n);
+    for (std::size_t i = 0; i < n; ++i) numbers_[i] = lines_[i]->number;
+    dense_.clear();
+    if (n != 0 && numbers_.front() >= 0 && numbers_.back() < kDenseLimit) {
+        dense_.assign(static_cast<std::size_t>(numbers_.back()) + 1, kNone);
+        for (std::size_t i = 0; i < n; ++i) dense_[static_cast<std::size_t>(numbers_[i])] = static_cast<int>(i);
+    }
+
+    flags_.assign(n, 0);
+    edges_.clear();
+    firstEdge_.assign(n + 1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        firstEdge_[i] = edges_.size();
+        bool falls = true;
+        for (const auto& st : lines_[i]->statements) {
+            int target = kNone;
+            switch (st->kind) {
+                case StmtKind::Goto:
+                    target = indexOf(static_cast<const GotoStmt*>(st.get())->targetLine);
+                    falls = false;
+                    break;
+                case StmtKind::If:
+                    target = indexOf(static_cast<const IfStmt*>(st.get())->targetLine);
+                    break;
+                case StmtKind::Gosub:
+                    target = indexOf(static_cast<const GosubStmt*>(st.get())->targetLine);
+                    break;
+                case StmtKind::End:
+                case StmtKind::Return:
+                    falls = false;
+                    break;
+                default:
+                    break;
+            }
+            if (target != kNone) edges_.push_back(target);
+            if (!falls) break;
+        }
+        if (falls) flags_[i] |= kFallsThrough;
+    }
+    firstEdge_[n] = edges_.size();
+
+    reachableCount_ = 0;
+    blockCount_ = 0;
+    if (n == 0) return;
+    std::vector<int> work{0};
+    flags_[0] |= kReachable;
+    while (!work.empty()) {
+        const auto i = static_cast<std::size_t>(work.back());
+        work.pop_back();
+        ++reachableCount_;
+        auto visit = [&](int t) {
+            if (!(flags_[static_cast<std::size_t>(t)] & kReachable)) {
+                flags_[static_cast<std::size_t>(t)] |= kReachable;
+                work.push_back(t);
+            }
+        };
+        for (std::size_t e = firstEdge_[i]; e < firstEdge_[i + 1]; ++e) {
+            flags_[static_cast<std::size_t>(edges_[e])] |= kTarget;
+            visit(edges_[e]);
+        }
+        if ((flags_[i] & kFallsThrough) && i + 1 < n) visit(static_cast<int>(i + 1));
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        if ((flags_[i] & kReachable) && (i == 0 || (flags_[i] & kTarget))) {
+            flags_[i] |= kLeader;
+            ++blockCount_;
+        }
+    }
+}
+
+} // namespace gwbasic
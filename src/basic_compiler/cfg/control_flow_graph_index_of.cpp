@@ -0,0 +1,27 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/ControlFlowGraph.h"
+#include <algorithm>
+
+namespace gwbasic {
+
+int ControlFlowGraph::indexOf(int lineNumber) const {
+    /*
+     * Function: ControlFlowGraph::indexOf
+     * Inputs:
+     *  - lineNumber: BASIC line number
+     * Outputs:
+     *  - int: dense index of that line, or kNone
+     * Theory of operation:
+     *  - Direct table lookup when the numbers are compact; binary search of
+     *    the sorted numbers otherwise.
+     */
+    if (!dense_.empty()) {
+        if (lineNumber < 0 || static_cast<std::size_t>(lineNumber) >= dense_.size()) return kNone;
+        return dense_[static_cast<std::size_t>(lineNumber)];
+    }
+    const auto it = std::ranges::lower_bound(numbers_, lineNumber);
+    if (it == numbers_.end() || *it != lineNumber) return kNone;
+    return static_cast<int>(it - numbers_.begin());
+}
+
+} // namespace gwbasic
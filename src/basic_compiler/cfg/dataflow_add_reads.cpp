@@ -0,0 +1,40 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+void addReads(const SymbolTable& symbols, const Expr* e, BitSet& vars) {
+    /*
+     * Function: addReads
+     * Inputs:
+     *  - symbols: program symbol table (variable ids)
+     *  - e: expression (may be null)
+     *  - vars: set receiving the ids
+     * Outputs:
+     *  - void (vars gains every variable a VarExpr in e names)
+     * Theory of operation:
+     *  - Recursive walk; names that were never interned cannot be tracked
+     *    and are skipped.
+     */
+    if (!e) return;
+    switch (e->kind) {
+        case ExprKind::Var: {
+            const auto* v = static_cast<const VarExpr*>(e);
+            if (const SymbolId id = varOf(symbols, v->sym, v->name); id != kNoSymbol) vars.set(id);
+            break;
+        }
+        case ExprKind::Unary:
+            addReads(symbols, static_cast<const UnaryExpr*>(e)->inner.get(), vars);
+            break;
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            addReads(symbols, b->lhs.get(), vars);
+            addReads(symbols, b->rhs.get(), vars);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+} // namespace gwbasic
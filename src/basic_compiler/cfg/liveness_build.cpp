@@ -0,0 +1,75 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+void Liveness::build(const Program& program, const ControlFlowGraph& cfg) {
+    /*
+     * Function: Liveness::build
+     * Inputs:
+     *  - program: AST to analyze
+     *  - cfg: its ControlFlowGraph
+     * Outputs:
+     *  - void (in(), out() and transfer() describe program)
+     * Theory of operation:
+     *  - Collects each block's predecessors from cfg (jump targets and
+     *    fall-through) and the blocks holding a RETURN, then runs the
+     *    backward worklist described on the class. Blocks are queued in
+     *    ascending order and popped from the back, so the first sweep
+     *    already runs bottom-up.
+     */
+    symbols_ = &program.arena->symbols();
+    cfg_ = &cfg;
+    const int n = static_cast<int>(cfg.size());
+    in_.assign(static_cast<std::size_t>(n), BitSet());
+    continuations_ = BitSet(symbols_->size());
+
+    std::vector<std::vector<int>> preds(static_cast<std::size_t>(n)); // by leader
+    std::vector<int> returnBlocks;
+    std::vector<int> work;
+    std::vector<std::uint8_t> queued(static_cast<std::size_t>(n), 0);
+    for (int leader = 0; leader < n; ++leader) {
+        if (!cfg.isLeader(leader)) continue;
+        in_[static_cast<std::size_t>(leader)] = BitSet(symbols_->size());
+        const int last = blockEnd(cfg, leader);
+        bool returns = false;
+        for (int i = leader; i <= last; ++i) {
+            for (const int t : cfg.targets(i)) preds[static_cast<std::size_t>(t)].push_back(leader);
+            const Line& line = cfg.line(i);
+            const std::size_t count = reachableStatements(line);
+            returns = returns || (count != 0 && line.statements[count - 1]->kind == StmtKind::Return);
+        }
+        if (cfg.fallsThrough(last) && last + 1 < n) preds[static_cast<std::size_t>(last) + 1].push_back(leader);
+        if (returns) returnBlocks.push_back(leader);
+        work.push_back(leader);
+        queued[static_cast<std::size_t>(leader)] = 1;
+    }
+    auto push = [&](int leader) {
+        if (!queued[static_cast<std::size_t>(leader)]) {
+            queued[static_cast<std::size_t>(leader)] = 1;
+            work.push_back(leader);
+        }
+    };
+
+    BitSet live;
+    while (!work.empty()) {
+        const int leader = work.back();
+        work.pop_back();
+        queued[static_cast<std::size_t>(leader)] = 0;
+        const int last = blockEnd(cfg, leader);
+        live = out(last);
+        for (int i = last; i >= leader; --i) {
+            const Line& line = cfg.line(i);
+            for (std::size_t k = reachableStatements(line); k-- > 0;) {
+                const Stmt& st = *line.statements[k];
+                if (st.kind == StmtKind::Gosub && continuations_.unite(live))
+                    for (const int r : returnBlocks) push(r);
+                transfer(st, live);
+            }
+        }
+        if (in_[static_cast<std::size_t>(leader)].unite(live))
+            for (const int p : preds[static_cast<std::size_t>(leader)]) push(p);
+    }
+}
+
+} // namespace gwbasic
@@ -0,0 +1,81 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+void Liveness::transfer(const Stmt& st, BitSet& live) const {
+    /*
+     * Function: Liveness::transfer
+     * Inputs:
+     *  - st: statement (of the analyzed program)
+     *  - live: variables live after st
+     * Outputs:
+     *  - void (live holds the variables live before st)
+     * Theory of operation:
+     *  - Standard backward rule, live = (live - defined) + read, with jumps
+     *    taking their target's entry set: IF adds it (it may fall through),
+     *    GOTO and GOSUB replace live with it, RETURN with the continuation
+     *    set and END with nothing. INPUT defines its variable but also
+     *    reads it, since codegen keeps the old value when scanf fails.
+     *  - FOR reads its limits and body on top of what is live after the
+     *    loop and defines only its variable before any of those run.
+     */
+    auto entryOf = [&](int targetLine) {
+        const int t = cfg_->indexOf(targetLine);
+        return t == ControlFlowGraph::kNone || !cfg_->isLeader(t) ? BitSet(symbols_->size()) : in_[static_cast<std::size_t>(t)];
+    };
+    auto kill = [&](SymbolId sym, std::string_view name) {
+        if (const SymbolId id = varOf(*symbols_, sym, name); id != kNoSymbol) live.reset(id);
+    };
+    switch (st.kind) {
+        case StmtKind::Assign: {
+            const auto* asg = static_cast<const AssignStmt*>(&st);
+            kill(asg->sym, asg->name);
+            addReads(*symbols_, asg->value.get(), live);
+            break;
+        }
+        case StmtKind::Print:
+            addReads(*symbols_, static_cast<const PrintStmt*>(&st)->value.get(), live);
+            break;
+        case StmtKind::Input: {
+            // A failed read (EOF, bad text) keeps the old value: a use after the kill
+            const auto* in = static_cast<const InputStmt*>(&st);
+            if (const SymbolId id = varOf(*symbols_, in->sym, in->name); id != kNoSymbol) live.set(id);
+            break;
+        }
+        case StmtKind::If: {
+            const auto* is = static_cast<const IfStmt*>(&st);
+            live.unite(entryOf(is->targetLine));
+            addReads(*symbols_, is->cond.get(), live);
+            break;
+        }
+        case StmtKind::Goto:
+            live = entryOf(static_cast<const GotoStmt*>(&st)->targetLine);
+            break;
+        case StmtKind::Gosub:
+            live = entryOf(static_cast<const GosubStmt*>(&st)->targetLine);
+            break;
+        case StmtKind::Return:
+            live = continuations_;
+            break;
+        case StmtKind::End:
+            live.clear();
+            break;
+        case StmtKind::For: {
+            const auto* fs = static_cast<const ForStmt*>(&st);
+            addReads(*symbols_, fs->end.get(), live);
+            addReads(*symbols_, fs->step.get(), live);
+            for (const auto& bs : fs->body) {
+                if (const auto* basg = astCast<AssignStmt>(bs.get())) addReads(*symbols_, basg->value.get(), live);
+                else if (const auto* bpr = astCast<PrintStmt>(bs.get())) addReads(*symbols_, bpr->value.get(), live);
+            }
+            kill(fs->varSym, fs->var);
+            addReads(*symbols_, fs->start.get(), live);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+} // namespace gwbasic
@@ -0,0 +1,179 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+#include <algorithm>
+
+namespace gwbasic {
+
+void ReachingDefinitions::build(const Program& program, const ControlFlowGraph& cfg) {
+    /*
+     * Function: ReachingDefinitions::build
+     * Inputs:
+     *  - program: AST to analyze
+     *  - cfg: its ControlFlowGraph
+     * Outputs:
+     *  - void (reaching() answers for program)
+     * Theory of operation:
+     *  - Walks every reachable block once, as the blocks run: up to the
+     *    first GOTO, END or RETURN, cutting a new segment after each IF and
+     *    GOSUB.
+     *    Each statement is given its segment and index (sites_), each
+     *    assignment, INPUT and FOR-assigned variable a definition placed at
+     *    its statement, and each jump, fall-through, RETURN and GOSUB
+     *    continuation an edge into the segment it enters.
+     *  - The placements are then grouped by segment and variable and the
+     *    edges by the segment they enter, so reaching() finds both by key.
+     *    Joins go where the segments defining a variable meet
+     *    (computeDominators, placeJoins); no set is propagated per block.
+     */
+    const SymbolTable& symbols = program.arena->symbols();
+    defs_.clear();
+    operandRange_.clear();
+    operands_.clear();
+    entry_.assign(symbols.size(), -1);
+    sites_.clear();
+    placed_.clear();
+    placedRange_.clear();
+    edges_.clear();
+    firstEdge_.clear();
+    joins_.clear();
+    dominating_.clear();
+    dominatingRange_.assign(symbols.size(), {0, 0});
+
+    struct Placement {
+        std::uint64_t key;
+        int index;
+        int def;
+    };
+    struct Jump {
+        int target; // dense line index, or a segment when toSegment
+        bool toSegment;
+        Edge edge; // from -1 for the RETURNs
+    };
+    std::vector<Placement> placements;
+    std::vector<Jump> jumps;
+    std::vector<Edge> returns;
+    const int n = static_cast<int>(cfg.size());
+    std::vector<int> segmentOf(static_cast<std::size_t>(n), -1); // by leader line
+    int segments = 0;
+    int segment = 0;
+    int index = 0;
+    auto define = [&](Definition::Kind kind, SymbolId var, const Stmt* st) {
+        if (var == kNoSymbol) return;
+        const int id = static_cast<int>(defs_.size());
+        defs_.push_back({kind, var, st});
+        operandRange_.emplace_back(0, 0);
+        placements.push_back({key(segment, var), index, id});
+    };
+    auto jump = [&](int targetLine) {
+        if (const int t = cfg.indexOf(targetLine); t != ControlFlowGraph::kNone) jumps.push_back({t, false, {segment, index}});
+    };
+    for (int leader = 0; leader < n; ++leader) {
+        if (!cfg.isLeader(leader) || !cfg.reachable(leader)) continue;
+        segment = segments++;
+        segmentOf[static_cast<std::size_t>(leader)] = segment;
+        index = 0;
+        const int last = blockEnd(cfg, leader);
+        bool ended = false;
+        for (int i = leader; i <= last && !ended; ++i) {
+            for (const auto& st : cfg.line(i).statements) {
+                if (const auto [it, fresh] = sites_.try_emplace(st.get(), Site{segment, index}); !fresh) it->second.segment = -1;
+                switch (st->kind) {
+                    case StmtKind::Assign: {
+                        const auto* asg = static_cast<const AssignStmt*>(st.get());
+                        define(Definition::Kind::Assign, varOf(symbols, asg->sym, asg->name), st.get());
+                        break;
+                    }
+                    case StmtKind::Input: {
+                        const auto* in = static_cast<const InputStmt*>(st.get());
+                        define(Definition::Kind::Input, varOf(symbols, in->sym, in->name), st.get());
+                        break;
+                    }
+                    case StmtKind::For: {
+                        const auto* fs = static_cast<const ForStmt*>(st.get());
+                        define(Definition::Kind::Loop, varOf(symbols, fs->varSym, fs->var), st.get());
+                        for (const auto& bs : fs->body) {
+                            if (const auto* basg = astCast<AssignStmt>(bs.get()))
+                                define(Definition::Kind::Loop, varOf(symbols, basg->sym, basg->name), st.get());
+                        }
+                        break;
+                    }
+                    case StmtKind::If: {
+                        // Every segment is left only at its end, so what
+                        // follows a conditional jump is a segment of its own.
+                        jump(static_cast<const IfStmt*>(st.get())->targetLine);
+                        const int from = segment;
+                        segment = segments++;
+                        jumps.push_back({segment, true, {from, index + 1}});
+                        index = -1;
+                        break;
+                    }
+                    case StmtKind::Goto:
+                        jump(static_cast<const GotoStmt*>(st.get())->targetLine);
+                        ended = true;
+                        break;
+                    case StmtKind::Gosub:
+                        // The rest of the block continues from the RETURNs,
+                        // as a new segment whose first statement is the next.
+                        jump(static_cast<const GosubStmt*>(st.get())->targetLine);
+                        segment = segments++;
+                        jumps.push_back({segment, true, {-1, 0}});
+                        index = -1;
+                        break;
+                    case StmtKind::Return:
+                        returns.push_back({segment, index});
+                        ended = true;
+                        break;
+                    case StmtKind::End:
+                        ended = true;
+                        break;
+                    default:
+                        break;
+                }
+                ++index;
+                if (ended) break;
+            }
+        }
+        if (!ended && cfg.fallsThrough(last) && last + 1 < n) jumps.push_back({last + 1, false, {segment, index}});
+    }
+
+    // Edges grouped by the segment they enter; segment `segments` is where
+    // the RETURNs meet, and every GOSUB continuation has it as its only edge.
+    // The one after it is where the program starts, entering the first line.
+    const int returnSegment = segments;
+    start_ = segments + 1;
+    if (n > 0 && segmentOf[0] >= 0) jumps.push_back({0, false, {start_, 0}});
+    firstEdge_.assign(static_cast<std::size_t>(start_) + 2, 0);
+    auto into = [&](const Jump& j) {
+        return j.toSegment ? j.target : segmentOf[static_cast<std::size_t>(j.target)];
+    };
+    for (const Jump& j : jumps)
+        if (const int s = into(j); s >= 0) ++firstEdge_[static_cast<std::size_t>(s) + 1];
+    firstEdge_[static_cast<std::size_t>(returnSegment) + 1] += returns.size();
+    for (std::size_t s = 1; s < firstEdge_.size(); ++s) firstEdge_[s] += firstEdge_[s - 1];
+    edges_.resize(firstEdge_.back());
+    std::vector<std::size_t> fill(firstEdge_.begin(), firstEdge_.end() - 1);
+    for (const Jump& j : jumps) {
+        const int s = into(j);
+        if (s < 0) continue;
+        edges_[fill[static_cast<std::size_t>(s)]++] = j.edge.from < 0 ? Edge{returnSegment, 0} : j.edge;
+    }
+    for (const Edge& e : returns) edges_[fill[static_cast<std::size_t>(returnSegment)]++] = e;
+    computeDominators(start_ + 1);
+
+    // Placements grouped by segment and variable, in statement order.
+    std::ranges::stable_sort(placements, {}, &Placement::key);
+    placed_.reserve(placements.size());
+    for (std::size_t p = 0; p < placements.size(); ++p) {
+        auto& range = placedRange_[placements[p].key];
+        if (range.second == 0) range = {static_cast<std::uint32_t>(p), static_cast<std::uint32_t>(p)};
+        ++range.second;
+        placed_.emplace_back(placements[p].index, placements[p].def);
+    }
+    std::vector<std::pair<SymbolId, int>> defining;
+    defining.reserve(placedRange_.size());
+    for (const auto& [k, range] : placedRange_)
+        defining.emplace_back(static_cast<SymbolId>(k & 0xffffffffu), static_cast<int>(k >> 32));
+    placeJoins(defining);
+}
+
+} // namespace gwbasic
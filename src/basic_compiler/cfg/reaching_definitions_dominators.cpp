@@ -0,0 +1,200 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+#include <algorithm>
+
+namespace gwbasic {
+
+void ReachingDefinitions::computeDominators(int segments) {
+    /*
+     * Function: ReachingDefinitions::computeDominators
+     * Inputs:
+     *  - segments: number of segments, start_ included
+     * Outputs:
+     *  - void (idom_, and pre_/last_ numbering the dominator tree)
+     * Theory of operation:
+     *  - Cooper, Harvey and Kennedy's iteration over reverse postorder from
+     *    start_: a segment's dominator is where the dominators of its
+     *    processed predecessors meet. Segments start_ never reaches (a GOSUB
+     *    continuation when no RETURN runs) are left out and never answered.
+     */
+    const auto count = static_cast<std::size_t>(segments);
+    std::vector<std::size_t> firstOut(count + 1, 0);
+    for (const Edge& e : edges_) ++firstOut[static_cast<std::size_t>(e.from) + 1];
+    for (std::size_t s = 1; s <= count; ++s) firstOut[s] += firstOut[s - 1];
+    std::vector<int> out(edges_.size());
+    std::vector<std::size_t> fill(firstOut.begin(), firstOut.end() - 1);
+    for (int s = 0; s < segments; ++s)
+        for (const Edge& e : edgesInto(s)) out[fill[static_cast<std::size_t>(e.from)]++] = s;
+
+    // Postorder from start_, iteratively.
+    std::vector<int> post(count, -1);
+    std::vector<int> order; // reverse postorder once flipped
+    std::vector<std::pair<int, std::size_t>> stack{{start_, firstOut[static_cast<std::size_t>(start_)]}};
+    std::vector<std::uint8_t> seen(count, 0);
+    seen[static_cast<std::size_t>(start_)] = 1;
+    while (!stack.empty()) {
+        auto& [s, next] = stack.back();
+        if (next < firstOut[static_cast<std::size_t>(s) + 1]) {
+            const int t = out[next++];
+            if (!seen[static_cast<std::size_t>(t)]) {
+                seen[static_cast<std::size_t>(t)] = 1;
+                stack.emplace_back(t, firstOut[static_cast<std::size_t>(t)]);
+            }
+            continue;
+        }
+        post[static_cast<std::size_t>(s)] = static_cast<int>(order.size());
+        order.push_back(s);
+        stack.pop_back();
+    }
+    std::ranges::reverse(order);
+
+    idom_.assign(count, -1);
+    idom_[static_cast<std::size_t>(start_)] = start_;
+    auto meet = [&](int a, int b) {
+        while (a != b) {
+            while (post[static_cast<std::size_t>(a)] < post[static_cast<std::size_t>(b)]) a = idom_[static_cast<std::size_t>(a)];
+            while (post[static_cast<std::size_t>(b)] < post[static_cast<std::size_t>(a)]) b = idom_[static_cast<std::size_t>(b)];
+        }
+        return a;
+    };
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (const int s : order) {
+            if (s == start_) continue;
+            int dom = -1;
+            for (const Edge& e : edgesInto(s)) {
+                if (idom_[static_cast<std::size_t>(e.from)] < 0) continue;
+                dom = dom < 0 ? e.from : meet(e.from, dom);
+            }
+            if (dom != idom_[static_cast<std::size_t>(s)]) {
+                idom_[static_cast<std::size_t>(s)] = dom;
+                changed = true;
+            }
+        }
+    }
+    idom_[static_cast<std::size_t>(start_)] = -1;
+
+    // Preorder of the dominator tree: a segment dominates exactly the
+    // numbers from its own pre_ to its last_.
+    std::vector<std::size_t> firstChild(count + 1, 0);
+    for (const int s : order)
+        if (s != start_) ++firstChild[static_cast<std::size_t>(idom_[static_cast<std::size_t>(s)]) + 1];
+    for (std::size_t s = 1; s <= count; ++s) firstChild[s] += firstChild[s - 1];
+    std::vector<int> children(order.empty() ? 0 : order.size() - 1);
+    fill.assign(firstChild.begin(), firstChild.end() - 1);
+    for (const int s : order)
+        if (s != start_) children[fill[static_cast<std::size_t>(idom_[static_cast<std::size_t>(s)])]++] = s;
+    pre_.assign(count, -1);
+    last_.assign(count, -1);
+    int number = 0;
+    stack.assign(1, {start_, firstChild[static_cast<std::size_t>(start_)]});
+    pre_[static_cast<std::size_t>(start_)] = number++;
+    while (!stack.empty()) {
+        auto& [s, next] = stack.back();
+        if (next < firstChild[static_cast<std::size_t>(s) + 1]) {
+            const int c = children[next++];
+            pre_[static_cast<std::size_t>(c)] = number++;
+            stack.emplace_back(c, firstChild[static_cast<std::size_t>(c)]);
+            continue;
+        }
+        last_[static_cast<std::size_t>(s)] = number - 1;
+        stack.pop_back();
+    }
+}
+
+void ReachingDefinitions::placeJoins(std::vector<std::pair<SymbolId, int>>& defining) {
+    /*
+     * Function: ReachingDefinitions::placeJoins
+     * Inputs:
+     *  - defining: (variable, segment) for every segment defining a variable
+     * Outputs:
+     *  - void (joins_ and dominating_, every Join with its operands)
+     * Theory of operation:
+     *  - Cytron et al.: a variable needs a Join wherever the dominance
+     *    frontier of a segment defining it, or of one of its Joins, lies.
+     *    The frontiers come from walking each join point's predecessors up
+     *    to its dominator. Operands are looked up once every Join exists,
+     *    since they may be Joins further up.
+     */
+    const std::size_t count = idom_.size();
+    std::vector<std::vector<int>> frontier(count);
+    for (std::size_t s = 0; s < count; ++s) {
+        const auto in = edgesInto(static_cast<int>(s));
+        if (pre_[s] < 0 || in.size() < 2) continue;
+        for (const Edge& e : in) {
+            for (int r = e.from; pre_[static_cast<std::size_t>(r)] >= 0 && r != idom_[s]; r = idom_[static_cast<std::size_t>(r)]) {
+                auto& f = frontier[static_cast<std::size_t>(r)];
+                if (!f.empty() && f.back() == static_cast<int>(s)) break;
+                f.push_back(static_cast<int>(s));
+            }
+        }
+    }
+
+    std::ranges::sort(defining);
+    std::vector<int> joined(count, -1); // by segment: last group given a Join there
+    std::vector<int> queued(count, -1);
+    std::vector<int> work;
+    std::vector<int> blocks;
+    std::vector<std::pair<int, int>> created; // (join, segment)
+    for (std::size_t g = 0; g < defining.size();) {
+        const SymbolId var = defining[g].first;
+        const int group = static_cast<int>(g);
+        blocks.assign(1, start_);
+        for (; g < defining.size() && defining[g].first == var; ++g) {
+            const int s = defining[g].second;
+            if (pre_[static_cast<std::size_t>(s)] < 0) continue;
+            blocks.push_back(s);
+            queued[static_cast<std::size_t>(s)] = group;
+            work.push_back(s);
+        }
+        while (!work.empty()) {
+            const int x = work.back();
+            work.pop_back();
+            for (const int y : frontier[static_cast<std::size_t>(x)]) {
+                if (joined[static_cast<std::size_t>(y)] == group) continue;
+                joined[static_cast<std::size_t>(y)] = group;
+                const int id = static_cast<int>(defs_.size());
+                defs_.push_back({Definition::Kind::Join, var, nullptr});
+                operandRange_.emplace_back(0, 0);
+                joins_.emplace(key(y, var), id);
+                created.emplace_back(id, y);
+                if (queued[static_cast<std::size_t>(y)] != group) {
+                    queued[static_cast<std::size_t>(y)] = group;
+                    blocks.push_back(y);
+                    work.push_back(y);
+                }
+            }
+        }
+
+        // The variable's segments in dominator-tree order, each linked to
+        // the nearest one dominating it.
+        std::ranges::sort(blocks, {}, [&](int s) { return pre_[static_cast<std::size_t>(s)]; });
+        if (var >= dominatingRange_.size()) dominatingRange_.resize(static_cast<std::size_t>(var) + 1, {0, 0});
+        const auto first = static_cast<std::uint32_t>(dominating_.size());
+        std::vector<int>& open = work; // empty here: reused as the stack of enclosing entries
+        for (const int s : blocks) {
+            const Dominating d{pre_[static_cast<std::size_t>(s)], last_[static_cast<std::size_t>(s)], s, -1};
+            while (!open.empty() && dominating_[static_cast<std::size_t>(open.back())].last < d.pre) open.pop_back();
+            dominating_.push_back({d.pre, d.last, d.segment, open.empty() ? -1 : open.back()});
+            open.push_back(static_cast<int>(dominating_.size()) - 1);
+        }
+        open.clear();
+        dominatingRange_[var] = {first, static_cast<std::uint32_t>(dominating_.size())};
+    }
+
+    std::vector<int> found;
+    for (const auto& [join, segment] : created) {
+        const SymbolId var = defs_[static_cast<std::size_t>(join)].var;
+        found.clear();
+        for (const Edge& e : edgesInto(segment)) {
+            if (pre_[static_cast<std::size_t>(e.from)] < 0) continue;
+            const int d = lastDefinition(e.from, e.end, var);
+            found.push_back(d >= 0 ? d : atStart(e.from, var));
+        }
+        operandRange_[static_cast<std::size_t>(join)] = {static_cast<std::uint32_t>(operands_.size()),
+                                                         static_cast<std::uint32_t>(found.size())};
+        operands_.insert(operands_.end(), found.begin(), found.end());
+    }
+}
+
+} // namespace gwbasic
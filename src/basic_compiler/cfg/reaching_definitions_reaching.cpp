@@ -0,0 +1,98 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/cfg/Dataflow.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace gwbasic {
+
+int ReachingDefinitions::reaching(const Stmt& st, SymbolId var, bool after) {
+    /*
+     * Function: ReachingDefinitions::reaching
+     * Inputs:
+     *  - st: reachable top-level statement of the analyzed program
+     *  - var: variable read there
+     *  - after: look past st's own definitions (a FOR's limits and body)
+     * Outputs:
+     *  - int: definition id, or -1 when st is not a (unique) reachable
+     *    statement, its segment never runs, or var is unknown
+     * Theory of operation:
+     *  - The last definition of var placed before st in its segment wins;
+     *    otherwise the answer is what reaches the segment's start (atStart).
+     */
+    const auto it = sites_.find(&st);
+    if (it == sites_.end() || it->second.segment < 0 || var == kNoSymbol) return -1;
+    const Site site = it->second;
+    if (pre_[static_cast<std::size_t>(site.segment)] < 0) return -1;
+    if (const int d = lastDefinition(site.segment, site.index + (after ? 1 : 0), var); d >= 0) return d;
+    return atStart(site.segment, var);
+}
+
+int ReachingDefinitions::lastDefinition(int segment, int end, SymbolId var) const {
+    /*
+     * Function: ReachingDefinitions::lastDefinition
+     * Outputs:
+     *  - int: last definition of var placed at a statement index below end
+     *    of segment, or -1
+     */
+    const auto it = placedRange_.find(key(segment, var));
+    if (it == placedRange_.end()) return -1;
+    const auto first = placed_.begin() + it->second.first;
+    const auto last = placed_.begin() + it->second.second;
+    const auto at = std::lower_bound(first, last, end, [](const std::pair<int, int>& p, int e) { return p.first < e; });
+    return at == first ? -1 : std::prev(at)->second;
+}
+
+int ReachingDefinitions::atStart(int segment, SymbolId var) {
+    /*
+     * Function: ReachingDefinitions::atStart
+     * Outputs:
+     *  - int: definition of var reaching the start of segment (one start_
+     *    reaches)
+     * Theory of operation:
+     *  - The segment's own Join if it has one. Otherwise what leaves the
+     *    nearest strict dominator that defines or joins var: the last of
+     *    those before segment in dominator-tree preorder, or the nearest of
+     *    its own dominating entries whose subtree holds segment. start_ is
+     *    the first entry of every variable, so the walk ends there at worst.
+     */
+    if (segment == start_) return entryOf(var);
+    if (const auto it = joins_.find(key(segment, var)); it != joins_.end()) return it->second;
+    if (var >= dominatingRange_.size()) return entryOf(var);
+    const auto [first, last] = dominatingRange_[var];
+    if (first == last) return entryOf(var);
+    const int pre = pre_[static_cast<std::size_t>(segment)];
+    const auto begin = dominating_.begin() + first;
+    const auto at = std::lower_bound(begin, dominating_.begin() + last, pre, [](const Dominating& d, int p) { return d.pre < p; });
+    auto i = static_cast<int>(std::distance(dominating_.begin(), at)) - 1;
+    while (i >= 0 && dominating_[static_cast<std::size_t>(i)].last < pre) i = dominating_[static_cast<std::size_t>(i)].parent;
+    return i < 0 ? entryOf(var) : atEnd(dominating_[static_cast<std::size_t>(i)].segment, var);
+}
+
+int ReachingDefinitions::atEnd(int segment, SymbolId var) {
+    /*
+     * Function: ReachingDefinitions::atEnd
+     * Outputs:
+     *  - int: definition of var leaving segment
+     */
+    if (const int d = lastDefinition(segment, std::numeric_limits<int>::max(), var); d >= 0) return d;
+    return atStart(segment, var);
+}
+
+int ReachingDefinitions::entryOf(SymbolId var) {
+    /*
+     * Function: ReachingDefinitions::entryOf
+     * Outputs:
+     *  - int: the Entry definition of var, created on first use
+     */
+    if (var >= entry_.size()) entry_.resize(static_cast<std::size_t>(var) + 1, -1);
+    int& id = entry_[var];
+    if (id < 0) {
+        id = static_cast<int>(defs_.size());
+        defs_.push_back({Definition::Kind::Entry, var, nullptr});
+        operandRange_.emplace_back(0, 0);
+    }
+    return id;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,24 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::assign(SymbolId sym, const std::string& value) {
+    /*
+     * Function: CodeGenerator::assign
+     * Inputs:
+     *  - sym: assigned variable (declared by collectDecls)
+     *  - value: register or literal now held by the variable
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - Assignment emits no instruction in SSA form; later reads of the
+     *    variable use value directly.
+     */
+    const int slot = varSlot_[sym];
+    if (slot < 0) throw CodeGenError("Internal: assignment to undeclared variable");
+    values_[static_cast<std::size_t>(slot)] = value;
+    GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " Assign(", arena_->symbols().name(sym), ") -> ", value);
+}
+
+} // namespace gwbasic
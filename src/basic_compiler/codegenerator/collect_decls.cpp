@@ -1,6 +1,5 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <algorithm>
 
 namespace gwbasic {
 
@@ -12,25 +11,31 @@ void CodeGenerator::collectDecls(const Program& program) {
      * Outputs:
      *  - void (initializes internal maps/sets and prepares line ordering)
      * Theory of operation:
-     *  - Clears internal state, scans all lines/statements to populate the
-     *    sets of variables and string literals, records and sorts line numbers
-     *    and builds a line-number to Line* map for later codegen.
+     *  - Clears internal state and sizes the per-symbol tables from the
+     *    program's interner, builds the line CFG, and scans the statements
+     *    of reachable lines to record variables and string literals by
+     *    symbol id (dead lines contribute no globals or allocas).
      */
+    arena_ = program.arena.get();
+    const std::size_t nsym = arena_->symbols().size();
     variables_.clear();
-    varAllocaName_.clear();
-    strLiteralId_.clear();
+    slotTypes_.clear();
+    varSlot_.assign(nsym, -1);
+    usesInput_ = false;
+    usesPrint_ = false;
+    strLiteralId_.assign(nsym, -1);
+    strLiterals_.clear();
     tempCounter_ = 0;
     strCounter_ = 0;
-    lineNumbers_.clear();
-    lineMap_.clear();
+    cfg_.build(program);
+    lineEdges_.assign(cfg_.size(), {});
+    backEdges_.assign(cfg_.size(), {});
+    returnEdges_.clear();
 
-    for (const auto& line : program.lines) {
-        lineNumbers_.push_back(line.number);
-        lineMap_[line.number] = &line;
-        for (const auto& st : line.statements) collectStmtVars(st.get());
+    for (int i = 0; i < static_cast<int>(cfg_.size()); ++i) {
+        if (!cfg_.reachable(i)) continue;
+        for (const auto& st : cfg_.line(i).statements) collectStmtVars(st.get());
     }
-    std::ranges::sort(lineNumbers_);
-    lineNumbers_.erase(std::ranges::unique(lineNumbers_).begin(), lineNumbers_.end());
 }
 
 } // namespace gwbasic
@@ -11,20 +11,37 @@ void CodeGenerator::collectExprVars(const Expr* e) {
      * Outputs:
      *  - void (updates internal variable set)
      * Theory of operation:
-     *  - Recursively visits the expression tree, recording any variable
-     *    references for later allocation in the entry block.
+     *  - Recursively visits the expression tree, logging variable
+     *    references (reads need no declaration in SSA form) and numbering
+     *    string literals (first occurrence of a symbol gets the next id).
      */
     if (!e) return;
-    if (const auto v = dynamic_cast<const VarExpr*>(e)) {
-        variables_.insert(v->name);
-        std::ostringstream m; m << "VarRef " << v->name << " @ " << v->pos.line << ':' << v->pos.col; logSem(m.str());
-        return;
-    }
-    if (const auto b = dynamic_cast<const BinaryExpr*>(e)) {
-        collectExprVars(b->lhs.get()); collectExprVars(b->rhs.get()); return;
-    }
-    if (const auto u = dynamic_cast<const UnaryExpr*>(e)) {
-        collectExprVars(u->inner.get()); return;
+    switch (e->kind) {
+        case ExprKind::Var: {
+            const auto* v = static_cast<const VarExpr*>(e);
+            (void)symbolOf(v->sym, v->name);
+            GWBASIC_LOG(semLog_, Debug, "VarRef ", v->name, " @ ", v->pos.line, ':', v->pos.col);
+            break;
+        }
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            collectExprVars(b->lhs.get()); collectExprVars(b->rhs.get());
+            break;
+        }
+        case ExprKind::String: {
+            const auto* se = static_cast<const StringExpr*>(e);
+            const SymbolId sym = symbolOf(se->sym, se->value);
+            if (strLiteralId_[sym] < 0) {
+                strLiteralId_[sym] = strCounter_++;
+                strLiterals_.push_back(sym);
+            }
+            break;
+        }
+        case ExprKind::Unary:
+            collectExprVars(static_cast<const UnaryExpr*>(e)->inner.get());
+            break;
+        default:
+            break;
     }
 }
 
@@ -0,0 +1,52 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <cmath>
+
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+long long CodeGenerator::countedLoopStep(const ForStmt* fs) {
+    /*
+     * Function: CodeGenerator::countedLoopStep
+     * Inputs:
+     *  - fs: ForStmt node
+     * Outputs:
+     *  - long long: the step when the loop can count with an i64 induction
+     *    variable (emitCountedFor), 0 when it must use emitFor's general
+     *    form
+     * Theory of operation:
+     *  - Start and end must be provably integral: whole literals within
+     *    i32 range or Int-typed expressions that are not flexible. A
+     *    flexible expression (e.g. 32767*32767*3) computes in the loop
+     *    variable's type, so i32 arithmetic would wrap where emitFor does
+     *    not. A Single counter is exact only up to 2^24, so it needs
+     *    literal bounds within that range.
+     *  - The step must be a positive whole literal (or absent), so the trip
+     *    count follows from start and end; with "<=" as the loop test a
+     *    zero or negative step never counts down to an exit.
+     *  - The body must not assign the loop variable. End and step are
+     *    evaluated once at loop entry either way (see emitFor).
+     */
+    const SymbolId var = symbolOf(fs->varSym, fs->var);
+    const bool single = slotTypes_[static_cast<std::size_t>(varSlot_[var])] == NumType::Single;
+    const double limit = single ? 16777216.0 : 2147483647.0;
+    auto integral = [&](const Expr* e) {
+        if (const auto* n = astCast<NumberExpr>(e)) return n->value == std::floor(n->value) && std::fabs(n->value) <= limit;
+        return !single && !e->flexible && e->type == NumType::Int;
+    };
+    if (!integral(fs->start.get()) || !integral(fs->end.get())) return 0;
+    long long step = 1;
+    if (fs->step) {
+        const auto* n = astCast<NumberExpr>(fs->step.get());
+        if (!n || !integral(n) || n->value < 1.0) return 0;
+        step = static_cast<long long>(n->value);
+    }
+    for (const auto& s : fs->body) {
+        if (s->kind != StmtKind::Assign) continue;
+        const auto* asg = static_cast<const AssignStmt*>(s.get());
+        if (symbolOf(asg->sym, asg->name) == var) return 0;
+    }
+    return step;
+}
+
+} // namespace gwbasic
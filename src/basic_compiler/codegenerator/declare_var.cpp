@@ -0,0 +1,25 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::declareVar(const SymbolId sym) {
+    /*
+     * Function: CodeGenerator::declareVar
+     * Inputs:
+     *  - sym: variable symbol (from symbolOf)
+     * Outputs:
+     *  - void (records an assigned variable once)
+     * Theory of operation:
+     *  - Slots are handed out in first-assignment order; they index the
+     *    current-value table and every edge's value list. Variables that are
+     *    only read never get a slot and always read as zero. A slot's type
+     *    comes from the variable's canonical name (typeOfName).
+     */
+    if (varSlot_[sym] >= 0) return;
+    varSlot_[sym] = static_cast<int>(variables_.size());
+    variables_.push_back(sym);
+    slotTypes_.push_back(typeOfName(arena_->symbols().name(sym)));
+}
+
+} // namespace gwbasic
@@ -0,0 +1,29 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+std::string CodeGenerator::edgeTo(int lineIndex, int stmt) {
+    /*
+     * Function: CodeGenerator::edgeTo
+     * Inputs:
+     *  - lineIndex: dense index of the leader line jumped to
+     *  - stmt: index of the jumping statement in the current line
+     * Outputs:
+     *  - std::string: label to branch to
+     * Theory of operation:
+     *  - Forward edges branch straight to the line; the current block and
+     *    values are recorded for the target's phis. Back edges branch to the
+     *    edge block planJoins named; the caller emits it with emitBackEdge
+     *    right after the branch.
+     */
+    if (lineIndex > currentIndex_) {
+        lineEdges_[static_cast<std::size_t>(lineIndex)].push_back({curBlock_, values_});
+        return lineLabelName(cfg_.number(lineIndex));
+    }
+    std::string label = lineLabelName(cfg_.number(lineIndex));
+    label += "_from"; label += std::to_string(cfg_.number(currentIndex_)); label += '_'; label += std::to_string(stmt);
+    return label;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,29 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitBackEdge(IrSink& out, const std::string& label, int lineIndex) {
+    /*
+     * Function: CodeGenerator::emitBackEdge
+     * Inputs:
+     *  - out: IR stream
+     *  - label: edge block label from edgeTo
+     *  - lineIndex: dense index of the target line
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - The target's phis already name this block's outgoing values
+     *    ("%X.<label>"), so each is defined here as a no-op bitcast of the
+     *    current value (free at -O0, folded away when optimizing).
+     */
+    beginBlock(out, label);
+    for (int s = 0; s < static_cast<int>(variables_.size()); ++s) {
+        std::string ir = "  "; ir += ssaName(s, label); ir += " = bitcast "; ir += slotType(s); ir += ' '; ir += values_[static_cast<std::size_t>(s)]; ir += " to "; ir += slotType(s);
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " BackEdge -> ", ir);
+    }
+    std::string ir = "  br label %"; ir += lineLabelName(cfg_.number(lineIndex));
+    out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " BackEdge -> ", ir);
+}
+
+} // namespace gwbasic
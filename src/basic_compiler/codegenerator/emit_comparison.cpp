@@ -1,10 +1,9 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-std::string CodeGenerator::emitComparison(std::ostringstream& out, const BinaryExpr* c) {
+std::string CodeGenerator::emitComparison(IrSink& out, const BinaryExpr* c) {
     /*
      * Function: CodeGenerator::emitComparison
      * Inputs:
@@ -13,26 +12,29 @@ std::string CodeGenerator::emitComparison(std::ostringstream& out, const BinaryE
      * Outputs:
      *  - std::string: name of the i1 result register
      * Theory of operation:
-     *  - Emits code to evaluate both operands as double, then performs an
-     *    IEEE-754 ordered comparison using the appropriate fcmp predicate.
+     *  - Both operands are evaluated in the wider of their types (double
+     *    when both are flexible literals), then compared with icmp for Int
+     *    or an IEEE-754 ordered fcmp for Single/Double.
      */
-    const auto lhsReg = emitExpr(out, c->lhs.get(), "cmp");
-    const auto rhsReg = emitExpr(out, c->rhs.get(), "cmp");
+    const NumType t = c->lhs->flexible && c->rhs->flexible ? NumType::Double : wider(c->lhs->type, c->rhs->type);
+    const auto lhsReg = emitExpr(out, c->lhs.get(), t);
+    const auto rhsReg = emitExpr(out, c->rhs.get(), t);
     std::string res = nextTemp();
+    const bool isInt = t == NumType::Int;
     const char* pred = nullptr;
     switch (c->op) {
-        case BinaryOp::Eq: pred = "oeq"; break;
-        case BinaryOp::Ne: pred = "one"; break;
-        case BinaryOp::Lt: pred = "olt"; break;
-        case BinaryOp::Le: pred = "ole"; break;
-        case BinaryOp::Gt: pred = "ogt"; break;
-        case BinaryOp::Ge: pred = "oge"; break;
+        case BinaryOp::Eq: pred = isInt ? "eq" : "oeq"; break;
+        case BinaryOp::Ne: pred = isInt ? "ne" : "one"; break;
+        case BinaryOp::Lt: pred = isInt ? "slt" : "olt"; break;
+        case BinaryOp::Le: pred = isInt ? "sle" : "ole"; break;
+        case BinaryOp::Gt: pred = isInt ? "sgt" : "ogt"; break;
+        case BinaryOp::Ge: pred = isInt ? "sge" : "oge"; break;
         default: throw CodeGenError("Invalid comparison operator");
     }
     {
-        std::string ir = "  "; ir += res; ir += " = fcmp "; ir += pred; ir += " double "; ir += lhsReg; ir += ", "; ir += rhsReg;
+        std::string ir = "  "; ir += res; ir += isInt ? " = icmp " : " = fcmp "; ir += pred; ir += ' '; ir += irType(t); ir += ' '; ir += lhsReg; ir += ", "; ir += rhsReg;
         out << ir << "\n";
-        std::ostringstream m; m << "line " << currentLine_ << " Compare -> " << ir; log(m.str());
+        GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " Compare -> ", ir);
     }
     return res;
 }
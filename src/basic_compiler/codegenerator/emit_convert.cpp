@@ -0,0 +1,40 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+std::string CodeGenerator::emitConvert(IrSink& out, const std::string& v, const NumType from, const NumType to) {
+    /*
+     * Function: CodeGenerator::emitConvert
+     * Inputs:
+     *  - out: IR stream
+     *  - v: value of computation type irType(from)
+     *  - from/to: source and destination types
+     * Outputs:
+     *  - std::string: v itself when the types match, else the new register
+     * Theory of operation:
+     *  - Int -> float is sitofp; Single <-> Double is fpext/fptrunc. Float ->
+     *    Int rounds to nearest (ties to even, the default rounding mode)
+     *    with llvm.rint before fptosi, as GW-BASIC rounds on assignment to
+     *    an integer rather than truncating.
+     */
+    if (from == to) return v;
+    std::string src = v;
+    const char* op = "sitofp";
+    if (to == NumType::Int) {
+        const bool single = from == NumType::Single;
+        std::string rounded = nextTemp();
+        std::string ir = "  "; ir += rounded; ir += single ? " = call float @llvm.rint.f32(float " : " = call double @llvm.rint.f64(double "; ir += v; ir += ')';
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " Convert -> ", ir);
+        src = std::move(rounded);
+        op = "fptosi";
+    } else if (from != NumType::Int) {
+        op = to == NumType::Double ? "fpext" : "fptrunc";
+    }
+    std::string res = nextTemp();
+    std::string ir = "  "; ir += res; ir += " = "; ir += op; ir += ' '; ir += irType(from); ir += ' '; ir += src; ir += " to "; ir += irType(to);
+    out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " Convert -> ", ir);
+    return res;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,143 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <algorithm>
+
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitCountedFor(IrSink& out, const ForStmt* fs, const long long step, const std::string& currLineLabel, int& localCounter) {
+    /*
+     * Function: CodeGenerator::emitCountedFor
+     * Inputs:
+     *  - out: IR stream
+     *  - fs: ForStmt node accepted by countedLoopStep
+     *  - step: positive loop step from countedLoopStep
+     *  - currLineLabel: label base for naming blocks
+     *  - localCounter: reference counter to make unique labels
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - Emits the loop in rotated form over an i64 induction variable
+     *    holding the counter's value: a guard (start <= end) skips the
+     *    loop; the preheader computes the value after the last iteration,
+     *    start + ((end - start) / step + 1) * step, i.e. the trip count;
+     *    the body runs first and the latch compares the stepped value with
+     *    that stop value (icmp ne). This is the canonical counted-loop shape
+     *    LLVM's loop passes (unrolling, vectorization) expect.
+     *  - The BASIC variable is materialized from the induction variable
+     *    (sitofp, or trunc for Int) at the top of the body only when the
+     *    body reads it, and once after the loop, where it holds the start
+     *    value or the stop value as the general form would.
+     *  - Variables the body assigns are carried through phis in the body
+     *    and end blocks, as in emitFor.
+     */
+    std::string loopId = std::to_string(++localCounter);
+    std::string preLbl  = currLineLabel; preLbl  += "_for_pre";  preLbl  += loopId;
+    std::string bodyLbl = currLineLabel; bodyLbl += "_for_body"; bodyLbl += loopId;
+    std::string incLbl  = currLineLabel; incLbl  += "_for_inc";  incLbl  += loopId;
+    std::string endLbl  = currLineLabel; endLbl  += "_for_end";  endLbl  += loopId;
+
+    const SymbolId var = symbolOf(fs->varSym, fs->var);
+    const int varSlot = varSlot_[var];
+    const NumType varType = slotTypes_[static_cast<std::size_t>(varSlot)];
+    std::vector<int> carried;
+    bool readsVar = false;
+    for (const auto& s : fs->body) {
+        if (s->kind == StmtKind::Assign) {
+            const auto* asg = static_cast<const AssignStmt*>(s.get());
+            readsVar = readsVar || exprReads(asg->value.get(), var);
+            const int slot = varSlot_[symbolOf(asg->sym, asg->name)];
+            if (std::find(carried.begin(), carried.end(), slot) == carried.end()) carried.push_back(slot);
+        } else if (s->kind == StmtKind::Print) {
+            readsVar = readsVar || exprReads(static_cast<const PrintStmt*>(s.get())->value.get(), var);
+        }
+    }
+    auto emit = [&](const std::string& ir) { out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt -> ", ir); };
+    auto materialize = [&](const std::string& iv) {
+        std::string res = nextTemp();
+        std::string ir = "  "; ir += res;
+        ir += varType == NumType::Int ? " = trunc i64 " : " = sitofp i64 "; ir += iv; ir += " to "; ir += storageType(varType);
+        emit(ir);
+        return res;
+    };
+    const std::string stepText = std::to_string(step);
+
+    const std::string start = emitIndex(out, fs->start.get());
+    if (exprReads(fs->end.get(), var)) values_[static_cast<std::size_t>(varSlot)] = materialize(start); // "TO I + 5" sees the start
+    const std::string end = emitIndex(out, fs->end.get());
+    const std::string guard = nextTemp();
+    { std::string ir = "  "; ir += guard; ir += " = icmp sle i64 "; ir += start; ir += ", "; ir += end; emit(ir); }
+    { std::string ir = "  br i1 "; ir += guard; ir += ", label %"; ir += preLbl; ir += ", label %"; ir += endLbl; emit(ir); }
+    const std::string guardBlock = curBlock_;
+    std::vector<std::string> before;
+    for (const int slot : carried) before.push_back(values_[static_cast<std::size_t>(slot)]);
+
+    beginBlock(out, preLbl);
+    std::string stop;
+    if (step == 1) {
+        stop = nextTemp();
+        std::string ir = "  "; ir += stop; ir += " = add nsw i64 "; ir += end; ir += ", 1"; emit(ir);
+    } else {
+        const std::string span = nextTemp();
+        { std::string ir = "  "; ir += span; ir += " = sub nsw i64 "; ir += end; ir += ", "; ir += start; emit(ir); }
+        const std::string trips = nextTemp();
+        { std::string ir = "  "; ir += trips; ir += " = udiv i64 "; ir += span; ir += ", "; ir += stepText; emit(ir); }
+        const std::string last = nextTemp();
+        { std::string ir = "  "; ir += last; ir += " = mul nsw i64 "; ir += trips; ir += ", "; ir += stepText; emit(ir); }
+        const std::string lastValue = nextTemp();
+        { std::string ir = "  "; ir += lastValue; ir += " = add nsw i64 "; ir += start; ir += ", "; ir += last; emit(ir); }
+        stop = nextTemp();
+        std::string ir = "  "; ir += stop; ir += " = add nsw i64 "; ir += lastValue; ir += ", "; ir += stepText; emit(ir);
+    }
+    { std::string ir = "  br label %"; ir += bodyLbl; emit(ir); }
+
+    beginBlock(out, bodyLbl);
+    const std::string iv = ssaName(varSlot, bodyLbl);
+    const std::string next = ssaName(varSlot, incLbl);
+    {
+        std::string ir = "  "; ir += iv; ir += " = phi i64 [ "; ir += start; ir += ", %"; ir += preLbl;
+        ir += " ], [ "; ir += next; ir += ", %"; ir += incLbl; ir += " ]";
+        emit(ir);
+    }
+    for (std::size_t k = 0; k < carried.size(); ++k) {
+        const int slot = carried[k];
+        std::string phi = ssaName(slot, bodyLbl);
+        std::string ir = "  "; ir += phi; ir += " = phi "; ir += slotType(slot); ir += " [ "; ir += before[k]; ir += ", %"; ir += preLbl;
+        ir += " ], [ "; ir += ssaName(slot, incLbl); ir += ", %"; ir += incLbl; ir += " ]";
+        emit(ir);
+        values_[static_cast<std::size_t>(slot)] = std::move(phi);
+    }
+    if (readsVar) values_[static_cast<std::size_t>(varSlot)] = materialize(iv);
+    emitForBody(out, fs);
+    { std::string ir = "  br label %"; ir += incLbl; emit(ir); }
+
+    beginBlock(out, incLbl);
+    for (const int slot : carried) {
+        std::string ir = "  "; ir += ssaName(slot, incLbl); ir += " = bitcast "; ir += slotType(slot); ir += ' ';
+        ir += values_[static_cast<std::size_t>(slot)]; ir += " to "; ir += slotType(slot);
+        emit(ir);
+    }
+    { std::string ir = "  "; ir += next; ir += " = add nsw i64 "; ir += iv; ir += ", "; ir += stepText; emit(ir); }
+    const std::string more = nextTemp();
+    { std::string ir = "  "; ir += more; ir += " = icmp ne i64 "; ir += next; ir += ", "; ir += stop; emit(ir); }
+    { std::string ir = "  br i1 "; ir += more; ir += ", label %"; ir += bodyLbl; ir += ", label %"; ir += endLbl; emit(ir); }
+
+    beginBlock(out, endLbl);
+    const std::string final = ssaName(varSlot, endLbl);
+    {
+        std::string ir = "  "; ir += final; ir += " = phi i64 [ "; ir += start; ir += ", %"; ir += guardBlock;
+        ir += " ], [ "; ir += next; ir += ", %"; ir += incLbl; ir += " ]";
+        emit(ir);
+    }
+    for (std::size_t k = 0; k < carried.size(); ++k) {
+        const int slot = carried[k];
+        std::string phi = ssaName(slot, endLbl);
+        std::string ir = "  "; ir += phi; ir += " = phi "; ir += slotType(slot); ir += " [ "; ir += before[k]; ir += ", %"; ir += guardBlock;
+        ir += " ], [ "; ir += ssaName(slot, incLbl); ir += ", %"; ir += incLbl; ir += " ]";
+        emit(ir);
+        values_[static_cast<std::size_t>(slot)] = std::move(phi);
+    }
+    values_[static_cast<std::size_t>(varSlot)] = materialize(final);
+}
+
+} // namespace gwbasic
@@ -1,85 +1,121 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-std::string CodeGenerator::emitExpr(std::ostringstream& out, const Expr* e, const std::string&) {
+std::string CodeGenerator::emitExpr(IrSink& out, const Expr* e, const NumType want) {
     /*
      * Function: CodeGenerator::emitExpr
      * Inputs:
-     *  - out: IR output stream
+     *  - out: IR output sink
      *  - e: expression node
-     *  - (unused) block suffix for naming (reserved)
+     *  - want: computation type the caller needs the value in
      * Outputs:
-     *  - std::string: register name or immediate literal used as the result
+     *  - std::string: register name or immediate literal of LLVM type
+     *    irType(want)
      * Theory of operation:
-     *  - Pattern matches the expression type (number, var, unary, binary,
-     *    string) and emits the corresponding LLVM IR instructions, returning
-     *    a name/literal which the caller can use.
+     *  - The node is evaluated in its own type, or, when the type is
+     *    flexible (literals and expressions of literals), in the wider of
+     *    that and want, so "X! * 2" stays in float and "A = 1 + 2" is
+     *    double throughout. Operands are emitted in the operation's type
+     *    and the result is converted to want at the end (emitConvert).
+     *  - Switches on the expression kind (number, var, unary, binary,
+     *    string). A variable read is its current SSA value and emits nothing
+     *    beyond the widening of an i16 Int.
      */
-    if (auto num = dynamic_cast<const NumberExpr*>(e)) {
-        char buf[64];
-        std::snprintf(buf, sizeof(buf), "%.17g", num->value);
-        std::string s(buf);
-        if (s.find('.') == std::string::npos && s.find('e') == std::string::npos && s.find('E') == std::string::npos)
-            s += ".0";
-
-        return s;
-    }
-    if (auto v = dynamic_cast<const VarExpr*>(const_cast<Expr*>(e))) {
-        ensureVarAllocated(out, v->name);
-        std::string a = varAllocaName_[v->name];
-        std::string r = nextTemp();
-        {
-            std::string ir = "  "; ir += r; ir += " = load double, ptr "; ir += a;
-            out << ir << "\n";
-            std::ostringstream m; m << "line " << currentLine_ << " VarExpr(" << v->name << ") -> " << ir; log(m.str());
+    const NumType t = e->flexible ? wider(e->type, want) : e->type;
+    std::string res;
+    switch (e->kind) {
+        case ExprKind::Number: {
+            const auto* num = static_cast<const NumberExpr*>(e);
+            char buf[64];
+            if (t == NumType::Int) {
+                std::snprintf(buf, sizeof(buf), "%.0f", std::nearbyint(num->value));
+                res = buf;
+            } else if (t == NumType::Single) {
+                // float constants are written as the hex of the equivalent double
+                const double widened = static_cast<double>(static_cast<float>(num->value));
+                unsigned long long bits;
+                std::memcpy(&bits, &widened, sizeof(bits));
+                std::snprintf(buf, sizeof(buf), "0x%016llX", bits);
+                res = buf;
+            } else if (!std::isfinite(num->value)) {
+                // LLVM has no decimal spelling for inf/nan; use the bit pattern
+                unsigned long long bits;
+                std::memcpy(&bits, &num->value, sizeof(bits));
+                std::snprintf(buf, sizeof(buf), "0x%016llX", bits);
+                res = buf;
+            } else {
+                // %.17g round-trips; LLVM needs a '.' in the mantissa ("1e+19" is an integer token)
+                std::snprintf(buf, sizeof(buf), "%.17g", num->value);
+                res = buf;
+                if (res.find('.') == std::string::npos) res.insert(std::min(res.find('e'), res.size()), ".0");
+            }
+            break;
         }
-        return r;
-    }
-    if (auto u = dynamic_cast<const UnaryExpr*>(const_cast<Expr*>(e))) {
-        auto inner = emitExpr(out, u->inner.get(), "");
-        if (u->op == '+') return inner;
-        if (u->op == '-') {
-            std::string res = nextTemp();
-            std::string ir = "  "; ir += res; ir += " = fsub double 0.0, "; ir += inner;
+        case ExprKind::Var: {
+            const auto* v = static_cast<const VarExpr*>(e);
+            const std::string& r = valueOf(symbolOf(v->sym, v->name));
+            GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " VarExpr(", v->name, ") -> ", r);
+            res = t == NumType::Int ? emitWiden(out, r) : r;
+            break;
+        }
+        case ExprKind::Unary: {
+            const auto* u = static_cast<const UnaryExpr*>(e);
+            auto inner = emitExpr(out, u->inner.get(), t);
+            if (u->op == '+') { res = std::move(inner); break; }
+            if (u->op != '-') throw CodeGenError("Unknown expression kind");
+            res = nextTemp();
+            std::string ir = "  "; ir += res;
+            ir += t == NumType::Int ? " = sub i32 0, " : t == NumType::Single ? " = fsub float 0.0, " : " = fsub double 0.0, ";
+            ir += inner;
             out << ir << "\n";
-            std::ostringstream m; m << "line " << currentLine_ << " UnaryExpr(-) -> " << ir; log(m.str());
-            return res;
+            GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " UnaryExpr(-) -> ", ir);
+            break;
         }
-    }
-    if (auto b = dynamic_cast<const BinaryExpr*>(const_cast<Expr*>(e))) {
-        if (b->op == BinaryOp::Eq || b->op == BinaryOp::Ne || b->op == BinaryOp::Lt || b->op == BinaryOp::Le || b->op == BinaryOp::Gt || b->op == BinaryOp::Ge) {
-            std::string i1 = emitComparison(out, b);
-            std::string i1z = nextTemp();
-            {
-                std::string ir = "  "; ir += i1z; ir += " = uitofp i1 "; ir += i1; ir += " to double";
-                out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " BinaryExpr(cmp) -> " << ir; log(m.str()); }
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            if (b->op >= BinaryOp::Eq) {
+                std::string i1 = emitComparison(out, b);
+                res = nextTemp();
+                std::string ir = "  "; ir += res; ir += t == NumType::Int ? " = zext i1 " : " = uitofp i1 "; ir += i1; ir += " to "; ir += irType(t);
+                out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " BinaryExpr(cmp) -> ", ir);
+                break;
+            }
+            auto L = emitExpr(out, b->lhs.get(), t);
+            auto R = emitExpr(out, b->rhs.get(), t);
+            const bool isInt = t == NumType::Int;
+            const char* opcode = nullptr;
+            const char* sym = nullptr;
+            switch (b->op) {
+                case BinaryOp::Add: opcode = isInt ? "add" : "fadd"; sym = "+"; break;
+                case BinaryOp::Sub: opcode = isInt ? "sub" : "fsub"; sym = "-"; break;
+                case BinaryOp::Mul: opcode = isInt ? "mul" : "fmul"; sym = "*"; break;
+                case BinaryOp::Div: opcode = "fdiv"; sym = "/"; break; // '/' is never Int (BinaryExpr::retype)
+                default: throw CodeGenError("Unsupported binary op in arithmetic");
             }
-            return i1z;
+            res = nextTemp();
+            std::string ir = "  "; ir += res; ir += " = "; ir += opcode; ir += ' '; ir += irType(t); ir += ' '; ir += L; ir += ", "; ir += R;
+            out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " BinaryExpr(", sym, ") -> ", ir);
+            break;
         }
-        auto L = emitExpr(out, b->lhs.get(), "");
-        auto R = emitExpr(out, b->rhs.get(), "");
-        std::string res = nextTemp();
-        switch (b->op) {
-            case BinaryOp::Add: { std::string ir = "  "; ir += res; ir += " = fadd double "; ir += L; ir += ", "; ir += R; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " BinaryExpr(+) -> " << ir; log(m.str()); } break; }
-            case BinaryOp::Sub: { std::string ir = "  "; ir += res; ir += " = fsub double "; ir += L; ir += ", "; ir += R; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " BinaryExpr(-) -> " << ir; log(m.str()); } break; }
-            case BinaryOp::Mul: { std::string ir = "  "; ir += res; ir += " = fmul double "; ir += L; ir += ", "; ir += R; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " BinaryExpr(*) -> " << ir; log(m.str()); } break; }
-            case BinaryOp::Div: { std::string ir = "  "; ir += res; ir += " = fdiv double "; ir += L; ir += ", "; ir += R; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " BinaryExpr(/) -> " << ir; log(m.str()); } break; }
-            default: throw CodeGenError("Unsupported binary op in arithmetic");
+        case ExprKind::String: {
+            const auto* s = static_cast<const StringExpr*>(e);
+            const int id = strLiteralId_[symbolOf(s->sym, s->value)];
+            std::string gep = nextTemp();
+            std::string ir = "  "; ir += gep; ir += " = getelementptr inbounds i8, ptr "; ir += globalStringName(id); ir += ", i64 0";
+            out << ir << "\n";
+            GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " StringExpr -> ", ir);
+            return gep;
         }
-        return res;
-    }
-    if (auto s = dynamic_cast<const StringExpr*>(const_cast<Expr*>(e))) {
-        int id = strLiteralId_[s->value];
-        std::string gep = nextTemp();
-        std::string ir = "  "; ir += gep; ir += " = getelementptr inbounds i8, ptr "; ir += globalStringName(id); ir += ", i64 0";
-        out << ir << "\n";
-        std::ostringstream m; m << "line " << currentLine_ << " StringExpr -> " << ir; log(m.str());
-        return gep;
+        default:
+            throw CodeGenError("Unknown expression kind");
     }
-    throw CodeGenError("Unknown expression kind");
+    return emitConvert(out, res, t, want);
 }
 
 } // namespace gwbasic
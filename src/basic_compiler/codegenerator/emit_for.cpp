@@ -1,10 +1,11 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <algorithm>
+
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-void CodeGenerator::emitFor(std::ostringstream& out, const ForStmt* fs, const std::string& currLineLabel, int& localCounter) {
+void CodeGenerator::emitFor(IrSink& out, const ForStmt* fs, const std::string& currLineLabel, int& localCounter) {
     /*
      * Function: CodeGenerator::emitFor
      * Inputs:
@@ -16,79 +17,94 @@ void CodeGenerator::emitFor(std::ostringstream& out, const ForStmt* fs, const st
      *  - void
      * Theory of operation:
      *  - Emits a standard counted FOR loop structure: init, cond, body, inc,
-     *    end. Uses double precision arithmetic and inclusive end condition.
+     *    end, with an inclusive end condition. The limit and step are
+     *    evaluated once in the preheader, as GW-BASIC does, so the loop
+     *    blocks only compare and add. Start, end and step are
+     *    computed in the loop variable's type: an Int counter is compared
+     *    with icmp and stepped in i32 before narrowing back to i16.
+     *  - Loops with integral bounds and a constant step go through
+     *    emitCountedFor instead (see countedLoopStep).
+     *  - The loop variable and every variable the body assigns are carried
+     *    around the loop: the cond block has a phi for each, fed from the
+     *    preheader and from the inc block, and after the loop they hold the
+     *    cond phis (the value that failed the test).
      */
+    if (const long long step = countedLoopStep(fs)) {
+        emitCountedFor(out, fs, step, currLineLabel, localCounter);
+        return;
+    }
     std::string loopId = std::to_string(++localCounter);
     std::string condLbl = currLineLabel; condLbl += "_for_cond"; condLbl += loopId;
     std::string bodyLbl = currLineLabel; bodyLbl += "_for_body"; bodyLbl += loopId;
     std::string incLbl  = currLineLabel; incLbl  += "_for_inc";  incLbl  += loopId;
     std::string endLbl  = currLineLabel; endLbl  += "_for_end";  endLbl  += loopId;
 
-    ensureVarAllocated(out, fs->var);
-    {
-        std::string startReg = emitExpr(out, fs->start.get(), currLineLabel);
-        std::string ir1 = "  store double "; ir1 += startReg; ir1 += ", ptr "; ir1 += varAllocaName_[fs->var];
-        out << ir1 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt init -> " << ir1; log(m.str()); }
-        std::string ir2 = "  br label %"; ir2 += condLbl;
-        out << ir2 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt -> " << ir2; log(m.str()); }
+    const SymbolId var = symbolOf(fs->varSym, fs->var);
+    const int varSlot = varSlot_[var];
+    const NumType varType = slotTypes_[static_cast<std::size_t>(varSlot)];
+    const bool isInt = varType == NumType::Int;
+    std::vector<int> carried{varSlot};
+    for (const auto& s : fs->body) {
+        if (s->kind != StmtKind::Assign) continue;
+        const auto* asg = static_cast<const AssignStmt*>(s.get());
+        const int slot = varSlot_[symbolOf(asg->sym, asg->name)];
+        if (std::find(carried.begin(), carried.end(), slot) == carried.end()) carried.push_back(slot);
     }
 
-    out << condLbl << ":\n";
-    std::string curVal = nextTemp();
+    assign(var, emitValueFor(out, fs->start.get(), var));
+    // GW-BASIC evaluates the limit and step once, after assigning the start
+    const std::string endReg = emitExpr(out, fs->end.get(), varType);
+    const std::string stepReg = fs->step ? emitExpr(out, fs->step.get(), varType) : std::string(isInt ? "1" : "1.0");
+    const std::string preBlock = curBlock_;
     {
-        std::string ir = "  "; ir += curVal; ir += " = load double, ptr "; ir += varAllocaName_[fs->var];
-        out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt cond load -> " << ir; log(m.str()); }
+        std::string ir = "  br label %"; ir += condLbl;
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt -> ", ir);
+    }
+
+    beginBlock(out, condLbl);
+    for (const int slot : carried) {
+        std::string phi = ssaName(slot, condLbl);
+        std::string ir = "  "; ir += phi; ir += " = phi "; ir += slotType(slot); ir += " [ "; ir += values_[static_cast<std::size_t>(slot)]; ir += ", %"; ir += preBlock;
+        ir += " ], [ "; ir += ssaName(slot, incLbl); ir += ", %"; ir += incLbl; ir += " ]";
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt cond phi -> ", ir);
+        values_[static_cast<std::size_t>(slot)] = std::move(phi);
     }
+    std::vector<std::string> atCond;
+    for (const int slot : carried) atCond.push_back(values_[static_cast<std::size_t>(slot)]);
     {
-        std::string endReg = emitExpr(out, fs->end.get(), currLineLabel);
+        std::string cur = values_[static_cast<std::size_t>(varSlot)];
+        if (isInt) cur = emitWiden(out, cur);
         std::string cond = nextTemp();
-        std::string ir1 = "  "; ir1 += cond; ir1 += " = fcmp ole double "; ir1 += curVal; ir1 += ", "; ir1 += endReg;
-        out << ir1 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt cond cmp -> " << ir1; log(m.str()); }
+        std::string ir1 = "  "; ir1 += cond; ir1 += isInt ? " = icmp sle " : " = fcmp ole "; ir1 += irType(varType); ir1 += ' '; ir1 += cur; ir1 += ", "; ir1 += endReg;
+        out << ir1 << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt cond cmp -> ", ir1);
         std::string ir2 = "  br i1 "; ir2 += cond; ir2 += ", label %"; ir2 += bodyLbl; ir2 += ", label %"; ir2 += endLbl;
-        out << ir2 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt branch -> " << ir2; log(m.str()); }
+        out << ir2 << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt branch -> ", ir2);
     }
 
-    out << bodyLbl << ":\n";
-    for (const auto& s : fs->body) {
-        if (auto asg = dynamic_cast<AssignStmt*>(s.get())) {
-            std::string val = emitExpr(out, asg->value.get(), currLineLabel);
-            std::string ir = "  store double "; ir += val; ir += ", ptr "; ir += varAllocaName_[asg->name];
-            out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt body Assign -> " << ir; log(m.str()); }
-        } else if (auto pr = dynamic_cast<PrintStmt*>(s.get())) {
-            if (dynamic_cast<StringExpr*>(pr->value.get())) {
-                int id = strLiteralId_[dynamic_cast<StringExpr*>(pr->value.get())->value];
-                std::string sptr = nextTemp();
-              std::string ir1 = "  "; ir1 += sptr; ir1 += " = getelementptr inbounds i8, ptr "; ir1 += globalStringName(id); ir1 += ", i64 0";
-              out << ir1 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt body Print -> " << ir1; log(m.str()); }
-              std::string fmt = nextTemp();
-              std::string ir2 = "  "; ir2 += fmt; ir2 += " = getelementptr inbounds i8, ptr @.fmt_str, i64 0";
-              out << ir2 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt body Print -> " << ir2; log(m.str()); }
-              std::string ir3 = "  call i32 (ptr, ...) @printf(ptr "; ir3 += fmt; ir3 += ", ptr "; ir3 += sptr; ir3 += ")";
-              out << ir3 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt body Print -> " << ir3; log(m.str()); }
-            } else {
-                auto val = emitExpr(out, pr->value.get(), currLineLabel);
-              std::string fmt = nextTemp();
-              std::string ir1 = "  "; ir1 += fmt; ir1 += " = getelementptr inbounds i8, ptr @.fmt_num, i64 0";
-              out << ir1 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt body Print -> " << ir1; log(m.str()); }
-              std::string ir2 = "  call i32 (ptr, ...) @printf(ptr "; ir2 += fmt; ir2 += ", double "; ir2 += val; ir2 += ")";
-              out << ir2 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt body Print -> " << ir2; log(m.str()); }
-            }
+    beginBlock(out, bodyLbl);
+    emitForBody(out, fs);
+    out << "  br label %" << incLbl << "\n";
+
+    beginBlock(out, incLbl);
+    for (const int slot : carried) {
+        std::string ir = "  "; ir += ssaName(slot, incLbl);
+        if (slot == varSlot && isInt) {
+            const std::string cur = emitWiden(out, values_[static_cast<std::size_t>(slot)]);
+            std::string sum = nextTemp();
+            std::string add = "  "; add += sum; add += " = add i32 "; add += cur; add += ", "; add += stepReg;
+            out << add << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt inc -> ", add);
+            ir += " = trunc i32 "; ir += sum; ir += " to i16";
+        } else if (slot == varSlot) {
+            ir += " = fadd "; ir += irType(varType); ir += ' '; ir += values_[static_cast<std::size_t>(slot)]; ir += ", "; ir += stepReg;
         } else {
-            throw CodeGenError("Unsupported statement in FOR body");
+            ir += " = bitcast "; ir += slotType(slot); ir += ' '; ir += values_[static_cast<std::size_t>(slot)]; ir += " to "; ir += slotType(slot);
         }
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt inc -> ", ir);
     }
-    out << "  br label %" << incLbl << "\n";
-
-    out << incLbl << ":\n";
-    std::string stepReg = fs->step ? emitExpr(out, fs->step.get(), currLineLabel) : std::string("1.0");
-    std::string vcur = nextTemp();
-    { std::string ir = "  "; ir += vcur; ir += " = load double, ptr "; ir += varAllocaName_[fs->var]; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt inc load -> " << ir; log(m.str()); } }
-    std::string vnext = nextTemp();
-    { std::string ir = "  "; ir += vnext; ir += " = fadd double "; ir += vcur; ir += ", "; ir += stepReg; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt inc add -> " << ir; log(m.str()); } }
-    { std::string ir = "  store double "; ir += vnext; ir += ", ptr "; ir += varAllocaName_[fs->var]; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt inc store -> " << ir; log(m.str()); } }
-    { std::string ir = "  br label %"; ir += condLbl; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ForStmt -> " << ir; log(m.str()); } }
+    { std::string ir = "  br label %"; ir += condLbl; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt -> ", ir); }
 
-    out << endLbl << ":\n";
+    beginBlock(out, endLbl);
+    for (std::size_t k = 0; k < carried.size(); ++k) values_[static_cast<std::size_t>(carried[k])] = atCond[k];
 }
 
 } // namespace gwbasic
@@ -0,0 +1,37 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitForBody(IrSink& out, const ForStmt* fs) {
+    /*
+     * Function: CodeGenerator::emitForBody
+     * Inputs:
+     *  - out: IR stream (inside the loop's body block)
+     *  - fs: ForStmt node
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - Lowers the single-line body: assignments rebind SSA values and
+     *    PRINTs call the output runtime (emitPrint). Bodies never open
+     *    blocks, so the body is one basic block. Any other statement raises
+     *    CodeGenError.
+     */
+    for (const auto& s : fs->body) {
+        switch (s->kind) {
+            case StmtKind::Assign: {
+                const auto* asg = static_cast<const AssignStmt*>(s.get());
+                const SymbolId sym = symbolOf(asg->sym, asg->name);
+                assign(sym, emitValueFor(out, asg->value.get(), sym));
+                break;
+            }
+            case StmtKind::Print:
+                emitPrint(out, static_cast<const PrintStmt*>(s.get()));
+                break;
+            default:
+                throw CodeGenError("Unsupported statement in FOR body");
+        }
+    }
+}
+
+} // namespace gwbasic
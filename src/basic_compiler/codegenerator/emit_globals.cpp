@@ -1,39 +1,29 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-void CodeGenerator::emitGlobals(std::ostringstream& out) {
+void CodeGenerator::emitGlobals(IrSink& out) {
     /*
      * Function: CodeGenerator::emitGlobals
      * Inputs:
-     *  - out: IR output stream
+     *  - out: IR output sink
      * Outputs:
      *  - void
      * Theory of operation:
-     *  - Emits format strings and all discovered string literals as constant
-     *    global arrays with unnamed_addr for efficient addressing.
+     *  - Emits format strings (rt_print_num falls back to "%f\n" for
+     *    values its fast path does not cover) and all discovered string
+     *    literals (in literal id order) as constant global arrays with
+     *    unnamed_addr for efficient addressing.
      */
     out << "@.fmt_num = private unnamed_addr constant [4 x i8] c\"%f\\0A\\00\"\n";
-    out << "@.fmt_str = private unnamed_addr constant [4 x i8] c\"%s\\0A\\00\"\n";
     out << "@.fmt_in = private unnamed_addr constant [4 x i8] c\"%lf\\00\"\n";
-    for (const auto&[fst, snd] : strLiteralId_) {
-        const std::string& s = fst;
-        const int id = snd;
+    for (int id = 0; id < static_cast<int>(strLiterals_.size()); ++id) {
+        const std::string s(arena_->symbols().name(strLiterals_[id]));
         std::string esc = escapeForIR(s);
         const size_t N = s.size() + 1;
         out << globalStringName(id) << " = private unnamed_addr constant [" << N << " x i8] c\"" << esc << "\\00\"\n";
-        {
-            std::string msg;
-            msg.reserve(32 + s.size());
-            msg = "emitGlobals: literal @";
-            msg += globalStringName(id);
-            msg += " from StringExpr \"";
-            msg += s;
-            msg += "\"";
-            log(msg);
-        }
+        GWBASIC_LOG(codegenLog_, Debug, "emitGlobals: literal @", globalStringName(id), " from StringExpr \"", s, '"');
     }
     out << "\n";
 }
@@ -0,0 +1,63 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitGosub(IrSink& out, const GosubStmt* gs, int stmt, const std::string& currLineLabel, int& localCounter) {
+    /*
+     * Function: CodeGenerator::emitGosub
+     * Inputs:
+     *  - out: IR stream
+     *  - gs: GosubStmt node
+     *  - stmt: index of the GOSUB in the current line (names back edges)
+     *  - currLineLabel: label base for naming blocks
+     *  - localCounter: reference counter to make unique labels
+     * Outputs:
+     *  - void (control continues in the returned-to block)
+     * Theory of operation:
+     *  - Tiny leaf subroutines and missing targets are expanded inline
+     *    between entry/cont labels. Otherwise the continuation becomes a new
+     *    return site: its id is pushed onto %gosub.stack and control branches
+     *    to the target line; RETURN reaches the continuation through
+     *    emitReturnDispatch. Overflowing kGosubDepth ends the program.
+     *    Variables in the continuation are the dispatcher's %X.ret phis.
+     */
+    const std::string id = std::to_string(++localCounter);
+    std::string contLbl = currLineLabel; contLbl += "_gosub_cont"; contLbl += id;
+    if (!findLine(gs->targetLine) || isTinyLeafSubroutine(gs->targetLine)) {
+        std::string entryLbl = currLineLabel; entryLbl += "_gosub_entry"; entryLbl += id;
+        { std::string ir = "  br label %"; ir += entryLbl; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+        emitSubroutineInline(out, gs->targetLine, entryLbl, contLbl);
+        currentLine_ = cfg_.number(currentIndex_);
+        beginBlock(out, contLbl);
+        return;
+    }
+
+    returnSites_.push_back(contLbl);
+    const std::string site = std::to_string(returnSites_.size());
+    const std::string depth = std::to_string(kGosubDepth);
+    std::string pushLbl = currLineLabel; pushLbl += "_gosub_push"; pushLbl += id;
+
+    std::string sp = nextTemp();
+    { std::string ir = "  "; ir += sp; ir += " = load i32, ptr %gosub.sp"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+    std::string full = nextTemp();
+    { std::string ir = "  "; ir += full; ir += " = icmp uge i32 "; ir += sp; ir += ", "; ir += depth; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+    { std::string ir = "  br i1 "; ir += full; ir += ", label %exit, label %"; ir += pushLbl; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+
+    beginBlock(out, pushLbl);
+    std::string slot = nextTemp();
+    { std::string ir = "  "; ir += slot; ir += " = getelementptr inbounds ["; ir += depth; ir += " x i32], ptr %gosub.stack, i32 0, i32 "; ir += sp; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+    { std::string ir = "  store i32 "; ir += site; ir += ", ptr "; ir += slot; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+    std::string next = nextTemp();
+    { std::string ir = "  "; ir += next; ir += " = add i32 "; ir += sp; ir += ", 1"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+    { std::string ir = "  store i32 "; ir += next; ir += ", ptr %gosub.sp"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+    const int target = cfg_.indexOf(gs->targetLine);
+    const std::string dest = edgeTo(target, stmt);
+    { std::string ir = "  br label %"; ir += dest; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GosubStmt -> ", ir); }
+    if (target <= currentIndex_) emitBackEdge(out, dest, target);
+
+    beginBlock(out, contLbl);
+    for (int s = 0; s < static_cast<int>(variables_.size()); ++s) values_[static_cast<std::size_t>(s)] = ssaName(s, "ret");
+}
+
+} // namespace gwbasic
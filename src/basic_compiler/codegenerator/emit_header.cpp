@@ -1,24 +1,36 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <algorithm>
+
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-void CodeGenerator::emitHeader(std::ostringstream& out) {
+void CodeGenerator::emitHeader(IrSink& out) {
     /*
      * Function: CodeGenerator::emitHeader
      * Inputs:
-     *  - out: IR output stream to append to
+     *  - out: IR output sink to append to
      * Outputs:
      *  - void
      * Theory of operation:
-     *  - Writes a generation banner and external declarations (printf/scanf)
-     *    needed by the emitted IR.
+     *  - Writes a generation banner and external declarations (scanf, and
+     *    write/snprintf/memcpy for the output runtime when the program
+     *    prints) needed by the emitted IR, plus the rounding intrinsics
+     *    used to convert to Int when the program has Int variables.
      */
     out << ";; Generated by gwbasic::CodeGenerator\n\n";
-    out << "declare i32 @printf(ptr, ...)\n";
-    out << "declare i32 @scanf(ptr, ...)\n\n";
-    log("emitHeader: declared printf/scanf");
+    out << "declare i32 @scanf(ptr, ...)\n";
+    if (usesPrint_) {
+        out << "declare i64 @write(i32, ptr, i64)\n";
+        out << "declare i32 @snprintf(ptr, i64, ptr, ...)\n";
+        out << "declare void @llvm.memcpy.p0.p0.i64(ptr, ptr, i64, i1)\n";
+    }
+    if (std::find(slotTypes_.begin(), slotTypes_.end(), NumType::Int) != slotTypes_.end()) {
+        out << "declare float @llvm.rint.f32(float)\n";
+        out << "declare double @llvm.rint.f64(double)\n";
+    }
+    out << "\n";
+    GWBASIC_LOG(codegenLog_, Debug, "emitHeader: declared externals");
 }
 
 } // namespace gwbasic
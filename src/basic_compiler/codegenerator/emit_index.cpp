@@ -0,0 +1,27 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+std::string CodeGenerator::emitIndex(IrSink& out, const Expr* e) {
+    /*
+     * Function: CodeGenerator::emitIndex
+     * Inputs:
+     *  - out: IR stream
+     *  - e: integral loop bound (see countedLoopStep)
+     * Outputs:
+     *  - std::string: the value as i64
+     * Theory of operation:
+     *  - Whole literals are written directly; Int expressions (never
+     *    flexible here) are computed in i32 and sign-extended.
+     */
+    if (const auto* n = astCast<NumberExpr>(e)) return std::to_string(static_cast<long long>(n->value));
+    std::string v = emitExpr(out, e, NumType::Int);
+    if (v.empty() || v.front() != '%') return v;
+    std::string res = nextTemp();
+    std::string ir = "  "; ir += res; ir += " = sext i32 "; ir += v; ir += " to i64";
+    out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ForStmt index -> ", ir);
+    return res;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,58 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitJoin(IrSink& out, int lineIndex) {
+    /*
+     * Function: CodeGenerator::emitJoin
+     * Inputs:
+     *  - out: IR stream (just after the leader's label)
+     *  - lineIndex: dense index of the leader line
+     * Outputs:
+     *  - void (values_ holds each variable's value on entry to the line)
+     * Theory of operation:
+     *  - Without back edges every predecessor is known: a variable that
+     *    arrives with the same value on all of them needs no phi. With back
+     *    edges each variable gets a phi whose back-edge operands are the
+     *    names emitBackEdge will define. A leader with no predecessors at
+     *    all (only reached through inlined GOSUBs) is dead code in the IR.
+     */
+    auto& fwd = lineEdges_[static_cast<std::size_t>(lineIndex)];
+    const auto& back = backEdges_[static_cast<std::size_t>(lineIndex)];
+    const std::string label = lineLabelName(cfg_.number(lineIndex));
+    for (int s = 0; s < static_cast<int>(variables_.size()); ++s) {
+        const auto slot = static_cast<std::size_t>(s);
+        if (fwd.empty() && back.empty()) {
+            values_[slot] = zeroOf(slotTypes_[slot]);
+            continue;
+        }
+        if (back.empty()) {
+            bool same = true;
+            for (const Edge& e : fwd) same = same && e.values[slot] == fwd.front().values[slot];
+            if (same) {
+                values_[slot] = fwd.front().values[slot];
+                continue;
+            }
+        }
+        std::string phi = ssaName(s, label);
+        std::string ir = "  "; ir += phi; ir += " = phi "; ir += slotType(s); ir += ' ';
+        bool first = true;
+        for (const Edge& e : fwd) {
+            if (!first) ir += ", ";
+            first = false;
+            ir += "[ "; ir += e.values[slot]; ir += ", %"; ir += e.block; ir += " ]";
+        }
+        for (const std::string& b : back) {
+            if (!first) ir += ", ";
+            first = false;
+            ir += "[ "; ir += ssaName(s, b); ir += ", %"; ir += b; ir += " ]";
+        }
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " Phi -> ", ir);
+        values_[slot] = std::move(phi);
+    }
+    fwd.clear();
+    fwd.shrink_to_fit();
+}
+
+} // namespace gwbasic
@@ -1,104 +1,146 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-void CodeGenerator::emitLineBlock(std::ostringstream& out, const Line& line, int lineIndex, int lastIndex) {
+void CodeGenerator::emitLineBlock(IrSink& out, int lineIndex) {
     /*
      * Function: CodeGenerator::emitLineBlock
      * Inputs:
      *  - out: IR stream
-     *  - line: AST line to emit
-     *  - lineIndex/lastIndex: indices to compute fall-through label
+     *  - lineIndex: dense CFG index of the (reachable) line to emit
      * Outputs:
      *  - void
      * Theory of operation:
-     *  - Emits a basic block label for the line, then iterates statements,
-     *    generating IR for assignments, PRINT, GOTO, GOSUB/RETURN, IF, INPUT,
-     *    and inline FOR loops. Terminates with a branch to the next line or
-     *    %exit on END/RETURN/GOTO.
+     *  - Opens a basic block labelled for the line when the line is a CFG
+     *    leader (otherwise it continues its predecessor's block) and joins
+     *    the incoming variable values there (emitJoin), then switches on each
+     *    statement's kind, generating IR for assignments, PRINT, GOTO, GOSUB/RETURN, IF, INPUT,
+     *    and inline FOR loops. An IF whose condition was folded to a
+     *    literal branches on i1 true/false. Terminates with a branch to the next line,
+     *    %exit on END, the GOTO target, or the return dispatcher on RETURN;
+     *    falling into a non-leader needs no branch. Jumps to lines that do
+     *    not exist raise CodeGenError. Assignments only rebind the
+     *    variable's SSA value; jumps go through edgeTo so the target's phis
+     *    see the values live at the jump. Values are converted to the
+     *    assigned variable's type (emitValueFor); PRINT and INPUT work in
+     *    double.
      */
+    const Line& line = cfg_.line(lineIndex);
     currentLine_ = line.number;
-    out << lineLabelName(line.number) << ":\n";
-    {
-        std::ostringstream m; m << "begin line " << currentLine_;
-        log(m.str());
+    currentIndex_ = lineIndex;
+    if (cfg_.isLeader(lineIndex)) {
+        beginBlock(out, lineLabelName(line.number));
+        emitJoin(out, lineIndex);
     }
+    GWBASIC_LOG(codegenLog_, Debug, "begin line ", currentLine_);
     int localContCounter = 0;
-    auto nextLabel = (lineIndex < lastIndex) ? lineLabelName(lineNumbers_[lineIndex + 1]) : std::string("exit");
+    const bool last = lineIndex + 1 == static_cast<int>(cfg_.size());
+    const bool mergesNext = !last && !cfg_.isLeader(lineIndex + 1);
+    auto checkTarget = [&](int target) {
+        if (!cfg_.find(target)) {
+            std::string msg = "Undefined line number "; msg += std::to_string(target); msg += " in line "; msg += std::to_string(line.number);
+            throw CodeGenError(msg);
+        }
+    };
     bool terminated = false;
     for (size_t i = 0; i < line.statements.size(); ++i) {
         const auto& st = line.statements[i];
-        if (auto asg = dynamic_cast<AssignStmt*>(st.get())) {
-            std::string val = emitExpr(out, asg->value.get(), "");
-            std::string ir = "  store double "; ir += val; ir += ", ptr "; ir += varAllocaName_[asg->name];
-            out << ir << "\n";
-            std::ostringstream m; m << "line " << currentLine_ << ' ' << nodeName(st.get()) << " -> " << ir; log(m.str());
-        } else if (auto pr = dynamic_cast<PrintStmt*>(st.get())) {
-            if (dynamic_cast<StringExpr*>(pr->value.get())) {
-                int id = strLiteralId_[dynamic_cast<StringExpr*>(pr->value.get())->value];
-                std::string sptr = nextTemp();
-                std::string ir1 = "  "; ir1 += sptr; ir1 += " = getelementptr inbounds i8, ptr "; ir1 += globalStringName(id); ir1 += ", i64 0";
-                out << ir1 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " PrintStmt -> " << ir1; log(m.str()); }
-                std::string fmt = nextTemp();
-                std::string ir2 = "  "; ir2 += fmt; ir2 += " = getelementptr inbounds i8, ptr @.fmt_str, i64 0";
-                out << ir2 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " PrintStmt -> " << ir2; log(m.str()); }
-                std::string ir3 = "  call i32 (ptr, ...) @printf(ptr "; ir3 += fmt; ir3 += ", ptr "; ir3 += sptr; ir3 += ")";
-                out << ir3 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " PrintStmt -> " << ir3; log(m.str()); }
-            } else {
-                auto val = emitExpr(out, pr->value.get(), "");
+        switch (st->kind) {
+            case StmtKind::Assign: {
+                const auto* asg = static_cast<const AssignStmt*>(st.get());
+                const SymbolId sym = symbolOf(asg->sym, asg->name);
+                assign(sym, emitValueFor(out, asg->value.get(), sym));
+                break;
+            }
+            case StmtKind::Print:
+                emitPrint(out, static_cast<const PrintStmt*>(st.get()));
+                break;
+            case StmtKind::Goto: {
+                const auto* gt = static_cast<const GotoStmt*>(st.get());
+                checkTarget(gt->targetLine);
+                const int target = cfg_.indexOf(gt->targetLine);
+                const std::string dest = edgeTo(target, static_cast<int>(i));
+                std::string ir = "  br label %"; ir += dest;
+                out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " GotoStmt -> ", ir);
+                if (target <= lineIndex) emitBackEdge(out, dest, target);
+                terminated = true;
+                break;
+            }
+            case StmtKind::Gosub:
+                emitGosub(out, static_cast<const GosubStmt*>(st.get()), static_cast<int>(i), lineLabelName(line.number), localContCounter);
+                break;
+            case StmtKind::If: {
+                const auto* is = static_cast<const IfStmt*>(st.get());
+                const auto* be = astCast<BinaryExpr>(is->cond.get());
+                const auto* folded = astCast<NumberExpr>(is->cond.get());
+                if (!folded && (!be || (be->op != BinaryOp::Eq && be->op != BinaryOp::Ne && be->op != BinaryOp::Lt && be->op != BinaryOp::Le && be->op != BinaryOp::Gt && be->op != BinaryOp::Ge))) {
+                    throw CodeGenError("IF condition must be a comparison");
+                }
+                checkTarget(is->targetLine);
+                // A comparison folded after the last simplify-stmts run keeps both edges
+                std::string cond = folded ? (folded->value != 0.0 ? "true" : "false") : emitComparison(out, be);
+                std::string contLbl = "line"; contLbl += std::to_string(line.number); contLbl += "_cont"; contLbl += std::to_string(++localContCounter);
+                const int target = cfg_.indexOf(is->targetLine);
+                const std::string dest = edgeTo(target, static_cast<int>(i));
+                std::string ir = "  br i1 "; ir += cond; ir += ", label %"; ir += dest; ir += ", label %"; ir += contLbl;
+                out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " IfStmt -> ", ir);
+                if (target <= lineIndex) emitBackEdge(out, dest, target);
+                beginBlock(out, contLbl);
+                break;
+            }
+            case StmtKind::End: {
+                std::string ir = "  br label %exit";
+                out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " EndStmt -> ", ir);
+                terminated = true;
+                break;
+            }
+            case StmtKind::Input: {
+                const auto* ins = static_cast<const InputStmt*>(st.get());
+                const SymbolId sym = symbolOf(ins->sym, ins->name);
+                const NumType type = slotTypes_[static_cast<std::size_t>(varSlot_[sym])];
+                {
+                    // scanf leaves the buffer untouched on bad input: keep the old value
+                    std::string cur = valueOf(sym);
+                    if (type == NumType::Int) cur = emitWiden(out, cur);
+                    cur = emitConvert(out, cur, type, NumType::Double);
+                    std::string ir = "  store double "; ir += cur; ir += ", ptr %input.tmp"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " InputStmt -> ", ir);
+                }
+                if (usesPrint_) {
+                    // Output printed so far (a prompt) appears before the program waits
+                    out << "  call void @rt_flush()\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " InputStmt -> ", "  call void @rt_flush()");
+                }
                 std::string fmt = nextTemp();
-                std::string ir1 = "  "; ir1 += fmt; ir1 += " = getelementptr inbounds i8, ptr @.fmt_num, i64 0";
-                out << ir1 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " PrintStmt -> " << ir1; log(m.str()); }
-                std::string ir2 = "  call i32 (ptr, ...) @printf(ptr "; ir2 += fmt; ir2 += ", double "; ir2 += val; ir2 += ")";
-                out << ir2 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " PrintStmt -> " << ir2; log(m.str()); }
+                std::string ir1 = "  "; ir1 += fmt; ir1 += " = getelementptr inbounds i8, ptr @.fmt_in, i64 0";
+                out << ir1 << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " InputStmt -> ", ir1);
+                std::string ir2 = "  call i32 (ptr, ...) @scanf(ptr "; ir2 += fmt; ir2 += ", ptr %input.tmp)";
+                out << ir2 << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " InputStmt -> ", ir2);
+                std::string val = nextTemp();
+                std::string ir3 = "  "; ir3 += val; ir3 += " = load double, ptr %input.tmp";
+                out << ir3 << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " InputStmt -> ", ir3);
+                std::string typed = emitConvert(out, val, NumType::Double, type);
+                assign(sym, type == NumType::Int ? emitNarrow(out, typed) : typed);
+                break;
             }
-        } else if (auto gt = dynamic_cast<GotoStmt*>(st.get())) {
-            std::string ir = "  br label %"; ir += lineLabelName(gt->targetLine);
-            out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " GotoStmt -> " << ir; log(m.str()); }
-            terminated = true;
-            break;
-        } else if (auto gs = dynamic_cast<GosubStmt*>(st.get())) {
-            std::string contLbl = lineLabelName(line.number); contLbl += "_gosub_cont"; contLbl += std::to_string(++localContCounter);
-            std::string entryLbl = lineLabelName(line.number); entryLbl += "_gosub_entry"; entryLbl += std::to_string(localContCounter);
-            out << "  br label %" << entryLbl << "\n";
-            emitSubroutineInline(out, gs->targetLine, entryLbl, contLbl);
-            out << contLbl << ":\n";
-        } else if (auto is = dynamic_cast<IfStmt*>(st.get())) {
-            auto be = dynamic_cast<BinaryExpr*>(is->cond.get());
-            if (!be || (be->op != BinaryOp::Eq && be->op != BinaryOp::Ne && be->op != BinaryOp::Lt && be->op != BinaryOp::Le && be->op != BinaryOp::Gt && be->op != BinaryOp::Ge)) {
-                throw CodeGenError("IF condition must be a comparison");
+            case StmtKind::For:
+                emitFor(out, static_cast<const ForStmt*>(st.get()), lineLabelName(line.number), localContCounter);
+                break;
+            case StmtKind::Return: {
+                if (useReturnStack_) returnEdges_.push_back({curBlock_, values_});
+                std::string ir = useReturnStack_ ? "  br label %gosub_return" : "  br label %exit";
+                out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " ReturnStmt -> ", ir);
+                terminated = true;
+                break;
             }
-            std::string cond = emitComparison(out, be);
-            std::string contLbl = "line"; contLbl += std::to_string(line.number); contLbl += "_cont"; contLbl += std::to_string(++localContCounter);
-            std::string ir = "  br i1 "; ir += cond; ir += ", label %"; ir += lineLabelName(is->targetLine); ir += ", label %"; ir += contLbl;
-            out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " IfStmt -> " << ir; log(m.str()); }
-            out << contLbl << ":\n";
-        } else if (dynamic_cast<EndStmt*>(st.get())) {
-            std::string ir = "  br label %exit";
-            out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " EndStmt -> " << ir; log(m.str()); }
-            terminated = true;
-            break;
-        } else if (auto ins = dynamic_cast<InputStmt*>(st.get())) {
-            ensureVarAllocated(out, ins->name);
-            std::string fmt = nextTemp();
-            std::string ir1 = "  "; ir1 += fmt; ir1 += " = getelementptr inbounds i8, ptr @.fmt_in, i64 0";
-            out << ir1 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " InputStmt -> " << ir1; log(m.str()); }
-            std::string ir2 = "  call i32 (ptr, ...) @scanf(ptr "; ir2 += fmt; ir2 += ", ptr "; ir2 += varAllocaName_[ins->name]; ir2 += ")";
-            out << ir2 << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " InputStmt -> " << ir2; log(m.str()); }
-        } else if (auto fs = dynamic_cast<ForStmt*>(st.get())) {
-            emitFor(out, fs, lineLabelName(line.number), localContCounter);
-        } else if (dynamic_cast<ReturnStmt*>(st.get())) {
-            std::string ir = "  br label %exit";
-            out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " ReturnStmt -> " << ir; log(m.str()); }
-            terminated = true;
-            break;
-        } else {
-            throw CodeGenError("Unsupported statement encountered");
+            default:
+                throw CodeGenError("Unsupported statement encountered");
         }
+        if (terminated) break;
+    }
+    if (!terminated && !mergesNext) {
+        std::string ir = "  br label %"; ir += last ? std::string("exit") : edgeTo(lineIndex + 1, static_cast<int>(line.statements.size()));
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " fallthrough -> ", ir);
     }
-    if (!terminated) { std::string ir = "  br label %"; ir += nextLabel; out << ir << "\n"; { std::ostringstream m; m << "line " << currentLine_ << " fallthrough -> " << ir; log(m.str()); } }
 }
 
 } // namespace gwbasic
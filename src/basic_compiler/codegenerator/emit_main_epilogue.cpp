@@ -1,20 +1,23 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-void CodeGenerator::emitMainEpilogue(std::ostringstream& out) {
+void CodeGenerator::emitMainEpilogue(IrSink& out) {
     /*
      * Function: CodeGenerator::emitMainEpilogue
      * Inputs:
-     *  - out: IR output stream
+     *  - out: IR output sink
      * Outputs:
      *  - void
      * Theory of operation:
-     *  - Emits the exit label and returns 0 to finish main.
+     *  - Emits the GOSUB return dispatcher when subroutines use the
+     *    return-site stack, then the exit label, which writes out buffered
+     *    PRINT output, and returns 0 to finish main.
      */
+    if (useReturnStack_) emitReturnDispatch(out);
     out << "exit:\n";
+    if (usesPrint_) out << "  call void @rt_flush()\n";
     out << "  ret i32 0\n";
     out << "}\n";
 }
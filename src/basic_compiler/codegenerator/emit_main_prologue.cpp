@@ -1,34 +1,39 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <sstream>
 
 namespace gwbasic {
 
-void CodeGenerator::emitMainPrologue(std::ostringstream& out) {
+void CodeGenerator::emitMainPrologue(IrSink& out) {
     /*
      * Function: CodeGenerator::emitMainPrologue
      * Inputs:
-     *  - out: IR output stream
+     *  - out: IR output sink
      * Outputs:
      *  - void
      * Theory of operation:
-     *  - Starts the main function, allocates all discovered variables on the
-     *    stack, initializes them to 0.0, and branches to the first line label
-     *    or returns 0 if the program has no lines.
+     *  - Starts the main function, allocates the GOSUB return-site stack
+     *    when planSubroutines asked for it and the INPUT buffer when the
+     *    program reads input, and branches to the first line label or
+     *    returns 0 if the program has no lines. Variables need no storage:
+     *    they start as a constant zero of their type on the entry edge.
      */
-    out << "define i32 @main() {\n"
-        << "entry:\n";
-    for (const auto& v : variables_) {
-        std::string a = "%"; a += v;
-        varAllocaName_[v] = a;
-        std::string i1 = "  "; i1 += a; i1 += " = alloca double";
-        std::string i2 = "  store double 0.0, ptr "; i2 += a;
+    out << "define i32 @main() {\n";
+    beginBlock(out, "entry");
+    values_.clear();
+    for (const NumType t : slotTypes_) values_.push_back(zeroOf(t));
+    if (usesInput_) {
+        out << "  %input.tmp = alloca double\n";
+        GWBASIC_LOG(codegenLog_, Trace, "line 0 InputBuffer -> ", "  %input.tmp = alloca double");
+    }
+    if (useReturnStack_) {
+        std::string i1 = "  %gosub.stack = alloca ["; i1 += std::to_string(kGosubDepth); i1 += " x i32]";
         out << i1 << "\n"
-            << i2 << "\n";
-        { std::ostringstream m; m << "line 0 VarAlloc(" << v << ") -> " << i1; log(m.str()); }
-        { std::ostringstream m; m << "line 0 InitZero(" << v << ") -> " << i2; log(m.str()); }
+            << "  %gosub.sp = alloca i32\n"
+            << "  store i32 0, ptr %gosub.sp\n";
+        GWBASIC_LOG(codegenLog_, Trace, "line 0 GosubStack -> ", i1);
     }
-    if (!lineNumbers_.empty()) { std::string br = "  br label %"; br += lineLabelName(lineNumbers_.front()); out << br << "\n"; { std::ostringstream m; m << "entry -> " << br; log(m.str()); } }
+    if (cfg_.size() != 0) lineEdges_[0].push_back({curBlock_, values_});
+    if (cfg_.size() != 0) { std::string br = "  br label %"; br += lineLabelName(cfg_.number(0)); out << br << "\n"; GWBASIC_LOG(codegenLog_, Trace, "entry -> ", br); }
     else { out << "  ret i32 0\n"; out << "}\n"; }
 }
 
@@ -0,0 +1,26 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+std::string CodeGenerator::emitNarrow(IrSink& out, const std::string& v) {
+    /*
+     * Function: CodeGenerator::emitNarrow
+     * Inputs:
+     *  - out: IR stream
+     *  - v: i32 Int value (register or integer literal)
+     * Outputs:
+     *  - std::string: the value as i16
+     * Theory of operation:
+     *  - Truncates registers, so results outside -32768..32767 wrap where
+     *    GW-BASIC would stop with "Overflow". Literals come from Int-typed
+     *    constants, which are in range, and are returned unchanged.
+     */
+    if (v.empty() || v.front() != '%') return v;
+    std::string res = nextTemp();
+    std::string ir = "  "; ir += res; ir += " = trunc i32 "; ir += v; ir += " to i16";
+    out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " Narrow -> ", ir);
+    return res;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,35 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitPrint(IrSink& out, const PrintStmt* pr) {
+    /*
+     * Function: CodeGenerator::emitPrint
+     * Inputs:
+     *  - out: IR output sink (inside the current block)
+     *  - pr: PrintStmt node
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - A string literal is passed to rt_print_line (rt_print_str for
+     *    text without newline) with its length, so it is copied into the
+     *    output buffer without scanning or formatting. A numeric value is
+     *    computed as Double and handed to rt_print_num. Shared by line
+     *    blocks, FOR bodies and inlined subroutines.
+     */
+    if (const auto* se = astCast<StringExpr>(pr->value.get())) {
+        const SymbolId sym = symbolOf(se->sym, se->value);
+        const int id = strLiteralId_[sym];
+        std::string ir = "  call void "; ir += pr->newline ? "@rt_print_line" : "@rt_print_str";
+        ir += "(ptr "; ir += globalStringName(id); ir += ", i64 ";
+        ir += std::to_string(arena_->symbols().name(sym).size()); ir += ")";
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " PrintStmt -> ", ir);
+        return;
+    }
+    auto val = emitExpr(out, pr->value.get(), NumType::Double);
+    std::string ir = "  call void @rt_print_num(double "; ir += val; ir += ")";
+    out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " PrintStmt -> ", ir);
+}
+
+} // namespace gwbasic
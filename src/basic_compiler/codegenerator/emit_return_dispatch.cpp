@@ -0,0 +1,60 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitReturnDispatch(IrSink& out) {
+    /*
+     * Function: CodeGenerator::emitReturnDispatch
+     * Inputs:
+     *  - out: IR stream
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - Emits the %gosub_return block every RETURN branches to: it pops the
+     *    return-site id and switches on it to the GOSUB continuation. RETURN
+     *    with an empty stack ends the program, as RETURN outside a
+     *    subroutine always has.
+     *  - Variables are joined once here, as %X.ret phis over every RETURN
+     *    site; each GOSUB continuation starts from them.
+     */
+    const std::string depth = std::to_string(kGosubDepth);
+    beginBlock(out, "gosub_return");
+    for (int s = 0; s < static_cast<int>(variables_.size()); ++s) {
+        const auto slot = static_cast<std::size_t>(s);
+        std::string ir = "  "; ir += ssaName(s, "ret");
+        if (returnEdges_.empty()) {
+            ir += " = bitcast "; ir += slotType(s); ir += ' '; ir += zeroOf(slotTypes_[slot]); ir += " to "; ir += slotType(s);
+        } else {
+            ir += " = phi "; ir += slotType(s); ir += ' ';
+            for (std::size_t k = 0; k < returnEdges_.size(); ++k) {
+                if (k) ir += ", ";
+                ir += "[ "; ir += returnEdges_[k].values[slot]; ir += ", %"; ir += returnEdges_[k].block; ir += " ]";
+            }
+        }
+        out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir);
+    }
+    std::string sp = nextTemp();
+    { std::string ir = "  "; ir += sp; ir += " = load i32, ptr %gosub.sp"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir); }
+    std::string empty = nextTemp();
+    { std::string ir = "  "; ir += empty; ir += " = icmp eq i32 "; ir += sp; ir += ", 0"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir); }
+    { std::string ir = "  br i1 "; ir += empty; ir += ", label %exit, label %gosub_pop"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir); }
+
+    beginBlock(out, "gosub_pop");
+    std::string top = nextTemp();
+    { std::string ir = "  "; ir += top; ir += " = sub i32 "; ir += sp; ir += ", 1"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir); }
+    { std::string ir = "  store i32 "; ir += top; ir += ", ptr %gosub.sp"; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir); }
+    std::string slot = nextTemp();
+    { std::string ir = "  "; ir += slot; ir += " = getelementptr inbounds ["; ir += depth; ir += " x i32], ptr %gosub.stack, i32 0, i32 "; ir += top; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir); }
+    std::string site = nextTemp();
+    { std::string ir = "  "; ir += site; ir += " = load i32, ptr "; ir += slot; out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "gosub_return -> ", ir); }
+    std::string sw = "  switch i32 "; sw += site; sw += ", label %exit [";
+    for (std::size_t i = 0; i < returnSites_.size(); ++i) {
+        sw += "\n    i32 "; sw += std::to_string(i + 1); sw += ", label %"; sw += returnSites_[i];
+    }
+    sw += "\n  ]";
+    out << sw << "\n";
+    GWBASIC_LOG(codegenLog_, Debug, "gosub_return -> switch over ", returnSites_.size(), " return sites");
+}
+
+} // namespace gwbasic
@@ -0,0 +1,215 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::emitRuntime(IrSink& out) {
+    /*
+     * Function: CodeGenerator::emitRuntime
+     * Inputs:
+     *  - out: IR output sink
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - Emits the output runtime as internal functions of the module, so a
+     *    .ll still links with a plain clang invocation and the backend may
+     *    inline it. PRINT appends to a kOutputBuffer-byte buffer; the
+     *    buffer goes out in one write(2) when full, before INPUT and at
+     *    exit (rt_flush), instead of one varargs printf per PRINT.
+     *  - rt_print_num produces exactly what printf("%f\n") does without
+     *    parsing a format or consulting the locale: for finite |v| < 2^63 it
+     *    splits the mantissa into integer and fraction parts in i128
+     *    arithmetic and rounds the sixth decimal half to even on the exact
+     *    remainder. Infinities, NaN and larger magnitudes take snprintf with
+     *    @.fmt_num.
+     */
+    if (!usesPrint_) return;
+    out << "@rt.buf = internal global [" << kOutputBuffer << " x i8] zeroinitializer, align 16\n";
+    out << "@rt.len = internal global i64 0\n";
+    out << "@rt.nl = private unnamed_addr constant [1 x i8] c\"\\0A\"\n\n";
+    out << R"IR(; rt_write: write n bytes to stdout, continuing after partial writes
+define internal void @rt_write(ptr %p, i64 %n) {
+entry:
+  br label %loop
+loop:
+  %at = phi ptr [ %p, %entry ], [ %at.next, %wrote ]
+  %left = phi i64 [ %n, %entry ], [ %left.next, %wrote ]
+  %done = icmp sle i64 %left, 0
+  br i1 %done, label %out, label %write
+write:
+  %w = call i64 @write(i32 1, ptr %at, i64 %left)
+  %ok = icmp sgt i64 %w, 0
+  br i1 %ok, label %wrote, label %out
+wrote:
+  %at.next = getelementptr inbounds i8, ptr %at, i64 %w
+  %left.next = sub i64 %left, %w
+  br label %loop
+out:
+  ret void
+}
+
+; rt_flush: write out and empty the buffer
+define internal void @rt_flush() {
+entry:
+  %len = load i64, ptr @rt.len
+  store i64 0, ptr @rt.len
+  call void @rt_write(ptr @rt.buf, i64 %len)
+  ret void
+}
+
+; rt_print_str: append n bytes; text larger than the buffer is written directly
+define internal void @rt_print_str(ptr %s, i64 %n) {
+entry:
+  %len = load i64, ptr @rt.len
+  %end = add i64 %len, %n
+  %fits = icmp ule i64 %end, )IR" << kOutputBuffer;
+    out << R"IR(
+  br i1 %fits, label %copy, label %full
+full:
+  call void @rt_flush()
+  %big = icmp uge i64 %n, )IR" << kOutputBuffer;
+    out << R"IR(
+  br i1 %big, label %direct, label %copy
+direct:
+  call void @rt_write(ptr %s, i64 %n)
+  ret void
+copy:
+  %at = phi i64 [ %len, %entry ], [ 0, %full ]
+  %dst = getelementptr inbounds i8, ptr @rt.buf, i64 %at
+  call void @llvm.memcpy.p0.p0.i64(ptr %dst, ptr %s, i64 %n, i1 false)
+  %next = add i64 %at, %n
+  store i64 %next, ptr @rt.len
+  ret void
+}
+
+; rt_print_line: append n bytes and a newline
+define internal void @rt_print_line(ptr %s, i64 %n) {
+entry:
+  %len = load i64, ptr @rt.len
+  %end = add i64 %len, %n
+  %fits = icmp ult i64 %end, )IR" << kOutputBuffer;
+    out << R"IR(
+  br i1 %fits, label %copy, label %split
+split:
+  call void @rt_print_str(ptr %s, i64 %n)
+  call void @rt_print_str(ptr @rt.nl, i64 1)
+  ret void
+copy:
+  %dst = getelementptr inbounds i8, ptr @rt.buf, i64 %len
+  call void @llvm.memcpy.p0.p0.i64(ptr %dst, ptr %s, i64 %n, i1 false)
+  %nl = getelementptr inbounds i8, ptr @rt.buf, i64 %end
+  store i8 10, ptr %nl
+  %next = add i64 %end, 1
+  store i64 %next, ptr @rt.len
+  ret void
+}
+
+; rt_print_num: "%f\n" of v. Finite |v| < 2^63 is converted exactly in integers
+; (six decimals rounded half to even, as printf rounds); the rest uses snprintf
+define internal void @rt_print_num(double %v) {
+entry:
+  %text = alloca [32 x i8]
+  %wide = alloca [400 x i8]
+  %bits = bitcast double %v to i64
+  %biased = lshr i64 %bits, 52
+  %exp = and i64 %biased, 2047
+  %frac.bits = and i64 %bits, 4503599627370495
+  %special = icmp eq i64 %exp, 2047
+  br i1 %special, label %slow, label %finite
+finite:
+  %subnormal = icmp eq i64 %exp, 0
+  %hidden = or i64 %frac.bits, 4503599627370496
+  %m = select i1 %subnormal, i64 %frac.bits, i64 %hidden
+  %exp.min = select i1 %subnormal, i64 1, i64 %exp
+  %e = sub i64 %exp.min, 1075
+  %large = icmp sgt i64 %e, 10
+  br i1 %large, label %slow, label %split
+split:
+  %integral = icmp sge i64 %e, 0
+  br i1 %integral, label %whole, label %fraction
+whole:
+  %ip.whole = shl i64 %m, %e
+  br label %digits
+fraction:
+  %s = sub i64 0, %e
+  %tiny = icmp ugt i64 %s, 100
+  br i1 %tiny, label %digits, label %exact
+exact:
+  %m.wide = zext i64 %m to i128
+  %s.wide = zext i64 %s to i128
+  %ip.wide = lshr i128 %m.wide, %s.wide
+  %ip.exact = trunc i128 %ip.wide to i64
+  %unit = shl i128 1, %s.wide
+  %mask = sub i128 %unit, 1
+  %f = and i128 %m.wide, %mask
+  %scaled = mul i128 %f, 1000000
+  %q.wide = lshr i128 %scaled, %s.wide
+  %rest = and i128 %scaled, %mask
+  %half = lshr i128 %unit, 1
+  %above = icmp ugt i128 %rest, %half
+  %tie = icmp eq i128 %rest, %half
+  %odd = trunc i128 %q.wide to i1
+  %tie.up = and i1 %tie, %odd
+  %up = or i1 %above, %tie.up
+  %up.i = zext i1 %up to i64
+  %q.low = trunc i128 %q.wide to i64
+  %q.rounded = add i64 %q.low, %up.i
+  %carry = icmp eq i64 %q.rounded, 1000000
+  %carry.i = zext i1 %carry to i64
+  %ip.rounded = add i64 %ip.exact, %carry.i
+  %q.exact = select i1 %carry, i64 0, i64 %q.rounded
+  br label %digits
+digits:
+  %ip = phi i64 [ %ip.whole, %whole ], [ 0, %fraction ], [ %ip.rounded, %exact ]
+  %q = phi i64 [ 0, %whole ], [ 0, %fraction ], [ %q.exact, %exact ]
+  %newline = getelementptr inbounds i8, ptr %text, i64 31
+  store i8 10, ptr %newline
+  %point = getelementptr inbounds i8, ptr %text, i64 24
+  store i8 46, ptr %point
+  br label %decimals
+decimals:
+  %dk = phi i64 [ 30, %digits ], [ %dk.next, %decimals ]
+  %dq = phi i64 [ %q, %digits ], [ %dq.next, %decimals ]
+  %dd = urem i64 %dq, 10
+  %dq.next = udiv i64 %dq, 10
+  %dd.8 = trunc i64 %dd to i8
+  %dc = add i8 %dd.8, 48
+  %dp = getelementptr inbounds i8, ptr %text, i64 %dk
+  store i8 %dc, ptr %dp
+  %dk.next = sub i64 %dk, 1
+  %dmore = icmp ugt i64 %dk.next, 24
+  br i1 %dmore, label %decimals, label %integer
+integer:
+  %ik = phi i64 [ 24, %decimals ], [ %ik.next, %integer ]
+  %iv = phi i64 [ %ip, %decimals ], [ %iv.next, %integer ]
+  %ik.next = sub i64 %ik, 1
+  %id = urem i64 %iv, 10
+  %iv.next = udiv i64 %iv, 10
+  %id.8 = trunc i64 %id to i8
+  %ic = add i8 %id.8, 48
+  %ipos = getelementptr inbounds i8, ptr %text, i64 %ik.next
+  store i8 %ic, ptr %ipos
+  %imore = icmp ne i64 %iv.next, 0
+  br i1 %imore, label %integer, label %sign
+sign:
+  %negative = icmp slt i64 %bits, 0
+  %minus.at = sub i64 %ik.next, 1
+  %minus = getelementptr inbounds i8, ptr %text, i64 %minus.at
+  store i8 45, ptr %minus
+  %start = select i1 %negative, i64 %minus.at, i64 %ik.next
+  %from = getelementptr inbounds i8, ptr %text, i64 %start
+  %len = sub i64 32, %start
+  call void @rt_print_str(ptr %from, i64 %len)
+  ret void
+slow:
+  %n = call i32 (ptr, i64, ptr, ...) @snprintf(ptr %wide, i64 400, ptr @.fmt_num, double %v)
+  %n.64 = sext i32 %n to i64
+  call void @rt_print_str(ptr %wide, i64 %n.64)
+  ret void
+}
+)IR";
+    out << "\n";
+    GWBASIC_LOG(codegenLog_, Debug, "emitRuntime: rt_flush, rt_print_str, rt_print_line, rt_print_num");
+}
+
+} // namespace gwbasic
@@ -0,0 +1,25 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+std::string CodeGenerator::emitValueFor(IrSink& out, const Expr* e, const SymbolId sym) {
+    /*
+     * Function: CodeGenerator::emitValueFor
+     * Inputs:
+     *  - out: IR stream
+     *  - e: expression being assigned
+     *  - sym: destination variable
+     * Outputs:
+     *  - std::string: value in the variable's storage type
+     * Theory of operation:
+     *  - Computes e in the variable's type (emitExpr), then narrows Int
+     *    results to their i16 storage.
+     */
+    const int slot = varSlot_[sym];
+    const NumType t = slot < 0 ? typeOfName(arena_->symbols().name(sym)) : slotTypes_[static_cast<std::size_t>(slot)];
+    std::string v = emitExpr(out, e, t);
+    return t == NumType::Int ? emitNarrow(out, v) : v;
+}
+
+} // namespace gwbasic
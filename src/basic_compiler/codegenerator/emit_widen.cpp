@@ -0,0 +1,25 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+std::string CodeGenerator::emitWiden(IrSink& out, const std::string& v) {
+    /*
+     * Function: CodeGenerator::emitWiden
+     * Inputs:
+     *  - out: IR stream
+     *  - v: i16 Int variable value (register or integer literal)
+     * Outputs:
+     *  - std::string: the value as i32
+     * Theory of operation:
+     *  - Sign-extends registers; integer literals are valid at either width
+     *    and are returned unchanged.
+     */
+    if (v.empty() || v.front() != '%') return v;
+    std::string res = nextTemp();
+    std::string ir = "  "; ir += res; ir += " = sext i16 "; ir += v; ir += " to i32";
+    out << ir << "\n"; GWBASIC_LOG(codegenLog_, Trace, "line ", currentLine_, " Widen -> ", ir);
+    return res;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,34 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+bool CodeGenerator::exprReads(const Expr* e, const SymbolId sym) {
+    /*
+     * Function: CodeGenerator::exprReads
+     * Inputs:
+     *  - e: expression (may be null)
+     *  - sym: variable symbol
+     * Outputs:
+     *  - bool: true when e reads the variable
+     * Theory of operation:
+     *  - Recursive walk over variable, unary and binary nodes.
+     */
+    if (!e) return false;
+    switch (e->kind) {
+        case ExprKind::Var: {
+            const auto* v = static_cast<const VarExpr*>(e);
+            return symbolOf(v->sym, v->name) == sym;
+        }
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            return exprReads(b->lhs.get(), sym) || exprReads(b->rhs.get(), sym);
+        }
+        case ExprKind::Unary:
+            return exprReads(static_cast<const UnaryExpr*>(e)->inner.get(), sym);
+        default:
+            return false;
+    }
+}
+
+} // namespace gwbasic
@@ -0,0 +1,80 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/IrSink.h"
+
+#include <cerrno>
+#include <stdexcept>
+
+#if __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <unistd.h>
+#define GWBASIC_HAVE_POSIX_IO 1
+#endif
+
+namespace gwbasic {
+
+/*
+ * Function: FileSink::FileSink (path)
+ * Inputs:
+ *  - path: output file to create or truncate
+ * Outputs:
+ *  - FileSink owning the descriptor
+ * Theory of operation:
+ *  - Opens with open(2) (fopen where POSIX I/O is absent) and throws the
+ *    same message style as SourceBuffer::mapFile on failure.
+ */
+FileSink::FileSink(const std::string& path) : owned_(true) {
+#ifdef GWBASIC_HAVE_POSIX_IO
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd_ < 0) throw std::runtime_error(std::string("Unable to open output file: ").append(path));
+#else
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) throw std::runtime_error(std::string("Unable to open output file: ").append(path));
+#endif
+}
+
+/*
+ * Function: FileSink::~FileSink
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - none (pending bytes written; owned descriptors closed)
+ * Theory of operation:
+ *  - Destructors must not throw, so a failing final flush is dropped here;
+ *    callers that care flush() first.
+ */
+FileSink::~FileSink() {
+    try { flush(); } catch (...) {}
+#ifdef GWBASIC_HAVE_POSIX_IO
+    if (owned_ && fd_ >= 0) ::close(fd_);
+#else
+    if (owned_ && file_) std::fclose(file_);
+#endif
+}
+
+/*
+ * Function: FileSink::sinkWrite
+ * Inputs:
+ *  - data/n: chunk to write
+ * Outputs:
+ *  - void (throws std::runtime_error on I/O failure)
+ * Theory of operation:
+ *  - Loops over short writes and EINTR so the whole chunk lands.
+ */
+void FileSink::sinkWrite(const char* data, std::size_t n) {
+#ifdef GWBASIC_HAVE_POSIX_IO
+    while (n > 0) {
+        const ssize_t w = ::write(fd_, data, n);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Failed writing IR output");
+        }
+        data += w;
+        n -= static_cast<std::size_t>(w);
+    }
+#else
+    std::FILE* f = file_ ? file_ : (fd_ == 2 ? stderr : stdout);
+    if (std::fwrite(data, 1, n, f) != n) throw std::runtime_error("Failed writing IR output");
+#endif
+}
+
+} // namespace gwbasic
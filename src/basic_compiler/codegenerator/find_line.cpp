@@ -11,11 +11,9 @@ const Line* CodeGenerator::findLine(int ln) const {
      * Outputs:
      *  - const Line*: pointer to the Line AST node or nullptr
      * Theory of operation:
-     *  - Performs a map lookup using the prebuilt lineMap_.
+     *  - Resolves through the CFG's dense line index.
      */
-    const auto it = lineMap_.find(ln);
-    if (it == lineMap_.end()) return nullptr;
-    return it->second;
+    return cfg_.find(ln);
 }
 
 } // namespace gwbasic
@@ -1,40 +1,37 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/codegen/CodeGenerator.h"
-#include <map>
-#include <sstream>
 
 namespace gwbasic {
 
-std::string CodeGenerator::generate(const Program& program) {
+void CodeGenerator::generate(const Program& program, IrSink& out) {
     /*
      * Function: CodeGenerator::generate
      * Inputs:
      *  - program: AST to generate IR for
+     *  - out: sink receiving the IR text
      * Outputs:
-     *  - std::string: complete LLVM IR text for the program
+     *  - void (complete LLVM IR text for the program written to out and
+     *    flushed)
      * Theory of operation:
-     *  - Collects declarations, emits header/globals, function prologue, and
-     *    iterates lines in ascending order emitting basic blocks and control
-     *    flow, then emits function epilogue.
+     *  - Collects declarations and the CFG, emits header/globals, the output
+     *    runtime, function prologue, and iterates reachable lines in ascending order emitting
+     *    basic blocks and control flow, then emits function epilogue. Text reaches the destination as
+     *    it is produced; the module is never assembled in memory here.
      */
     collectDecls(program);
-    std::ostringstream out;
+    planSubroutines();
+    planJoins();
     emitHeader(out);
     emitGlobals(out);
+    emitRuntime(out);
     emitMainPrologue(out);
-    if (!lineNumbers_.empty()) {
-        const int lastIdx = static_cast<int>(lineNumbers_.size() - 1);
-        std::map<int, const Line*> lm;
-        for (const auto& l : program.lines) lm[l.number] = &l;
-        for (int i = 0; i <= lastIdx; ++i) {
-            int ln = lineNumbers_[i];
-            auto it = lm.find(ln);
-            if (it == lm.end()) throw CodeGenError("Internal: missing line AST");
-            emitLineBlock(out, *it->second, i, lastIdx);
+    if (cfg_.size() != 0) {
+        for (int i = 0; i < static_cast<int>(cfg_.size()); ++i) {
+            if (cfg_.reachable(i)) emitLineBlock(out, i);
         }
         emitMainEpilogue(out);
     }
-    return out.str();
+    out.flush();
 }
 
 } // namespace gwbasic
@@ -0,0 +1,22 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+std::string CodeGenerator::generate(const Program& program) {
+    /*
+     * Function: CodeGenerator::generate (string result)
+     * Inputs:
+     *  - program: AST to generate IR for
+     * Outputs:
+     *  - std::string: complete LLVM IR text for the program
+     * Theory of operation:
+     *  - Streams into a StringSink and moves its text out; callers that write
+     *    the IR somewhere should pass their own sink instead.
+     */
+    StringSink sink;
+    generate(program, sink);
+    return sink.take();
+}
+
+} // namespace gwbasic
@@ -0,0 +1,47 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/IrSink.h"
+
+#include <cstring>
+
+namespace gwbasic {
+
+void IrSink::write(std::string_view s) {
+    /*
+     * Function: IrSink::write
+     * Inputs:
+     *  - s: text to append
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - Copies into the staging buffer, draining it to sinkWrite() whenever
+     *    it fills. Text at least one buffer long is handed over directly
+     *    after the pending bytes, avoiding a pointless copy.
+     */
+    if (s.size() >= kBufferBytes) {
+        flush();
+        sinkWrite(s.data(), s.size());
+        return;
+    }
+    if (s.size() > kBufferBytes - used_) flush();
+    std::memcpy(buf_.get() + used_, s.data(), s.size());
+    used_ += s.size();
+}
+
+void IrSink::flush() {
+    /*
+     * Function: IrSink::flush
+     * Inputs:
+     *  - none
+     * Outputs:
+     *  - void (buffered bytes delivered to the destination)
+     * Theory of operation:
+     *  - The buffer is marked empty before delivery so a throwing sinkWrite()
+     *    does not resend the same bytes from a destructor.
+     */
+    if (used_ == 0) return;
+    const std::size_t n = used_;
+    used_ = 0;
+    sinkWrite(buf_.get(), n);
+}
+
+} // namespace gwbasic
@@ -0,0 +1,34 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+bool CodeGenerator::isTinyLeafSubroutine(int targetLine) const {
+    /*
+     * Function: CodeGenerator::isTinyLeafSubroutine
+     * Inputs:
+     *  - targetLine: GOSUB target line number
+     * Outputs:
+     *  - bool: true when the subroutine is straight-line code of at most
+     *    kInlineStmtLimit assignments/PRINTs ending in RETURN
+     * Theory of operation:
+     *  - Walks statements from the target line in line order and gives up at
+     *    the first statement that is not an assignment or PRINT, so the scan
+     *    is bounded by the limit. Such a body has no labels and no calls,
+     *    which makes copying it into each call site cheaper than the stack
+     *    push/dispatch and keeps total IR linear in the program size.
+     */
+    const int first = cfg_.indexOf(targetLine);
+    if (first == ControlFlowGraph::kNone) return false;
+    std::size_t count = 0;
+    for (int i = first; i < static_cast<int>(cfg_.size()); ++i) {
+        for (const auto& st : cfg_.line(i).statements) {
+            if (st->kind == StmtKind::Return) return true;
+            if (st->kind != StmtKind::Assign && st->kind != StmtKind::Print) return false;
+            if (++count > kInlineStmtLimit) return false;
+        }
+    }
+    return false; // falls off the end of the program
+}
+
+} // namespace gwbasic
@@ -0,0 +1,63 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/IrSink.h"
+
+#include <stdexcept>
+
+#if defined(_WIN32)
+#define GWBASIC_POPEN _popen
+#define GWBASIC_PCLOSE _pclose
+#else
+#define GWBASIC_POPEN popen
+#define GWBASIC_PCLOSE pclose
+#endif
+
+namespace gwbasic {
+
+/*
+ * Function: PipeSink::PipeSink
+ * Inputs:
+ *  - command: shell command whose standard input receives the IR
+ * Outputs:
+ *  - PipeSink connected to the running command
+ * Theory of operation:
+ *  - popen(3) in write mode; the child consumes IR while codegen is still
+ *    producing it.
+ */
+PipeSink::PipeSink(const std::string& command) : pipe_(GWBASIC_POPEN(command.c_str(), "w")) {
+    if (!pipe_) throw std::runtime_error(std::string("Unable to start: ").append(command));
+}
+
+/*
+ * Function: PipeSink::close
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - int: exit status from pclose (0 = success); -1 if already closed or
+ *    the final flush failed
+ * Theory of operation:
+ *  - Flushes, closes the child's stdin so it sees EOF, and waits for it.
+ */
+int PipeSink::close() {
+    if (!pipe_) return -1;
+    bool ok = true;
+    try { flush(); } catch (...) { ok = false; }
+    std::FILE* p = pipe_;
+    pipe_ = nullptr;
+    const int status = GWBASIC_PCLOSE(p);
+    return ok ? status : -1;
+}
+
+PipeSink::~PipeSink() { close(); }
+
+/*
+ * Function: PipeSink::sinkWrite
+ * Inputs:
+ *  - data/n: chunk to forward to the child
+ * Outputs:
+ *  - void (throws std::runtime_error when the child stopped reading)
+ */
+void PipeSink::sinkWrite(const char* data, std::size_t n) {
+    if (!pipe_ || std::fwrite(data, 1, n, pipe_) != n) throw std::runtime_error("Failed writing IR to pipe");
+}
+
+} // namespace gwbasic
@@ -0,0 +1,58 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::planJoins() {
+    /*
+     * Function: CodeGenerator::planJoins
+     * Inputs:
+     *  - none (uses the CFG and the GOSUB plan)
+     * Outputs:
+     *  - void (fills backEdges_)
+     * Theory of operation:
+     *  - A leader's phis are written before the lines that jump back to it,
+     *    so those edges must be known up front. This walks reachable lines
+     *    exactly as emitLineBlock will (stopping at GOTO/END/RETURN) and, for
+     *    every GOTO, IF or stack-based GOSUB whose target is at or before the
+     *    jumping line, records the edge block label edgeTo() will use.
+     */
+    for (int m = 0; m < static_cast<int>(cfg_.size()); ++m) {
+        if (!cfg_.reachable(m)) continue;
+        const Line& line = cfg_.line(m);
+        int stmt = 0;
+        for (const auto& st : line.statements) {
+            int target = ControlFlowGraph::kNone;
+            bool terminates = false;
+            switch (st->kind) {
+                case StmtKind::Goto:
+                    target = cfg_.indexOf(static_cast<const GotoStmt*>(st.get())->targetLine);
+                    terminates = true;
+                    break;
+                case StmtKind::If:
+                    target = cfg_.indexOf(static_cast<const IfStmt*>(st.get())->targetLine);
+                    break;
+                case StmtKind::Gosub: {
+                    const int ln = static_cast<const GosubStmt*>(st.get())->targetLine;
+                    if (!isTinyLeafSubroutine(ln)) target = cfg_.indexOf(ln);
+                    break;
+                }
+                case StmtKind::End:
+                case StmtKind::Return:
+                    terminates = true;
+                    break;
+                default:
+                    break;
+            }
+            if (target != ControlFlowGraph::kNone && target <= m) {
+                std::string label = lineLabelName(cfg_.number(target));
+                label += "_from"; label += std::to_string(line.number); label += '_'; label += std::to_string(stmt);
+                backEdges_[static_cast<std::size_t>(target)].push_back(std::move(label));
+            }
+            if (terminates) break;
+            ++stmt;
+        }
+    }
+}
+
+} // namespace gwbasic
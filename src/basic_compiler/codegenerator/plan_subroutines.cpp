@@ -0,0 +1,33 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+void CodeGenerator::planSubroutines() {
+    /*
+     * Function: CodeGenerator::planSubroutines
+     * Inputs:
+     *  - none (uses the CFG built by collectDecls)
+     * Outputs:
+     *  - void (sets useReturnStack_, clears returnSites_)
+     * Theory of operation:
+     *  - The return-site stack and dispatcher are emitted only when some
+     *    GOSUB is not expanded inline, so programs without real subroutine
+     *    calls compile exactly as before.
+     */
+    useReturnStack_ = false;
+    returnSites_.clear();
+    for (int i = 0; i < static_cast<int>(cfg_.size()); ++i) {
+        if (!cfg_.reachable(i)) continue;
+        for (const auto& st : cfg_.line(i).statements) {
+            if (st->kind != StmtKind::Gosub) continue;
+            const int target = static_cast<const GosubStmt*>(st.get())->targetLine;
+            if (findLine(target) && !isTinyLeafSubroutine(target)) {
+                useReturnStack_ = true;
+                return;
+            }
+        }
+    }
+}
+
+} // namespace gwbasic
@@ -0,0 +1,29 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+namespace gwbasic {
+
+SymbolId CodeGenerator::symbolOf(const SymbolId sym, const std::string_view name) {
+    /*
+     * Function: CodeGenerator::symbolOf
+     * Inputs:
+     *  - sym: id recorded on the node by the parser (or kNoSymbol)
+     *  - name: the node's text, used only when sym is kNoSymbol
+     * Outputs:
+     *  - SymbolId: index into the per-symbol tables
+     * Theory of operation:
+     *  - Parsed nodes already carry their id, so this is normally a bounds
+     *    check. Nodes built without the interner (tests, future passes) are
+     *    interned into the program's table on first use. Tables grow to the
+     *    table size so every valid id can be indexed directly.
+     */
+    const SymbolId resolved = sym != kNoSymbol ? sym : arena_->intern(name).id;
+    if (resolved >= varSlot_.size()) {
+        const std::size_t n = arena_->symbols().size();
+        varSlot_.resize(n, -1);
+        strLiteralId_.resize(n, -1);
+    }
+    return resolved;
+}
+
+} // namespace gwbasic
@@ -1,7 +1,5 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Compiler.h"
-#include <fstream>
-#include <sstream>
 
 namespace gwbasic {
 
@@ -13,14 +11,12 @@ std::string Compiler::compileFile(const std::string& path) {
      * Outputs:
      *  - std::string: LLVM IR text of the compiled program
      * Theory of operation:
-     *  - Reads file contents into memory, delegates to compileString(), which
-     *    lexes, parses, and generates IR for the program.
+     *  - Maps the file (SourceBuffer) and delegates to compileString() on the
+     *    mapped view, which lexes, parses, and generates IR for the program.
+     *    Tokens view the mapping; nothing is copied before the parser.
      */
-    std::ifstream in(path);
-    if (!in) throw std::runtime_error(std::string("Unable to open input file: ").append(path));
-    std::ostringstream buf;
-    buf << in.rdbuf();
-    return compileString(buf.str());
+    const SourceBuffer src = SourceBuffer::mapFile(path);
+    return compileString(src.text());
 }
 
 } // namespace gwbasic
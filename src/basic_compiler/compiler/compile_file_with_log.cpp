@@ -1,7 +1,5 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Compiler.h"
-#include <fstream>
-#include <sstream>
 
 namespace gwbasic {
 
@@ -14,15 +12,12 @@ std::string Compiler::compileFileWithLog(const std::string& path, const std::str
      * Outputs:
      *  - std::string: LLVM IR text for the compiled program
      * Theory of operation:
-     *  - Loads the file contents into memory and delegates to
+     *  - Maps the file contents (SourceBuffer) and delegates to
      *    compileStringWithLog() so the same lex/parse/codegen pipeline and
      *    logging behavior are used for both file and string inputs.
      */
-    std::ifstream in(path);
-    if (!in) throw std::runtime_error(std::string("Unable to open input file: ").append(path));
-    std::ostringstream buf;
-    buf << in.rdbuf();
-    return compileStringWithLog(buf.str(), logPath);
+    const SourceBuffer src = SourceBuffer::mapFile(path);
+    return compileStringWithLog(src.text(), logPath);
 }
 
 } // namespace gwbasic
@@ -1,15 +1,16 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Compiler.h"
-#include <fstream>
-#include <sstream>
 
 namespace gwbasic {
 
-std::string Compiler::compileStringWithPhaseLogs(const std::string& source,
+std::string Compiler::compileStringWithPhaseLogs(std::string_view source,
                                                  const std::string& lexLogPath,
                                                  const std::string& syntaxLogPath,
                                                  const std::string& semanticLogPath,
-                                                 const std::string& codegenLogPath) {
+                                                 const std::string& codegenLogPath,
+                                                 logging::Format logFormat,
+                                                 const OptOptions& options,
+                                                 PassStats* passStats) {
     /*
      * Function: Compiler::compileStringWithPhaseLogs
      * Inputs:
@@ -18,29 +19,64 @@ std::string Compiler::compileStringWithPhaseLogs(const std::string& source,
      *  - syntaxLogPath: File to append syntax parse events (node, line/col)
      *  - semanticLogPath: File to append semantic events (vars/refs/loops)
      *  - codegenLogPath: File to append IR emission events per AST node
+     *  - logFormat: Text lines or binary records for all four logs
+     *  - options: AST pass pipeline to run before codegen
+     *  - passStats: receives the pipeline's statistics (optional)
      * Outputs:
      *  - std::string: LLVM IR text for the compiled program
      * Theory of operation:
+     *  - Runs the streaming overload into a StringSink and returns its text.
+     */
+    StringSink sink;
+    compileStringWithPhaseLogs(source, lexLogPath, syntaxLogPath, semanticLogPath, codegenLogPath, sink, logFormat, options, passStats);
+    return sink.take();
+}
+
+void Compiler::compileStringWithPhaseLogs(std::string_view source,
+                                          const std::string& lexLogPath,
+                                          const std::string& syntaxLogPath,
+                                          const std::string& semanticLogPath,
+                                          const std::string& codegenLogPath,
+                                          IrSink& out,
+                                          logging::Format logFormat,
+                                          const OptOptions& options,
+                                          PassStats* passStats) {
+    /*
+     * Function: Compiler::compileStringWithPhaseLogs (streaming)
+     * Inputs:
+     *  - source/log paths/logFormat/options/passStats: as for the
+     *    string-returning overload
+     *  - out: sink receiving the IR text
+     * Outputs:
+     *  - void (IR written to out and flushed)
+     * Theory of operation:
      *  - Executes the pipeline while enabling detailed logs at the parser and
      *    code generator stages to correlate source to structure and emitted IR.
+     *    The pass pipeline for options rewrites the AST between parsing
+     *    and codegen. Codegen writes straight into out, so writing a file
+     *    or feeding clang never holds a second copy of the module.
      */
     Lexer lex(source);
-    lex.setLexLogPath(lexLogPath);
-    auto tokens = lex.tokenize();
-    Parser parser(std::move(tokens));
-    parser.setSyntaxLogPath(syntaxLogPath);
+    lex.setLexLogPath(lexLogPath, logFormat);
+    Parser parser(lex);
+    parser.setSyntaxLogPath(syntaxLogPath, logFormat);
     auto program = parser.parseProgram();
+    const PassStats stats = PassManager::forLevel(options).run(program);
+    if (passStats) *passStats = stats;
     CodeGenerator gen;
-    gen.setSemanticLogPath(semanticLogPath);
-    if (!codegenLogPath.empty()) gen.setLogPath(codegenLogPath);
-    return gen.generate(program);
+    gen.setSemanticLogPath(semanticLogPath, logging::Level::Trace, logFormat);
+    if (!codegenLogPath.empty()) gen.setLogPath(codegenLogPath, logging::Level::Trace, logFormat);
+    gen.generate(program, out);
 }
 
 std::string Compiler::compileFileWithPhaseLogs(const std::string& path,
                                                const std::string& lexLogPath,
                                                const std::string& syntaxLogPath,
                                                const std::string& semanticLogPath,
-                                               const std::string& codegenLogPath) {
+                                               const std::string& codegenLogPath,
+                                               logging::Format logFormat,
+                                          const OptOptions& options,
+                                          PassStats* passStats) {
     /*
      * Function: Compiler::compileFileWithPhaseLogs
      * Inputs:
@@ -49,17 +85,41 @@ std::string Compiler::compileFileWithPhaseLogs(const std::string& path,
      *  - syntaxLogPath: Destination for syntax phase log
      *  - semanticLogPath: Destination for semantic phase log
      *  - codegenLogPath: Destination for code generation log
+     *  - logFormat: Text lines or binary records for all four logs
+     *  - options/passStats: AST pass pipeline and its statistics
      * Outputs:
      *  - std::string: LLVM IR text for the compiled program
      * Theory of operation:
-     *  - Reads file contents and forwards to compileStringWithPhaseLogs() so
+     *  - Maps the file and forwards its view to compileStringWithPhaseLogs() so
      *    string- and file-based flows share identical behavior and logging.
      */
-    std::ifstream in(path);
-    if (!in) throw std::runtime_error(std::string("Unable to open input file: ").append(path));
-    std::ostringstream buf;
-    buf << in.rdbuf();
-    return compileStringWithPhaseLogs(buf.str(), lexLogPath, syntaxLogPath, semanticLogPath, codegenLogPath);
+    const SourceBuffer src = SourceBuffer::mapFile(path);
+    return compileStringWithPhaseLogs(src.text(), lexLogPath, syntaxLogPath, semanticLogPath, codegenLogPath, logFormat, options, passStats);
+}
+
+void Compiler::compileFileWithPhaseLogs(const std::string& path,
+                                        const std::string& lexLogPath,
+                                        const std::string& syntaxLogPath,
+                                        const std::string& semanticLogPath,
+                                        const std::string& codegenLogPath,
+                                        IrSink& out,
+                                        logging::Format logFormat,
+                                        const OptOptions& options,
+                                        PassStats* passStats) {
+    /*
+     * Function: Compiler::compileFileWithPhaseLogs (streaming)
+     * Inputs:
+     *  - path: Filesystem path to a GW-BASIC source file
+     *  - log paths/logFormat: Destinations and format of the phase logs
+     *  - options/passStats: AST pass pipeline and its statistics
+     *  - out: sink receiving the IR text
+     * Outputs:
+     *  - void (IR written to out and flushed)
+     * Theory of operation:
+     *  - Maps the file and forwards to the streaming string overload.
+     */
+    const SourceBuffer src = SourceBuffer::mapFile(path);
+    compileStringWithPhaseLogs(src.text(), lexLogPath, syntaxLogPath, semanticLogPath, codegenLogPath, out, logFormat, options, passStats);
 }
 
 } // namespace gwbasic
@@ -1,15 +1,13 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Compiler.h"
-#include "basic_compiler/opt/AstOptimizer.h"
 
 namespace gwbasic {
 
-std::string Compiler::compileStringOptimized(const std::string& source) {
+std::string Compiler::compileStringOptimized(std::string_view source, const OptOptions& options) {
     Lexer lex(source);
-    auto tokens = lex.tokenize();
-    Parser parser(std::move(tokens));
+    Parser parser(lex);
     auto program = parser.parseProgram();
-    gwbasic::AstOptimizer::optimize(program);
+    PassManager::forLevel(options).run(program);
     CodeGenerator gen;
     return gen.generate(program);
 }
@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::string Compiler::compileStringWithLog(const std::string& source, const std::string& logPath) {
+std::string Compiler::compileStringWithLog(std::string_view source, const std::string& logPath) {
     /*
      * Function: Compiler::compileStringWithLog
      * Inputs:
@@ -17,8 +17,7 @@ std::string Compiler::compileStringWithLog(const std::string& source, const std:
      *    IR with source lines and AST nodes to the provided logPath.
      */
     Lexer lex(source);
-    auto tokens = lex.tokenize();
-    Parser parser(std::move(tokens));
+    Parser parser(lex);
     auto program = parser.parseProgram();
     CodeGenerator gen;
     gen.setLogPath(logPath);
@@ -12,14 +12,20 @@
  *  - Prints a short synopsis describing supported flags and behavior.
  */
 void usage(const char* argv0) {
-    std::cerr << "Usage: " << argv0 << " <input.bas> [-ll out.ll] [--bc out.bc] [-o out.exe] [--asm out.asm] [--target <triple>]\n";
+    std::cerr << "Usage: " << argv0 << " <input.bas> [-ll out.ll] [--bc out.bc] [-o out.exe] [--asm out.asm] [--target <triple>] [-O0|-O1|-O2|-O3|-Os]\n";
     std::cerr << "  -h, --help  : Show this help and exit.\n";
     std::cerr << "  --ll <file>   : Write textual LLVM IR (.ll) to <file>\n";
     std::cerr << "  --bc <file>  : Write LLVM bitcode (.bc) to <file>\n";
     std::cerr << "  -o <file>    : Link a native executable to <file>\n";
     std::cerr << "  --asm <file> : Emit assembly (.asm) for the chosen --target\n";
     std::cerr << "  --target <triple>: aarch64-linux-gnu, x86_64-linux-gnu (default host).\n";
+    std::cerr << "  -O0..-O3, -Os : Optimization level for the AST passes and clang (default -O0)\n";
+    std::cerr << "  --opt-stats  : Print per-pass statistics to stderr\n";
+    std::cerr << "  --unroll-threshold <n>: Node budget per unrolled FOR loop at -O2 and above (0 disables;\n";
+    std::cerr << "                 default 128 at -O2, 512 at -O3, 0 at -Os)\n";
+    std::cerr << "  --specialize <VAR=value>: Compile INPUT VAR as the constant value (repeatable, any -O level)\n";
     std::cerr << "  --lex-log, --syntax-log, --semantic-log, --log control phase logs.\n";
+    std::cerr << "  Phase logs are binary; render them with basic_compiler-logdump <file.log>.\n";
     std::cerr << "  Without -ll/--bc/-o/--asm, prints LLVM IR to stdout.\n";
     std::cerr << "  Supported targets: x86_64 or arm64/aarch64 on Linux/macOS (Darwin). FreeBSD and Android are also allowed.\n";
 }
@@ -10,18 +10,17 @@ namespace gwbasic {
  * Outputs:
  *  - char: the character consumed, or '\0' at end-of-input
  * Theory of operation:
- *  - Moves the cursor forward one character, updating line/column counters
- *    and beginning-of-line flag when encountering a newline.
+ *  - Moves the cursor forward one character. Only a newline touches the
+ *    position state (line number, line start, beginning-of-line flag);
+ *    columns are derived from the line start when a token is built.
  */
 char Lexer::advance() {
     if (atEnd()) return '\0';
     const char c = src_[pos_++];
     if (c == '\n') {
         line_++;
-        col_ = 1;
+        lineStart_ = pos_;
         bol_ = true;
-    } else {
-        col_++;
     }
     return c;
 }
@@ -0,0 +1,27 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/lexer/Simd.h"
+
+namespace gwbasic {
+
+/*
+ * Function: countNewlines
+ * Inputs:
+ *  - p/end: Byte range to scan
+ * Outputs:
+ *  - std::size_t: Number of '\n' bytes in the range
+ * Theory of operation:
+ *  - Popcount of the per-block newline mask, scalar tail. Used to bring the
+ *    lazily tracked line number up to date after a multi-line string.
+ */
+std::size_t countNewlines(const char* p, const char* end) {
+    std::size_t n = 0;
+    while (static_cast<std::size_t>(end - p) >= simd::kWidth) {
+        n += simd::countFlagged(simd::mask(simd::eq(simd::load(p), '\n')));
+        p += simd::kWidth;
+    }
+    for (; p < end; ++p) n += (*p == '\n');
+    return n;
+}
+
+} // namespace gwbasic
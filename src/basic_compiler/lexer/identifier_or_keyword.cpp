@@ -1,23 +1,14 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/token/KeywordTable.h"
 
 namespace gwbasic {
 
-// Note: identifierOrKeyword() is only entered when tokenize() has already
-// verified the first character is alphabetic. No separate isIdentStart() is
-// required here, so we only keep isIdentChar() below.
-
-/*
- * Function: isIdentChar
- * Inputs:
- *  - c: character to classify
- * Outputs:
- *  - bool: true if character is alphanumeric or underscore
- * Theory of operation:
- *  - Uses std::isalnum to allow letters and digits, and admits '_' to support
- *    a conventional superset while keeping the lexer simple.
- */
-static bool isIdentChar(char c) { return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_'; }
+// Note: identifierOrKeyword() is only entered when next() has already
+// verified the first character is alphabetic; scanIdentChars() covers the
+// rest of the identifier (ASCII letters, digits, '_'), plus an optional
+// type suffix (%, ! or #) on names that are not reserved words.
 
 Token Lexer::identifierOrKeyword() {
     /*
@@ -27,36 +18,29 @@ Token Lexer::identifierOrKeyword() {
      * Outputs:
      *  - Token: Identifier or specific keyword token with text and location
      * Theory of operation:
-     *  - Accumulates alphanumeric/underscore characters, uppercases a copy
-     *    to compare against known GW-BASIC keywords; otherwise returns IDENT.
+     *  - Scans the identifier run with scanIdentChars(); the lexeme is a view of
+     *    that span of the source. lookupKeyword() classifies the
+     *    span in place, case-insensitively and without a copy; anything
+     *    that is not a reserved word is an IDENT.
+     *  - A type suffix directly after an IDENT belongs to it ("N%" is one
+     *    token); keywords never take one.
      */
     const int startLine = line_;
-    const int startCol = col_;
-    std::string buf;
-    while (isIdentChar(peek())) buf.push_back(advance());
-
-    std::string upper;
-    upper.reserve(buf.size());
-    for (const char c : buf) upper.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+    const int startCol = col();
+    const size_t start = pos_;
+    skipTo(scanIdentChars(cursor(), limit()));
+    std::string_view buf = src_.substr(start, pos_ - start);
 
-    if (upper == "LET") return Token{TokenType::KwLet, buf, startLine, startCol};
-    if (upper == "PRINT") return Token{TokenType::KwPrint, buf, startLine, startCol};
-    if (upper == "IF") return Token{TokenType::KwIf, buf, startLine, startCol};
-    if (upper == "THEN") return Token{TokenType::KwThen, buf, startLine, startCol};
-    if (upper == "GOTO") return Token{TokenType::KwGoto, buf, startLine, startCol};
-    if (upper == "END") return Token{TokenType::KwEnd, buf, startLine, startCol};
-    if (upper == "FOR") return Token{TokenType::KwFor, buf, startLine, startCol};
-    if (upper == "TO") return Token{TokenType::KwTo, buf, startLine, startCol};
-    if (upper == "STEP") return Token{TokenType::KwStep, buf, startLine, startCol};
-    if (upper == "NEXT") return Token{TokenType::KwNext, buf, startLine, startCol};
-    if (upper == "GOSUB") return Token{TokenType::KwGosub, buf, startLine, startCol};
-    if (upper == "RETURN") return Token{TokenType::KwReturn, buf, startLine, startCol};
-    if (upper == "INPUT") return Token{TokenType::KwInput, buf, startLine, startCol};
-    if (upper == "REM") { // treat as comment to EOL
+    const TokenType type = lookupKeyword(buf);
+    if (type == TokenType::KwRem) { // treat as comment to EOL
         skipToEOL();
         return Token{TokenType::NewLine, "\n", startLine, startCol};
     }
-    return Token{TokenType::Identifier, buf, startLine, startCol};
+    if (type == TokenType::Identifier && pos_ < src_.size() && (src_[pos_] == '%' || src_[pos_] == '!' || src_[pos_] == '#')) {
+        skipTo(cursor() + 1);
+        buf = src_.substr(start, pos_ - start);
+    }
+    return Token{type, buf, startLine, startCol};
 }
 
 } // namespace gwbasic
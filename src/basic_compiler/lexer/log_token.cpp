@@ -10,25 +10,30 @@ namespace gwbasic {
  * Inputs:
  *  - t: Token to report
  * Outputs:
- *  - void (writes a single line to the lex log if enabled)
+ *  - void (writes a single line to the lex log)
  * Theory of operation:
  *  - Renders the token type and location; includes a readable lexeme for
- *    most tokens except EOF/NEWLINE where lexeme text is not useful.
+ *    most tokens except EOF/NEWLINE where lexeme text is not useful. Only
+ *    called once the caller has checked the channel, so nothing here runs
+ *    with lexical logging off.
  */
 void Lexer::logToken(const Token& t) {
-    if (!lexLogEnabled_ || !lexLog_.is_open()) return;
-    lexLog_ << "token " << to_string(t.type) << " @ " << t.line << ":" << t.col;
     switch (t.type) {
         case TokenType::EndOfFile:
         case TokenType::NewLine:
+            GWBASIC_LOG(lexLog_, Trace, "token ", to_string(t.type), " @ ", t.line, ':', t.col);
             break;
-        default: {
-            const std::string esc = escapeForLog(t.lexeme);
-            lexLog_ << " \"" << esc << "\"";
+        case TokenType::String: {
+            // Log the decoded value, as the lexer did when it owned lexemes
+            const std::string esc = t.lexeme.find('\\') == std::string_view::npos
+                ? escapeForLog(t.lexeme) : escapeForLog(unescapeStringLiteral(t.lexeme));
+            GWBASIC_LOG(lexLog_, Trace, "token ", to_string(t.type), " @ ", t.line, ':', t.col, " \"", esc, '"');
             break;
         }
+        default:
+            GWBASIC_LOG(lexLog_, Trace, "token ", to_string(t.type), " @ ", t.line, ':', t.col, " \"", escapeForLog(t.lexeme), '"');
+            break;
     }
-    lexLog_ << "\n";
 }
 
 /*
@@ -40,7 +45,7 @@ void Lexer::logToken(const Token& t) {
  * Theory of operation:
  *  - Replaces special characters with C-style escape sequences.
  */
-std::string Lexer::escapeForLog(const std::string& s) {
+std::string Lexer::escapeForLog(std::string_view s) {
     std::string out;
     out.reserve(s.size());
     for (const unsigned char ch : s) {
@@ -0,0 +1,70 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/LexTables.h"
+#include <sstream>
+
+namespace gwbasic {
+
+Token Lexer::next() {
+    /*
+     * Function: Lexer::next
+     * Inputs:
+     *  - none (continues from the current scan position)
+     * Outputs:
+     *  - Token: The next token; EndOfFile once input is exhausted (repeated
+     *    on further calls, logged only the first time)
+     * Theory of operation:
+     *  - Skips whitespace/comments, then looks the first byte up in the
+     *    compile-time start table (lexer/LexTables.h) to pick the scanner:
+     *    newline, number, identifier/keyword, string, or the operator DFA
+     *    generated from kOperators (longest match). Returns the token
+     *    immediately; holding no token list lets the parser pull tokens on
+     *    demand with constant memory.
+     */
+    skipWhitespace();
+    if (atEnd()) {
+        Token t(TokenType::EndOfFile, "", line_, col());
+        if (!eofEmitted_) {
+            if (GWBASIC_LOG_ENABLED(lexLog_, Trace)) logToken(t);
+            eofEmitted_ = true;
+        }
+        return t;
+    }
+
+    const char c = peek();
+    Token t;
+    switch (lex::kStart[static_cast<unsigned char>(c)]) {
+        case lex::Start::Newline:
+            advance();
+            t = Token(TokenType::NewLine, "\n", line_ - 1, 1);
+            if (GWBASIC_LOG_ENABLED(lexLog_, Trace)) logToken(t);
+            bol_ = true;
+            return t;
+        case lex::Start::Digit:
+            t = number();
+            break;
+        case lex::Start::Letter:
+            t = identifierOrKeyword();
+            break;
+        case lex::Start::Quote:
+            t = stringLiteral();
+            break;
+        case lex::Start::Operator:
+            if (const lex::OperatorSpec* op = lex::matchOperator(cursor(), limit())) {
+                t = Token(op->type, op->text, line_, col());
+                pos_ += op->text.size();
+                break;
+            }
+            [[fallthrough]];
+        case lex::Start::Invalid: {
+            std::ostringstream oss;
+            oss << "Unexpected character '" << c << "' at " << line_ << ":" << col();
+            throw LexError(oss.str());
+        }
+    }
+    if (GWBASIC_LOG_ENABLED(lexLog_, Trace)) logToken(t);
+    bol_ = false;
+    return t;
+}
+
+} // namespace gwbasic
@@ -1,5 +1,6 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/Scan.h"
 
 namespace gwbasic {
 
@@ -10,18 +11,21 @@ namespace gwbasic {
  * Outputs:
  *  - Token: Integer or Float token with lexeme and source location
  * Theory of operation:
- *  - Scans digits and a single optional decimal point to form a numeric
- *    literal; classifies as float if a dot was seen.
+ *  - Scans a digit run, a single optional decimal point and a second digit
+ *    run to form a numeric literal (a view of the source); classifies as
+ *    float if a dot was seen.
  */
 Token Lexer::number() {
     const int startLine = line_;
-    const int startCol = col_;
-    std::string buf;
-    bool seenDot = false;
-    while (std::isdigit(peek()) || (!seenDot && peek() == '.')) {
-        if (peek() == '.') seenDot = true;
-        buf.push_back(advance());
+    const int startCol = col();
+    const size_t start = pos_;
+    skipTo(scanDigits(cursor(), limit()));
+    const bool seenDot = peek() == '.';
+    if (seenDot) {
+        ++pos_;
+        skipTo(scanDigits(cursor(), limit()));
     }
+    const std::string_view buf = src_.substr(start, pos_ - start);
     if (seenDot) return Token{TokenType::Float, buf, startLine, startCol};
     return Token{TokenType::Integer, buf, startLine, startCol};
 }
@@ -0,0 +1,30 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/lexer/Simd.h"
+
+namespace gwbasic {
+
+namespace {
+struct Blank {
+    static simd::Block vec(simd::Block v) {
+        return simd::any(simd::any(simd::eq(v, ' '), simd::eq(v, '\t')), simd::eq(v, '\r'));
+    }
+    static bool byte(unsigned char c) { return c == ' ' || c == '\t' || c == '\r'; }
+};
+} // namespace
+
+/*
+ * Function: scanBlanks
+ * Inputs:
+ *  - p/end: Byte range to scan
+ * Outputs:
+ *  - const char*: First byte that is not a space, tab or carriage return
+ * Theory of operation:
+ *  - Compares whole blocks against the three blank bytes; the first byte
+ *    outside the class ends the run.
+ */
+const char* scanBlanks(const char* p, const char* end) {
+    return simd::findFirst<Blank, false>(p, end);
+}
+
+} // namespace gwbasic
@@ -0,0 +1,28 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/lexer/Simd.h"
+
+namespace gwbasic {
+
+namespace {
+struct Digit {
+    static simd::Block vec(simd::Block v) { return simd::inRange(v, '0', '9'); }
+    static bool byte(unsigned char c) { return c >= '0' && c <= '9'; }
+};
+} // namespace
+
+/*
+ * Function: scanDigits
+ * Inputs:
+ *  - p/end: Byte range to scan
+ * Outputs:
+ *  - const char*: First byte that is not an ASCII digit
+ * Theory of operation:
+ *  - One unsigned range compare per block ('0'..'9'); the first byte
+ *    outside the range ends the run.
+ */
+const char* scanDigits(const char* p, const char* end) {
+    return simd::findFirst<Digit, false>(p, end);
+}
+
+} // namespace gwbasic
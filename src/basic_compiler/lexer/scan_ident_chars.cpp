@@ -0,0 +1,35 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/lexer/Simd.h"
+
+namespace gwbasic {
+
+namespace {
+struct IdentChar {
+    static simd::Block vec(simd::Block v) {
+        return simd::any(simd::any(simd::inRange(simd::lower(v), 'a', 'z'), simd::inRange(v, '0', '9')),
+                         simd::eq(v, '_'));
+    }
+    static bool byte(unsigned char c) {
+        const unsigned char l = static_cast<unsigned char>(c | 0x20);
+        return (l >= 'a' && l <= 'z') || (c >= '0' && c <= '9') || c == '_';
+    }
+};
+} // namespace
+
+/*
+ * Function: scanIdentChars
+ * Inputs:
+ *  - p/end: Byte range to scan
+ * Outputs:
+ *  - const char*: First byte that is not an ASCII letter, digit or '_'
+ * Theory of operation:
+ *  - Letters are matched case-insensitively by OR-ing 0x20 into each byte
+ *    and range-checking 'a'..'z' (no other byte maps into that range), then
+ *    combined with the digit range and '_'.
+ */
+const char* scanIdentChars(const char* p, const char* end) {
+    return simd::findFirst<IdentChar, false>(p, end);
+}
+
+} // namespace gwbasic
@@ -0,0 +1,27 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/lexer/Simd.h"
+
+namespace gwbasic {
+
+namespace {
+struct Newline {
+    static simd::Block vec(simd::Block v) { return simd::eq(v, '\n'); }
+    static bool byte(unsigned char c) { return c == '\n'; }
+};
+} // namespace
+
+/*
+ * Function: scanLineEnd
+ * Inputs:
+ *  - p/end: Byte range to scan
+ * Outputs:
+ *  - const char*: First '\n', or end
+ * Theory of operation:
+ *  - Skips comment text (REM, apostrophe) a block at a time.
+ */
+const char* scanLineEnd(const char* p, const char* end) {
+    return simd::findFirst<Newline, true>(p, end);
+}
+
+} // namespace gwbasic
@@ -0,0 +1,28 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/lexer/Scan.h"
+#include "basic_compiler/lexer/Simd.h"
+
+namespace gwbasic {
+
+namespace {
+struct QuoteOrEscape {
+    static simd::Block vec(simd::Block v) { return simd::any(simd::eq(v, '"'), simd::eq(v, '\\')); }
+    static bool byte(unsigned char c) { return c == '"' || c == '\\'; }
+};
+} // namespace
+
+/*
+ * Function: scanStringBody
+ * Inputs:
+ *  - p/end: Byte range to scan (inside a string literal)
+ * Outputs:
+ *  - const char*: First '"' or '\\', or end
+ * Theory of operation:
+ *  - Plain literal text is skipped a block at a time; the caller handles
+ *    the closing quote or steps over the escape and scans again.
+ */
+const char* scanStringBody(const char* p, const char* end) {
+    return simd::findFirst<QuoteOrEscape, true>(p, end);
+}
+
+} // namespace gwbasic
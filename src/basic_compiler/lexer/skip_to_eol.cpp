@@ -1,5 +1,6 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/Scan.h"
 
 namespace gwbasic {
 
@@ -10,10 +11,11 @@ namespace gwbasic {
  * Outputs:
  *  - void
  * Theory of operation:
- *  - Consumes characters until a newline or end-of-input is reached.
+ *  - Jumps to the next newline (or end-of-input) with scanLineEnd(); the
+ *    newline itself is left for the caller.
  */
 void Lexer::skipToEOL() {
-    while (!atEnd() && peek() != '\n') advance();
+    skipTo(scanLineEnd(cursor(), limit()));
 }
 
 } // namespace gwbasic
@@ -1,5 +1,6 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/Scan.h"
 
 namespace gwbasic {
 
@@ -10,21 +11,15 @@ namespace gwbasic {
  * Outputs:
  *  - void
  * Theory of operation:
- *  - Advances past spaces, tabs and carriage returns. If an apostrophe is
- *    encountered, treats the rest of the line as a comment and skips to EOL.
+ *  - Skips the run of spaces, tabs and carriage returns with scanBlanks().
+ *    If an apostrophe follows, treats the rest of the line as a comment and
+ *    skips to EOL, then looks for blanks again.
  */
 void Lexer::skipWhitespace() {
-    while (!atEnd()) {
-        const char c = peek();
-        if (c == ' ' || c == '\t' || c == '\r') {
-            advance();
-            continue;
-        }
-        if (c == '\'') { // comment until end of line
-            skipToEOL();
-            continue;
-        }
-        break;
+    for (;;) {
+        skipTo(scanBlanks(cursor(), limit()));
+        if (peek() != '\'') break; // comment until end of line
+        skipToEOL();
     }
 }
 
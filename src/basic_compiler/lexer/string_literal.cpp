@@ -1,5 +1,6 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
 #include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/Scan.h"
 #include <sstream>
 
 namespace gwbasic {
@@ -9,31 +10,33 @@ namespace gwbasic {
  * Inputs:
  *  - none (expects current char to be '"')
  * Outputs:
- *  - Token: STRING token with unescaped contents and source location
+ *  - Token: STRING token whose lexeme views the raw contents between the
+ *    quotes, plus source location
  * Theory of operation:
- *  - Consumes the opening quote, then scans until the closing quote,
- *    handling simple escapes (\n, \t, \", \\). Throws on unterminated strings.
+ *  - Consumes the opening quote, then jumps between quote/backslash bytes
+ *    with scanStringBody(), stepping over simple escapes (\n, \t, \", \\)
+ *    so an escaped quote does not end the literal. Decoding is deferred to
+ *    unescapeStringLiteral() and only happens for literals that contain a
+ *    backslash. A literal spanning lines updates the line state once, from
+ *    its newline count. Throws on unterminated strings.
  */
 Token Lexer::stringLiteral() {
     const int startLine = line_;
-    const int startCol = col_;
-    std::string buf;
+    const int startCol = col();
     advance(); // opening quote
-    while (!atEnd()) {
-        if (const char c = advance(); c == '\\') {
-            if (atEnd()) break;
-            switch (const char n = advance()) {
-                case 'n': buf.push_back('\n'); break;
-                case 't': buf.push_back('\t'); break;
-                case '"': buf.push_back('"'); break;
-                case '\\': buf.push_back('\\'); break;
-                default: buf.push_back(n); break;
-            }
-        } else if (c == '"') {
-            return Token{TokenType::String, buf, startLine, startCol};
-        } else {
-            buf.push_back(c);
+    const size_t start = pos_;
+    for (const char* p = cursor(); (p = scanStringBody(p, limit())) != limit(); p += 2) {
+        if (*p != '"') {
+            if (p + 1 == limit()) break; // backslash at end of input
+            continue;
         }
+        const std::string_view body = src_.substr(start, static_cast<size_t>(p - src_.data()) - start);
+        if (const size_t nl = countNewlines(body.data(), body.data() + body.size())) {
+            line_ += static_cast<int>(nl);
+            lineStart_ = start + body.rfind('\n') + 1;
+        }
+        skipTo(p + 1);
+        return Token{TokenType::String, body, startLine, startCol};
     }
     {
         std::ostringstream m; m << "Unterminated string literal at line " << startLine; throw LexError(m.str());
@@ -0,0 +1,26 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/token/TokenStream.h"
+#include "basic_compiler/Lexer.h"
+
+namespace gwbasic {
+
+/*
+ * Function: TokenStream::pull
+ * Inputs:
+ *  - none (reads from the Lexer or the buffered vector)
+ * Outputs:
+ *  - Token: next token for the lookahead window
+ * Theory of operation:
+ *  - Streaming mode asks the lexer for one token (it repeats EndOfFile once
+ *    input is exhausted). Buffered mode walks the vector; past its end the
+ *    final EndOfFile is repeated, or synthesized if the vector lacks one.
+ */
+Token TokenStream::pull() {
+    if (lexer_) return lexer_->next();
+    if (pos_ < buffered_.size()) return buffered_[pos_++];
+    if (!buffered_.empty() && buffered_.back().type == TokenType::EndOfFile) return buffered_.back();
+    const int line = buffered_.empty() ? 1 : buffered_.back().line;
+    return Token{TokenType::EndOfFile, "", line, 1};
+}
+
+} // namespace gwbasic
@@ -0,0 +1,31 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Lexer.h"
+
+namespace gwbasic {
+
+/*
+ * Function: unescapeStringLiteral
+ * Inputs:
+ *  - raw: String token lexeme (body between the quotes, escapes intact)
+ * Outputs:
+ *  - std::string: decoded literal value
+ * Theory of operation:
+ *  - Maps \n, \t, \", \\ to their characters and any other \x to x, the
+ *    same rules the lexer applied when it decoded literals eagerly.
+ */
+std::string unescapeStringLiteral(std::string_view raw) {
+    std::string out;
+    out.reserve(raw.size());
+    for (size_t i = 0; i < raw.size(); ++i) {
+        const char c = raw[i];
+        if (c != '\\' || i + 1 == raw.size()) { out.push_back(c); continue; }
+        switch (const char n = raw[++i]) {
+            case 'n': out.push_back('\n'); break;
+            case 't': out.push_back('\t'); break;
+            default: out.push_back(n); break;
+        }
+    }
+    return out;
+}
+
+} // namespace gwbasic
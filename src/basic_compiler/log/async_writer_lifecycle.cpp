@@ -0,0 +1,42 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/log/AsyncWriter.h"
+
+namespace gwbasic::logging {
+
+/*
+ * Function: AsyncWriter::instance
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - AsyncWriter&: the process-wide writer (thread started on first call)
+ * Theory of operation:
+ *  - Function-local static: thread-safe initialisation, and runs that never
+ *    enable a log never start the thread.
+ */
+AsyncWriter& AsyncWriter::instance() {
+    static AsyncWriter writer;
+    return writer;
+}
+
+AsyncWriter::AsyncWriter() : thread_([this] { run(); }) {}
+
+/*
+ * Function: AsyncWriter::~AsyncWriter
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - none (queued batches written; thread joined; batches freed)
+ * Theory of operation:
+ *  - Channels wait for their own batches on close, so normally nothing is
+ *    queued here; run() still drains the ring before exiting.
+ */
+AsyncWriter::~AsyncWriter() {
+    stop_.store(true, std::memory_order_release);
+    wake_.fetch_add(1, std::memory_order_release);
+    wake_.notify_one();
+    if (thread_.joinable()) thread_.join();
+    Batch* b = nullptr;
+    while (free_.tryPop(b)) delete b;
+}
+
+} // namespace gwbasic::logging
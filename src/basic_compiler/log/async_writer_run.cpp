@@ -0,0 +1,38 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/log/AsyncWriter.h"
+
+namespace gwbasic::logging {
+
+/*
+ * Function: AsyncWriter::run
+ * Inputs:
+ *  - none (writer thread body)
+ * Outputs:
+ *  - void (returns once stopped and the ring is empty)
+ * Theory of operation:
+ *  - Reads the wake counter before polling, so a submit() landing between a
+ *    failed pop and the wait changes the counter and the wait returns at
+ *    once (no lost wake-ups). Each batch is one write() on its stream; the
+ *    owning Channel's pending count is then released. Waiters sleep on the
+ *    writer's own written_ counter, never on pending, because the Channel
+ *    may be destroyed as soon as pending reaches zero.
+ */
+void AsyncWriter::run() {
+    for (;;) {
+        const std::uint32_t seen = wake_.load(std::memory_order_acquire);
+        Batch* b = nullptr;
+        if (!full_.tryPop(b)) {
+            if (stop_.load(std::memory_order_acquire)) return;
+            wake_.wait(seen, std::memory_order_acquire);
+            continue;
+        }
+        b->file->write(b->data, static_cast<std::streamsize>(b->size));
+        std::atomic<std::uint32_t>* pending = b->pending;
+        recycle(b);
+        pending->fetch_sub(1, std::memory_order_release);
+        written_.fetch_add(1, std::memory_order_release);
+        written_.notify_all();
+    }
+}
+
+} // namespace gwbasic::logging
@@ -0,0 +1,66 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/log/AsyncWriter.h"
+
+namespace gwbasic::logging {
+
+/*
+ * Function: AsyncWriter::acquire
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - Batch*: empty batch (recycled when available, else newly allocated)
+ */
+Batch* AsyncWriter::acquire() {
+    Batch* b = nullptr;
+    if (!free_.tryPop(b)) b = new Batch;
+    b->size = 0;
+    return b;
+}
+
+/*
+ * Function: AsyncWriter::submit
+ * Inputs:
+ *  - b: filled batch; its Channel has already counted it as pending
+ * Outputs:
+ *  - void (b owned by the writer from here on)
+ * Theory of operation:
+ *  - Lock-free push; if the writer is kInFlight batches behind, yield until
+ *    it catches up. The wake counter change lets a sleeping writer resume;
+ *    notify is cheap when nobody waits.
+ */
+void AsyncWriter::submit(Batch* b) {
+    while (!full_.tryPush(b)) std::this_thread::yield();
+    wake_.fetch_add(1, std::memory_order_release);
+    wake_.notify_one();
+}
+
+/*
+ * Function: AsyncWriter::recycle
+ * Inputs:
+ *  - b: written batch
+ * Outputs:
+ *  - void (b back on the free ring, or freed when the ring is full)
+ */
+void AsyncWriter::recycle(Batch* b) {
+    if (!free_.tryPush(b)) delete b;
+}
+
+/*
+ * Function: AsyncWriter::waitFor
+ * Inputs:
+ *  - pending: a Channel's count of submitted, unwritten batches
+ * Outputs:
+ *  - void (returns once pending is zero)
+ * Theory of operation:
+ *  - Samples written_ before testing pending, so a batch finishing in
+ *    between changes written_ and the wait returns immediately.
+ */
+void AsyncWriter::waitFor(const std::atomic<std::uint32_t>& pending) {
+    for (;;) {
+        const std::uint32_t seen = written_.load(std::memory_order_acquire);
+        if (pending.load(std::memory_order_acquire) == 0) return;
+        written_.wait(seen, std::memory_order_acquire);
+    }
+}
+
+} // namespace gwbasic::logging
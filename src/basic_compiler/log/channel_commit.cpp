@@ -0,0 +1,83 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/log/Log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace gwbasic::logging {
+
+/*
+ * Function: Channel::commit
+ * Inputs:
+ *  - line: one complete, newline-terminated record
+ * Outputs:
+ *  - void
+ * Theory of operation:
+ *  - Appends to the current batch, submitting it when the line does not
+ *    fit. Lines longer than a batch are split across consecutive batches;
+ *    the writer keeps per-channel order, so the file is unaffected.
+ */
+void Channel::commit(std::string_view line) {
+    while (!line.empty()) {
+        if (!batch_) batch_ = AsyncWriter::instance().acquire();
+        const std::size_t room = Batch::kBytes - batch_->size;
+        if (line.size() > room && batch_->size != 0) {
+            submitBatch();
+            continue;
+        }
+        const std::size_t n = std::min(room, line.size());
+        std::memcpy(batch_->data + batch_->size, line.data(), n);
+        batch_->size += n;
+        line.remove_prefix(n);
+        if (batch_->size == Batch::kBytes) submitBatch();
+    }
+}
+
+/*
+ * Function: Channel::submitBatch
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - void (current batch queued; pending_ counts it until written)
+ */
+void Channel::submitBatch() {
+    if (!batch_ || batch_->size == 0 || !file_.is_open()) return;
+    batch_->file = &file_;
+    batch_->pending = &pending_;
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    AsyncWriter::instance().submit(batch_);
+    batch_ = nullptr;
+}
+
+/*
+ * Function: Channel::defined
+ * Inputs:
+ *  - id: call-site id about to be written
+ * Outputs:
+ *  - bool: true when the site was already described in this file (the
+ *    caller writes the description when false; it is marked now)
+ */
+bool Channel::defined(std::uint32_t id) {
+    if (id >= sitesDefined_.size()) sitesDefined_.resize(id + 64, 0);
+    if (sitesDefined_[id]) return true;
+    sitesDefined_[id] = 1;
+    return false;
+}
+
+/*
+ * Function: Channel::previous
+ * Inputs:
+ *  - id: call-site id
+ *  - parts: number of fragments the site writes
+ * Outputs:
+ *  - std::string*: first of `parts` previous values, one per fragment
+ *    (only string slots use theirs)
+ */
+std::string* Channel::previous(std::uint32_t id, std::size_t parts) {
+    if (id >= sitePrevious_.size()) sitePrevious_.resize(id + 64);
+    auto& prev = sitePrevious_[id];
+    if (prev.size() < parts) prev.resize(parts);
+    return prev.data();
+}
+
+} // namespace gwbasic::logging
@@ -0,0 +1,69 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/log/Log.h"
+
+namespace gwbasic::logging {
+
+/*
+ * Function: Channel::open
+ * Inputs:
+ *  - path: log file to create/truncate
+ *  - threshold: lowest Level written at runtime
+ *  - format: Text lines or Binary records (log/LogFormat.h)
+ * Outputs:
+ *  - bool: true when the file is open and the channel enabled
+ * Theory of operation:
+ *  - Reopening closes the previous file first. The threshold only takes
+ *    effect once the file is open, so enabled() stays a single compare.
+ *    The stream is unbuffered: the writer thread hands it whole batches.
+ *    Binary files start with the format magic and a fresh site/string
+ *    state, since each file must decode on its own.
+ */
+bool Channel::open(const std::string& path, Level threshold, Format format) {
+    close();
+    file_.rdbuf()->pubsetbuf(nullptr, 0);
+    file_.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file_.is_open()) return false;
+    format_ = format;
+    sitesDefined_.clear();
+    sitePrevious_.clear();
+    if (format_ == Format::Binary) {
+        cache_ = std::make_unique<wire::StringCache>();
+        commit(std::string_view(wire::kMagic, sizeof(wire::kMagic)));
+    } else {
+        cache_.reset();
+    }
+    threshold_ = threshold;
+    return true;
+}
+
+/*
+ * Function: Channel::flush
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - void (all lines logged so far are in the file)
+ * Theory of operation:
+ *  - Submits the partial batch, then waits on the writer until this
+ *    channel has nothing in flight.
+ */
+void Channel::flush() {
+    submitBatch();
+    if (pending_.load(std::memory_order_acquire) != 0) AsyncWriter::instance().waitFor(pending_);
+}
+
+/*
+ * Function: Channel::close
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - void (file complete and closed; channel disabled)
+ */
+void Channel::close() {
+    threshold_ = Level::Off;
+    flush();
+    delete batch_; // only an unused, empty batch can remain
+    batch_ = nullptr;
+    if (file_.is_open()) file_.close();
+}
+
+} // namespace gwbasic::logging
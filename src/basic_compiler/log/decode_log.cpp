@@ -0,0 +1,142 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/log/LogFormat.h"
+#include "basic_compiler/codegen/IrSink.h"
+
+#include <bit>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace gwbasic::logging::wire {
+
+namespace {
+
+struct Part {
+    PartCode code;
+    std::string text; // kLiteral: constant text; kString: previous value
+};
+
+[[noreturn]] void corrupt(const char* what) {
+    throw std::runtime_error(std::string("Malformed binary log: ").append(what));
+}
+
+std::uint64_t varint(const char*& p, const char* end) {
+    std::uint64_t v = 0;
+    if (!getVarint(p, end, v)) corrupt("truncated varint");
+    return v;
+}
+
+} // namespace
+
+void decodeLog(std::string_view data, IrSink& out) {
+    /*
+     * Function: wire::decodeLog
+     * Inputs:
+     *  - data: whole binary log, beginning with kMagic
+     *  - out: sink for rendered text
+     * Outputs:
+     *  - void (one text line per event record; throws on malformed input)
+     * Theory of operation:
+     *  - Keeps the site table, each string argument's previous value and a
+     *    StringCache in lockstep with the encoder: site definitions fill the
+     *    table, delta-coded strings are rebuilt from the previous value and
+     *    cached at the slot the encoder used, and each event renders its
+     *    site's parts in order exactly as logging::append() formats them.
+     */
+    if (!isBinaryLog(data)) corrupt("missing header");
+    const char* p = data.data() + sizeof(kMagic);
+    const char* const end = data.data() + data.size();
+    std::vector<std::vector<Part>> sites;
+    StringCache cache;
+    std::string scratch;
+    char num[32];
+
+    while (p < end) {
+        const std::uint64_t tag = varint(p, end);
+        if (tag == 0) {
+            const std::uint64_t id = varint(p, end);
+            const std::uint64_t count = varint(p, end);
+            if (id == 0 || id > (1u << 24) || count > 1024) corrupt("bad site definition");
+            if (id >= sites.size()) sites.resize(id + 1);
+            std::vector<Part>& parts = sites[id];
+            parts.clear();
+            for (std::uint64_t i = 0; i < count; ++i) {
+                if (p >= end) corrupt("truncated site definition");
+                const auto code = static_cast<PartCode>(*p++);
+                switch (code) {
+                    case kLiteral: {
+                        const std::uint64_t len = varint(p, end);
+                        if (len > static_cast<std::uint64_t>(end - p)) corrupt("truncated literal");
+                        parts.push_back({code, std::string(p, len)});
+                        p += len;
+                        break;
+                    }
+                    case kSigned:
+                    case kUnsigned:
+                    case kChar:
+                    case kFloat:
+                    case kString:
+                        parts.push_back({code, {}});
+                        break;
+                    default:
+                        corrupt("unknown part code");
+                }
+            }
+            continue;
+        }
+        if (tag >= sites.size() || sites[tag].empty()) corrupt("record for undefined site");
+        for (Part& part : sites[tag]) {
+            switch (part.code) {
+                case kLiteral:
+                    out << part.text;
+                    break;
+                case kSigned:
+                    out << unzigzag(varint(p, end));
+                    break;
+                case kUnsigned:
+                    out << varint(p, end);
+                    break;
+                case kChar:
+                    if (p >= end) corrupt("truncated char");
+                    out << *p++;
+                    break;
+                case kFloat: {
+                    if (end - p < 8) corrupt("truncated double");
+                    std::uint64_t bits = 0;
+                    for (int i = 7; i >= 0; --i) bits = (bits << 8) | static_cast<unsigned char>(p[i]);
+                    p += 8;
+                    const auto r = std::to_chars(num, num + sizeof(num), std::bit_cast<double>(bits));
+                    out << std::string_view(num, static_cast<std::size_t>(r.ptr - num));
+                    break;
+                }
+                case kString: {
+                    const std::uint64_t v = varint(p, end);
+                    std::string& prev = part.text;
+                    if (v & 1) {
+                        const std::uint64_t len = v >> 1;
+                        const std::uint64_t pre = varint(p, end);
+                        const std::uint64_t suf = varint(p, end);
+                        if (pre + suf > prev.size() || len > static_cast<std::uint64_t>(end - p))
+                            corrupt("bad string delta");
+                        scratch.assign(prev, 0, pre);
+                        scratch.append(p, len);
+                        scratch.append(prev, prev.size() - suf, suf);
+                        p += len;
+                        prev.swap(scratch);
+                        if (prev.size() <= kCacheMaxLen) cache.store(StringCache::slotOf(prev), prev);
+                    } else {
+                        if ((v >> 1) >= kCacheSlots) corrupt("bad string slot");
+                        prev = cache.at(v >> 1);
+                    }
+                    out << prev;
+                    break;
+                }
+            }
+        }
+        out << '\n';
+    }
+    out.flush();
+}
+
+} // namespace gwbasic::logging::wire
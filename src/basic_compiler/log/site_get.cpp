@@ -0,0 +1,27 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/log/Log.h"
+
+namespace gwbasic::logging {
+
+/*
+ * Function: Site::get
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - std::uint32_t: this call site's id (>= 1; 0 marks a site definition
+ *    record in the binary format)
+ * Theory of operation:
+ *  - Ids come from a process-wide counter on first use. Racing threads may
+ *    both draw a number; the CAS keeps the first and the loser's number is
+ *    simply never used.
+ */
+std::uint32_t Site::get() {
+    std::uint32_t v = id.load(std::memory_order_acquire);
+    if (v != 0) return v;
+    static std::atomic<std::uint32_t> next{1};
+    const std::uint32_t mine = next.fetch_add(1, std::memory_order_relaxed);
+    if (id.compare_exchange_strong(v, mine, std::memory_order_acq_rel)) return mine;
+    return v;
+}
+
+} // namespace gwbasic::logging
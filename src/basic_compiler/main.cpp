@@ -6,7 +6,10 @@
 #include <filesystem>
 #include <cstdlib>
 #include <cctype>
+#include <csignal>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 #include "basic_compiler/Compiler.h"
 #include "basic_compiler/AsmUtils.h"
@@ -14,6 +17,7 @@
 #include "basic_compiler/Usage.h"
 #include "basic_compiler/cli/TakeOptValue.h"
 #include "basic_compiler/cli/TakeOptValues.h"
+#include "basic_compiler/opt/PassManager.h"
 
 /**
  * Function: main
@@ -25,6 +29,11 @@
  *  - Parses CLI flags, compiles the input BASIC file through the compiler
  *    pipeline with optional phase logs, and optionally materializes IR,
  *    bitcode, assembly, or a linked executable using the configured clang.
+ *    The -O level selects the AST pass pipeline and is passed on to clang;
+ *    --unroll-threshold overrides the level's loop-unrolling budget;
+ *    each --specialize VAR=value turns INPUT of VAR into that constant.
+ *    IR is streamed to its destination (the .ll file, clang's stdin, or
+ *    stdout) while it is generated.
  */
 int main(int argc, char** argv) {
     using gwbasic::cli::takeOptValue; // bring CLI helpers into scope
@@ -45,9 +54,33 @@ int main(int argc, char** argv) {
     std::optional<std::string> lexLogPath;
     std::optional<std::string> syntaxLogPath;
     std::optional<std::string> semanticLogPath;
+    gwbasic::OptOptions optOptions;
+    std::optional<std::string> unrollThreshold;
+    std::optional<std::string> specialize;
+    bool optStats = false;
     for (int i = 2; i < argc; ++i) {
         std::string a = argv[i];
 
+        // Optimization level (front-end passes + clang) and pass statistics
+        if (gwbasic::parseOptLevel(a, optOptions.level)) continue;
+        if (a == "--opt-stats") { optStats = true; continue; }
+        if (takeOptValue(a, "--unroll-threshold", i, argc, argv, unrollThreshold)) continue;
+        if (takeOptValue(a, "--specialize", i, argc, argv, specialize)) {
+            gwbasic::Specialization s;
+            if (!gwbasic::parseSpecialization(*specialize, s)) {
+                std::cerr << "Error: --specialize expects VAR=value, got: " << *specialize << "\n";
+                return 2;
+            }
+            for (const auto& other : optOptions.specializations) {
+                if (other.name == s.name) {
+                    std::cerr << "Error: --specialize given twice for " << s.name << "\n";
+                    return 2;
+                }
+            }
+            optOptions.specializations.push_back(s);
+            continue;
+        }
+
         // Outputs
         if (takeOptValue(a, "--bc", i, argc, argv, outBC)) continue;     // LLVM bitcode (.bc)
         if (takeOptValue(a, {"-ll", "--ll"}, i, argc, argv, outLL)) continue;   // LLVM IR text (.ll)
@@ -69,6 +102,14 @@ int main(int argc, char** argv) {
         usage(argv[0]);
         return 2;
     }
+    if (unrollThreshold) {
+        const std::string& v = *unrollThreshold;
+        if (v.empty() || v.size() > 9 || v.find_first_not_of("0123456789") != std::string::npos) {
+            std::cerr << "Error: --unroll-threshold expects a non-negative integer, got: " << v << "\n";
+            return 2;
+        }
+        optOptions.unrollThreshold = std::stoi(v);
+    }
     if (targetTriple && !isSupportedTargetTriple(*targetTriple)) {
         std::cerr << "Error: unsupported target triple: " << *targetTriple
                   << " (supported: x86_64 or arm64/aarch64 on Linux/macOS/FreeBSD/Android)\n";
@@ -90,94 +131,114 @@ int main(int argc, char** argv) {
             std::filesystem::path p = input; p.replace_extension(".semantic.log"); semanticLogPath = p.string();
         }
 
-        std::string ir = gwbasic::Compiler::compileFileWithPhaseLogs(
-            input,
-            *lexLogPath,
-            *syntaxLogPath,
-            *semanticLogPath,
-            *logPath);
+        auto compileInto = [&](gwbasic::IrSink& sink) {
+            gwbasic::PassStats stats;
+            gwbasic::Compiler::compileFileWithPhaseLogs(
+                input,
+                *lexLogPath,
+                *syntaxLogPath,
+                *semanticLogPath,
+                *logPath,
+                sink,
+                gwbasic::logging::Format::Binary,
+                optOptions,
+                &stats);
+            if (optStats) stats.print(std::cerr);
+        };
 
-        if (outLL) {
-            std::ofstream out(*outLL);
-            out << ir;
-        }
-        if (outBC) {
+        // clang jobs for native outputs. IR is read from the .ll file when
+        // one is requested; otherwise it is piped to each clang on stdin, so
+        // no temporary .ll is written and the module is never held in memory.
+        struct ClangJob {
+            std::string cmd;
+            const char* failure;
+        };
+        std::vector<ClangJob> jobs;
 #ifdef CLANG_PATH
-            std::filesystem::path llTmp;
-            if (outLL) {
-                llTmp = *outLL;
-            } else {
-                llTmp = std::filesystem::path(*outBC).replace_extension(".ll");
-                std::ofstream out(llTmp);
-                out << ir;
+        std::string triple;
+        const char* opt = gwbasic::optLevelFlag(optOptions.level);
+        {
+            const std::string irIn = outLL ? "\"" + *outLL + "\"" : std::string("-");
+            if (outBC) {
+                std::ostringstream oss;
+                oss << CLANG_PATH << ' ' << opt << " -c -emit-llvm -x ir " << irIn << " -o \"" << *outBC << "\"";
+                jobs.push_back({oss.str(), "clang failed assembling bitcode: "});
             }
-            std::ostringstream oss;
-            oss << CLANG_PATH << " -c -emit-llvm -x ir \"" << llTmp.string() << "\" -o \"" << *outBC << "\"";
-            std::string cmd = oss.str();
-            int ec = std::system(cmd.c_str());
-            if (ec != 0) {
-                std::cerr << "clang failed assembling bitcode: " << cmd << "\n";
-                return 1;
+            if (outBIN) {
+                std::ostringstream oss;
+                oss << CLANG_PATH << ' ' << opt << ' ';
+                if (targetTriple) oss << "-target \"" << *targetTriple << "\" ";
+                oss << "-x ir " << irIn << " -o \"" << *outBIN << "\"";
+                jobs.push_back({oss.str(), "clang failed linking executable: "});
+            }
+            if (outASM) {
+                if (!outLL) {
+                    std::filesystem::path asmOut = *outASM;
+                    if (asmOut.extension() != ".asm") asmOut += ".asm";
+                    // reflect enforced name back to outASM for consistency
+                    outASM = asmOut.string();
+                }
+                triple = targetTriple.value_or(std::string("arm64-apple-macos"));
+                if (!isSupportedTargetTriple(triple)) {
+                    std::cerr << "Error: unsupported target triple for assembly: " << triple
+                              << " (supported: x86_64 or arm64/aarch64 on Linux/macOS/FreeBSD/Android)\n";
+                    return 2;
+                }
+                std::ostringstream oss;
+                oss << CLANG_PATH << ' ' << opt << " -S -x ir -target " << triple << ' ' << irIn << " -o \"" << *outASM << "\"";
+                jobs.push_back({oss.str(), "clang failed generating assembly: "});
             }
-#else
-            std::cerr << "CLANG_PATH not defined at build time; cannot emit bitcode" << "\n";
-            return 1;
-#endif
         }
-        if (outBIN) {
-#ifdef CLANG_PATH
-            std::filesystem::path llTmp;
-            if (outLL) {
-                llTmp = *outLL;
-            } else {
-                llTmp = std::filesystem::path(*outBIN).replace_extension(".ll");
-                std::ofstream out(llTmp);
-                out << ir;
+#endif
+
+        if (outLL) {
+            try {
+                gwbasic::FileSink ll(*outLL);
+                compileInto(ll);
+            } catch (...) {
+                // Don't leave a truncated module behind after a codegen error.
+                std::error_code ignored;
+                std::filesystem::remove(*outLL, ignored);
+                throw;
             }
-            std::ostringstream oss;
-            oss << CLANG_PATH << ' ';
-            if (targetTriple) oss << "-target \"" << *targetTriple << "\" ";
-            oss << '"' << llTmp.string() << "\" -o \"" << *outBIN << "\"";
-            std::string cmd = oss.str();
-            int ec = std::system(cmd.c_str());
-            if (ec != 0) {
-                std::cerr << "clang failed linking executable: " << cmd << "\n";
-                return 1;
+            for (const auto& job : jobs) {
+                int ec = std::system(job.cmd.c_str());
+                if (ec != 0) {
+                    std::cerr << job.failure << job.cmd << "\n";
+                    return 1;
+                }
             }
-#else
-            std::cerr << "CLANG_PATH not defined at build time; cannot emit executable" << "\n";
-            return 1;
+        } else if (!jobs.empty()) {
+#ifdef SIGPIPE
+            // A clang that exits early must surface as its exit status, not kill us.
+            std::signal(SIGPIPE, SIG_IGN);
 #endif
-        }
-        if (outASM) {
-#ifdef CLANG_PATH
-            std::filesystem::path llTmp;
-            if (outLL) {
-                llTmp = *outLL;
-            } else {
-                std::filesystem::path asmOut = *outASM;
-                if (asmOut.extension() != ".asm") asmOut += ".asm";
-                // reflect enforced name back to outASM for consistency
-                outASM = asmOut.string();
-                llTmp = asmOut;
-                llTmp.replace_extension(".ll");
-                std::ofstream out(llTmp);
-                out << ir;
+            std::vector<std::unique_ptr<gwbasic::PipeSink>> pipes;
+            std::vector<gwbasic::IrSink*> targets;
+            for (const auto& job : jobs) {
+                pipes.push_back(std::make_unique<gwbasic::PipeSink>(job.cmd));
+                targets.push_back(pipes.back().get());
             }
-            std::string triple = targetTriple.value_or(std::string("arm64-apple-macos"));
-            if (!isSupportedTargetTriple(triple)) {
-                std::cerr << "Error: unsupported target triple for assembly: " << triple
-                          << " (supported: x86_64 or arm64/aarch64 on Linux/macOS/FreeBSD/Android)\n";
-                return 2;
+            if (targets.size() == 1) {
+                compileInto(*targets.front());
+            } else {
+                gwbasic::TeeSink tee(targets);
+                compileInto(tee);
             }
-            std::ostringstream oss;
-            oss << CLANG_PATH << " -S -x ir -target " << triple << " \"" << llTmp.string() << "\" -o \"" << *outASM << "\"";
-            std::string cmd = oss.str();
-            int ec = std::system(cmd.c_str());
-            if (ec != 0) {
-                std::cerr << "clang failed generating assembly: " << cmd << "\n";
-                return 1;
+            for (size_t j = 0; j < jobs.size(); ++j) {
+                int ec = pipes[j]->close();
+                if (ec != 0) {
+                    std::cerr << jobs[j].failure << jobs[j].cmd << "\n";
+                    return 1;
+                }
             }
+        } else if (!outBC && !outBIN && !outASM) {
+            gwbasic::FileSink stdoutSink(1);
+            compileInto(stdoutSink);
+        }
+
+#ifdef CLANG_PATH
+        if (outASM) {
             // Prepend header comment with source file and target info
             try {
                 auto srcName = std::filesystem::path(input).filename().string();
@@ -203,14 +264,21 @@ int main(int argc, char** argv) {
             } catch (const std::exception& ex) {
                 std::cerr << "warning: failed to prepend ASM header: " << ex.what() << "\n";
             }
+        }
 #else
-            std::cerr << "CLANG_PATH not defined at build time; cannot emit assembly" << "\n";
+        if (outBC) {
+            std::cerr << "CLANG_PATH not defined at build time; cannot emit bitcode" << "\n";
+            return 1;
+        }
+        if (outBIN) {
+            std::cerr << "CLANG_PATH not defined at build time; cannot emit executable" << "\n";
             return 1;
-#endif
         }
-        if (!outLL && !outBC && !outBIN && !outASM) {
-            std::cout << ir;
+        if (outASM) {
+            std::cerr << "CLANG_PATH not defined at build time; cannot emit assembly" << "\n";
+            return 1;
         }
+#endif
         return 0;
     } catch (const std::exception& ex) {
         std::cerr << "Error: " << ex.what() << "\n";
@@ -0,0 +1,45 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/opt/AnalysisCache.h"
+
+namespace gwbasic {
+
+std::vector<std::uintptr_t> AnalysisCache::shapeOf(const Program& program) {
+    /*
+     * Function: AnalysisCache::shapeOf
+     * Inputs:
+     *  - program: AST
+     * Outputs:
+     *  - The values the cached analyses depend on, in program order
+     * Theory of operation:
+     *  - Nodes are never freed before the Program, so a statement address
+     *    names one statement for good: comparing addresses is enough to
+     *    tell a rewritten expression (same statements) from a replaced,
+     *    removed or inserted statement. Line numbers and jump targets are
+     *    plain fields and are recorded by value; the line array's address
+     *    covers the graph's pointers into it.
+     */
+    std::vector<std::uintptr_t> shape;
+    auto add = [&](const void* p) { shape.push_back(reinterpret_cast<std::uintptr_t>(p)); };
+    add(program.lines.data());
+    shape.push_back(program.lines.size());
+    for (const Line& line : program.lines) {
+        shape.push_back(static_cast<std::uintptr_t>(line.number));
+        shape.push_back(line.statements.size());
+        for (const auto& st : line.statements) {
+            add(st.get());
+            if (const auto* fs = astCast<ForStmt>(st.get())) {
+                shape.push_back(fs->body.size());
+                for (const auto& bs : fs->body) add(bs.get());
+            } else if (const auto* is = astCast<IfStmt>(st.get())) {
+                shape.push_back(static_cast<std::uintptr_t>(is->targetLine));
+            } else if (const auto* gs = astCast<GotoStmt>(st.get())) {
+                shape.push_back(static_cast<std::uintptr_t>(gs->targetLine));
+            } else if (const auto* gss = astCast<GosubStmt>(st.get())) {
+                shape.push_back(static_cast<std::uintptr_t>(gss->targetLine));
+            }
+        }
+    }
+    return shape;
+}
+
+} // namespace gwbasic
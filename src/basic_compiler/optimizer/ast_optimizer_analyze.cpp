@@ -0,0 +1,43 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_analyze.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::analyze`, which hands out the program's shared
+ *    analyses and rebuilds them when the statements change.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/AnalysisCache.h"
+#include <memory>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::analyze
+ * Purpose:
+ *  - Reuse the analyses kept in the program's arena (AstArena::analyses)
+ *    while they describe the program.
+ * Inputs:
+ *  - program: AST root
+ * Outputs:
+ *  - The up-to-date analyses, owned by the program's arena
+ * Details:
+ *  - The cache is kept when its shape matches the program's (only
+ *    expressions were rewritten since). Otherwise the graph and reaching
+ *    definitions are rebuilt and the constants of the definitions solved
+ *    before anyone asks about a read.
+ */
+AnalysisCache& AstOptimizer::analyze(Program& program) {
+    std::vector<std::uintptr_t> shape = AnalysisCache::shapeOf(program);
+    std::shared_ptr<AnalysisCache>& kept = program.arena->analyses();
+    if (kept && kept->shape == shape) return *kept;
+    auto facts = std::make_shared<AnalysisCache>();
+    facts->shape = std::move(shape);
+    facts->symbols = &program.arena->symbols();
+    facts->cfg.build(program);
+    facts->rd.build(program, facts->cfg);
+    solveConstants(*facts);
+    kept = std::move(facts);
+    return *kept;
+}
+
+} // namespace gwbasic
@@ -21,7 +21,7 @@ namespace gwbasic {
  *    `out` is assigned the contained number.
  */
 bool AstOptimizer::asNumber(const Expr* e, double& out) {
-    if (const auto n = dynamic_cast<const NumberExpr*>(e)) { out = n->value; return true; }
+    if (const auto* n = astCast<NumberExpr>(e)) { out = n->value; return true; }
     return false;
 }
 
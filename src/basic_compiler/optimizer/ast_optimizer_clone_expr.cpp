@@ -0,0 +1,59 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_clone_expr.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::cloneExpr`, a deep copy for expressions that
+ *    a rewrite needs in more than one place.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::cloneExpr
+ * Purpose:
+ *  - Copy an expression tree into fresh arena nodes.
+ * Inputs:
+ *  - arena: Program arena
+ *  - e: Expression to copy (may be null)
+ * Outputs:
+ *  - The copy (null for null).
+ * Details:
+ *  - Passes rewrite nodes in place, so a tree must never be reachable
+ *    from two statements; each use gets its own copy.
+ */
+AstRef<Expr> AstOptimizer::cloneExpr(AstArena& arena, const Expr* e) {
+    if (!e) return nullptr;
+    AstRef<Expr> copy;
+    switch (e->kind) {
+        case ExprKind::Number: {
+            auto* n = arena.make<NumberExpr>(static_cast<const NumberExpr*>(e)->value);
+            n->type = e->type;
+            n->flexible = e->flexible;
+            copy = n;
+            break;
+        }
+        case ExprKind::Var:
+            copy = arena.make<VarExpr>(*static_cast<const VarExpr*>(e));
+            break;
+        case ExprKind::String:
+            copy = arena.make<StringExpr>(*static_cast<const StringExpr*>(e));
+            break;
+        case ExprKind::Unary: {
+            const auto* u = static_cast<const UnaryExpr*>(e);
+            copy = arena.make<UnaryExpr>(u->op, cloneExpr(arena, u->inner.get()));
+            break;
+        }
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            copy = arena.make<BinaryExpr>(b->op, cloneExpr(arena, b->lhs.get()), cloneExpr(arena, b->rhs.get()));
+            break;
+        }
+        default:
+            return nullptr;
+    }
+    copy->pos = e->pos;
+    return copy;
+}
+
+} // namespace gwbasic
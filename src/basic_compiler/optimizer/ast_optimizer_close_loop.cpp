@@ -0,0 +1,266 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_close_loop.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::closeLoop`, which derives the closed form of
+ *    one FOR loop for closeRecurrences.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/cfg/Dataflow.h"
+#include <cmath>
+#include <cstdint>
+
+namespace gwbasic {
+
+namespace {
+
+constexpr std::int64_t kMaxSimulated = std::int64_t{1} << 16; // iterations interpreted per loop
+constexpr std::int64_t kMaxExactTrips = std::int64_t{1} << 17;
+constexpr double kMaxExactStart = 4503599627370496.0;      // 2^52
+
+/** wrap32: Value modulo 2^32 as the i32 the generated code holds. */
+double wrap32(std::uint32_t v) { return static_cast<std::int32_t>(v); }
+
+} // namespace
+
+/**
+ * Function: AstOptimizer::closeLoop
+ * Purpose:
+ *  - Replace a FOR loop by straight-line assignments that leave every
+ *    variable with the value the loop would.
+ * Inputs:
+ *  - arena: Program arena for the new statements
+ *  - fs: The loop
+ *  - before: Constant values of variables right before the FOR
+ *  - out: Receives the replacement on success (untouched on failure)
+ * Outputs:
+ *  - bool: true when every body assignment has a closed form
+ * Details:
+ *  - The body must consist of assignments to distinct variables other
+ *    than the loop variable; the end and step must not read the loop
+ *    variable or a body target. Each right-hand side may read its own
+ *    target, the loop variable and loop-invariant variables.
+ *  - Trip count. With literal start, end and step it is computed exactly
+ *    as CodeGenerator runs the loop (constantTrips). Otherwise it is a
+ *    runtime expression, available for the counted shape with step 1 and
+ *    an Int or Double variable: n = (E >= S) * (E - S + 1) in Int.
+ *  - Closed forms, tried in order for each body assignment X = rhs:
+ *    1. Known trip count and known reads: the assignments are interpreted
+ *       (evaluate) and X gets the resulting literal.
+ *    2. Int X with an Int `X + t`, `X - t` or `X * t` (wrapping i32
+ *       arithmetic stored to 16 bits, so everything is exact modulo 2^16):
+ *       invariant t gives X + n*t (runtime n allowed) or X * t^n; a t
+ *       that reads the loop variable is summed or multiplied out over the
+ *       known counter values.
+ *    3. Double X with a Double `X + t` or `X - t`, where X starts at a
+ *       known integer and t is Int-valued (an Int expression, a whole
+ *       literal, or the loop variable over 16-bit bounds): every partial
+ *       sum is an integer below 2^53, so the loop adds exactly and the
+ *       closed form X + n*t or X + n*S + n*(n-1)/2 computes the same
+ *       bits.
+ *    4. rhs reading no body target nor the loop variable, with a known
+ *       trip count of at least one: X = rhs.
+ *    Other Single/Double recurrences are left alone: floating additions
+ *    round at every step, and proving a runtime start exact needs INT or
+ *    a branch, which an expression cannot express here.
+ *  - The loop variable finally gets its exit value (S + n*step in the
+ *    counted shape, the first value failing the test otherwise).
+ */
+bool AstOptimizer::closeLoop(AstArena& arena, const ForStmt& fs, const ValueLookup& before,
+                             std::vector<AstRef<Stmt>>& out) {
+    const SymbolTable& symbols = arena.symbols();
+    const SymbolId counter = varOf(symbols, fs.varSym, fs.var);
+    if (counter == kNoSymbol) return false;
+    const NumType varType = typeOfName(fs.var);
+
+    BitSet targets(symbols.size());
+    std::vector<const AssignStmt*> body;
+    for (const auto& bs : fs.body) {
+        const auto* asg = astCast<AssignStmt>(bs.get());
+        if (!asg) return false;
+        const SymbolId x = varOf(symbols, asg->sym, asg->name);
+        if (x == kNoSymbol || x == counter || targets.test(x)) return false;
+        targets.set(x);
+        body.push_back(asg);
+    }
+    auto readsOf = [&](const Expr* e) {
+        BitSet r(symbols.size());
+        addReads(symbols, e, r);
+        return r;
+    };
+    BitSet variant = targets;
+    variant.set(counter);
+    if (readsOf(fs.end.get()).overlaps(variant) || readsOf(fs.step.get()).overlaps(variant)) return false;
+
+    // Trip count: known, or (E >= S) * (E - S + 1) for step-1 counted loops.
+    LoopTrips loop;
+    double step = 1.0;
+    const bool counted = countedShape(fs, step);
+    const bool constant = constantTrips(fs, loop);
+    const std::int64_t trips = loop.count;
+    if (!constant && (!counted || step != 1.0 || varType == NumType::Single || readsOf(fs.start.get()).overlaps(targets)))
+        return false;
+    if (constant && trips == 0) {
+        // The body never runs; only the variable's initial store remains.
+        auto value = makeNumber(arena, loop.exit, VarExpr(Symbol{fs.varSym, fs.var}));
+        if (!value) return false;
+        auto asg = arena.make<AssignStmt>(Symbol{fs.varSym, fs.var}, value);
+        asg->pos = fs.pos;
+        out.push_back(asg);
+        return true;
+    }
+
+    // Runtime trip counts over typed Int operands.
+    NumberExpr intLike(0.0);
+    intLike.type = NumType::Int;
+    intLike.flexible = false;
+    NumberExpr doubleLike(0.0);
+    doubleLike.type = NumType::Double;
+    doubleLike.flexible = false;
+    auto bound = [&](const Expr* e) -> AstRef<Expr> {
+        if (const auto* n = astCast<NumberExpr>(e)) return makeNumber(arena, n->value, intLike);
+        return cloneExpr(arena, e);
+    };
+    auto binary = [&](BinaryOp op, AstRef<Expr> a, AstRef<Expr> b) -> AstRef<Expr> {
+        auto r = arena.make<BinaryExpr>(op, a, b);
+        r->pos = fs.pos;
+        return r;
+    };
+    auto tripsInt = [&]() -> AstRef<Expr> {
+        if (constant) return makeNumber(arena, static_cast<double>(trips), intLike);
+        return binary(BinaryOp::Mul, binary(BinaryOp::Ge, bound(fs.end.get()), bound(fs.start.get())),
+                      binary(BinaryOp::Add, binary(BinaryOp::Sub, bound(fs.end.get()), bound(fs.start.get())),
+                             makeNumber(arena, 1.0, intLike)));
+    };
+    auto tripsDouble = [&]() -> AstRef<Expr> {
+        if (constant) return makeNumber(arena, static_cast<double>(trips), doubleLike);
+        return binary(BinaryOp::Mul, binary(BinaryOp::Ge, bound(fs.end.get()), bound(fs.start.get())),
+                      binary(BinaryOp::Sub, binary(BinaryOp::Add, bound(fs.end.get()), makeNumber(arena, 1.0, doubleLike)),
+                             bound(fs.start.get())));
+    };
+    // Runtime bounds that keep n <= 2^16 and the counter within 16 bits.
+    auto small = [&](const Expr* e) {
+        if (const auto* n = astCast<NumberExpr>(e)) return std::fabs(n->value) <= 32767.0;
+        return e->kind == ExprKind::Var && e->type == NumType::Int;
+    };
+    const bool exactTrips = constant ? trips <= kMaxExactTrips : small(fs.start.get()) && small(fs.end.get());
+
+    std::vector<AstRef<Stmt>> closed;
+    for (const AssignStmt* asg : body) {
+        const SymbolId x = varOf(symbols, asg->sym, asg->name);
+        const NumType xType = typeOfName(asg->name);
+        const Expr* rhs = asg->value.get();
+        const BitSet reads = readsOf(rhs);
+        BitSet others = targets;
+        others.reset(x);
+        if (reads.overlaps(others)) return false;
+        AstRef<Expr> value;
+
+        // 1. Interpret the loop.
+        if (constant && trips <= kMaxSimulated) {
+            double cur = 0.0;
+            bool known = !reads.test(x) || before(VarExpr(Symbol{asg->sym, asg->name}), cur);
+            std::int64_t k = 0;
+            const ValueLookup valueOf = [&](const VarExpr& v, double& r) {
+                const SymbolId id = varOf(symbols, v.sym, v.name);
+                if (id != x && id != counter) return before(v, r);
+                r = id == x ? cur : loop.at(k);
+                return true;
+            };
+            for (; known && k < trips; ++k) {
+                known = evaluate(rhs, xType, valueOf, cur);
+                cur = storedValue(cur, xType);
+            }
+            if (known) value = makeNumber(arena, cur, VarExpr(Symbol{asg->sym, asg->name}));
+        }
+
+        // 2./3. Additive and multiplicative recurrences.
+        const auto* b = astCast<BinaryExpr>(rhs);
+        auto isX = [&](const Expr* e) {
+            const auto* v = astCast<VarExpr>(e);
+            return v && varOf(symbols, v->sym, v->name) == x;
+        };
+        const Expr* t = nullptr;
+        if (!value && b && !b->flexible && b->type == xType &&
+            (b->op == BinaryOp::Add || b->op == BinaryOp::Sub || b->op == BinaryOp::Mul)) {
+            if (isX(b->lhs.get())) t = b->rhs.get();
+            else if (b->op != BinaryOp::Sub && isX(b->rhs.get())) t = b->lhs.get();
+        }
+        const BitSet tReads = t ? readsOf(t) : BitSet();
+        if (t && !tReads.test(x)) {
+            const bool invariant = !tReads.test(counter);
+            const AstRef<Expr> self = b->lhs.get() == t ? b->rhs : b->lhs;
+            if (xType == NumType::Int && invariant && b->op != BinaryOp::Mul) {
+                value = binary(b->op, cloneExpr(arena, self.get()), binary(BinaryOp::Mul, tripsInt(), cloneExpr(arena, t)));
+            } else if (xType == NumType::Int && constant && trips <= kMaxSimulated) {
+                // Sum or product of t's values modulo 2^32.
+                std::int64_t k = 0;
+                const ValueLookup valueOf = [&](const VarExpr& v, double& r) {
+                    if (varOf(symbols, v.sym, v.name) != counter) return before(v, r);
+                    r = loop.at(k);
+                    return true;
+                };
+                std::uint32_t total = b->op == BinaryOp::Mul ? 1 : 0;
+                bool known = true;
+                double term = 0.0;
+                if (invariant) {
+                    // t^n by squaring.
+                    known = evaluate(t, NumType::Int, valueOf, term);
+                    auto base = static_cast<std::uint32_t>(static_cast<std::int64_t>(term));
+                    for (auto e = static_cast<std::uint64_t>(trips); e != 0; e >>= 1, base *= base)
+                        if (e & 1) total *= base;
+                }
+                for (; known && !invariant && k < trips; ++k) {
+                    known = evaluate(t, NumType::Int, valueOf, term);
+                    const auto bits = static_cast<std::uint32_t>(static_cast<std::int64_t>(term));
+                    total = b->op == BinaryOp::Mul ? total * bits : total + bits;
+                }
+                if (known) value = binary(b->op, cloneExpr(arena, self.get()), makeNumber(arena, wrap32(total), intLike));
+            } else if (xType == NumType::Double && b->op != BinaryOp::Mul && exactTrips) {
+                double start = 0.0;
+                const bool exactStart = before(VarExpr(Symbol{asg->sym, asg->name}), start) &&
+                                        start == std::floor(start) && std::fabs(start) <= kMaxExactStart;
+                const auto* lit = astCast<NumberExpr>(t);
+                const bool intValued = (!t->flexible && t->type == NumType::Int) ||
+                                       (lit && lit->value == std::floor(lit->value) && std::fabs(lit->value) <= 2147483648.0);
+                const auto* tv = astCast<VarExpr>(t);
+                if (exactStart && invariant && intValued) {
+                    value = binary(b->op, cloneExpr(arena, self.get()), binary(BinaryOp::Mul, tripsDouble(), cloneExpr(arena, t)));
+                } else if (exactStart && !constant && tv && varOf(symbols, tv->sym, tv->name) == counter) {
+                    // Sum of S, S+1, ..., S+n-1.
+                    auto triangle = binary(BinaryOp::Div,
+                                           binary(BinaryOp::Mul, tripsDouble(),
+                                                  binary(BinaryOp::Sub, tripsDouble(), makeNumber(arena, 1.0, doubleLike))),
+                                           makeNumber(arena, 2.0, doubleLike));
+                    value = binary(b->op, cloneExpr(arena, self.get()),
+                                   binary(BinaryOp::Add, binary(BinaryOp::Mul, tripsDouble(), bound(fs.start.get())), triangle));
+                }
+            }
+        }
+
+        // 4. Invariant assignment.
+        if (!value && constant && !reads.test(x) && !reads.test(counter)) value = cloneExpr(arena, rhs);
+
+        if (!value) return false;
+        auto closedAsg = arena.make<AssignStmt>(Symbol{asg->sym, asg->name}, value);
+        closedAsg->pos = asg->pos;
+        closed.push_back(closedAsg);
+    }
+
+    AstRef<Expr> exit;
+    if (constant) {
+        exit = makeNumber(arena, loop.exit, VarExpr(Symbol{fs.varSym, fs.var}));
+    } else if (varType == NumType::Int) {
+        exit = binary(BinaryOp::Add, bound(fs.start.get()), tripsInt());
+    } else {
+        exit = binary(BinaryOp::Add, bound(fs.start.get()), tripsDouble());
+    }
+    if (!exit) return false;
+    auto exitAsg = arena.make<AssignStmt>(Symbol{fs.varSym, fs.var}, exit);
+    exitAsg->pos = fs.pos;
+    closed.push_back(exitAsg);
+    out.insert(out.end(), closed.begin(), closed.end());
+    return true;
+}
+
+} // namespace gwbasic
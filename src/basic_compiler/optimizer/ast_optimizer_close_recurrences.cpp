@@ -0,0 +1,73 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_close_recurrences.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::closeRecurrences`, which replaces FOR loops by
+ *    the closed form of their recurrences.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/AnalysisCache.h"
+#include <unordered_map>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::closeRecurrences
+ * Purpose:
+ *  - Turn loops such as `FOR I = 1 TO N%: S% = S% + I: NEXT` or
+ *    `FOR I = 1 TO 100: X = X * 2: NEXT` into straight-line assignments.
+ * Inputs:
+ *  - program: Mutable AST root
+ * Outputs:
+ *  - bool: true when a loop was replaced
+ * Details:
+ *  - Reachable FORs are visited with the constants holding right before
+ *    them (constantAt), so closeLoop can use the start values of the
+ *    variables they update. The analysis is the one propagateConstants
+ *    solved (analyze), shared while only expressions change, so a round
+ *    pays for it once and each loop costs only the lookups its own reads
+ *    make. The replacement statements take the FOR's place in its line
+ *    once the walk is done, keeping the analysis valid while it runs.
+ *  - A closed loop only leaves assignments behind, which the following
+ *    passes propagate and fold like any other.
+ */
+bool AstOptimizer::closeRecurrences(Program& program) {
+    AnalysisCache& facts = analyze(program);
+    AstArena& arena = *program.arena;
+    const SymbolTable& symbols = arena.symbols();
+    std::unordered_map<const Stmt*, std::vector<AstRef<Stmt>>> closed;
+    const Stmt* at = nullptr;
+    const ValueLookup before = [&](const VarExpr& v, double& out) {
+        return constantAt(facts, *at, varOf(symbols, v.sym, v.name), false, out);
+    };
+    std::vector<AstRef<Stmt>> replacement;
+    for (const Line& line : program.lines) {
+        for (const auto& ref : line.statements) {
+            const auto* fs = astCast<ForStmt>(ref.get());
+            if (!fs || !facts.rd.contains(*fs)) continue;
+            at = fs;
+            replacement.clear();
+            if (closeLoop(arena, *fs, before, replacement)) closed.emplace(fs, replacement);
+        }
+    }
+    if (closed.empty()) return false;
+
+    std::vector<AstRef<Stmt>> newStmts;
+    for (auto& line : program.lines) {
+        newStmts.clear();
+        bool lineChanged = false;
+        for (const auto& st : line.statements) {
+            const auto it = closed.find(st.get());
+            if (it == closed.end()) {
+                newStmts.push_back(st);
+                continue;
+            }
+            newStmts.insert(newStmts.end(), it->second.begin(), it->second.end());
+            lineChanged = true;
+        }
+        if (lineChanged) line.statements = arena.makeList<Stmt>(newStmts);
+    }
+    return true;
+}
+
+} // namespace gwbasic
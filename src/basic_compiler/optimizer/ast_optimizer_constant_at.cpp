@@ -0,0 +1,40 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_constant_at.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::constantAt`, the constant lookup shared by
+ *    constant propagation and recurrence closing.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/AnalysisCache.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::constantAt
+ * Purpose:
+ *  - Decide whether a variable holds a known constant at a statement.
+ * Inputs:
+ *  - facts: Analyses of the program (analyze)
+ *  - st: Reachable top-level statement
+ *  - var: Variable
+ *  - after: Ask about the point after st's own definitions (a FOR's
+ *    limits and body)
+ *  - out: Receives the value, as stored in the variable
+ * Outputs:
+ *  - true when the definition reaching st stores a Known constant.
+ * Details:
+ *  - The reaching definition may be an Entry zero the question just
+ *    created; solveConstants gives it its value first.
+ */
+bool AstOptimizer::constantAt(AnalysisCache& facts, const Stmt& st, SymbolId var, bool after, double& out) {
+    const int d = facts.rd.reaching(st, var, after);
+    if (d < 0) return false;
+    solveConstants(facts);
+    const AnalysisCache::Constant& c = facts.constants[static_cast<std::size_t>(d)];
+    if (c.state != AnalysisCache::Constant::State::Known) return false;
+    out = c.value;
+    return true;
+}
+
+} // namespace gwbasic
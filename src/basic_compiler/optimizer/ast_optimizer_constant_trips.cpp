@@ -0,0 +1,67 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_constant_trips.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::constantTrips`, the compile-time trip count of
+ *    FOR loops with literal limits.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+namespace {
+constexpr std::size_t kMaxInterpreted = std::size_t{1} << 16; // iterations listed for general loops
+} // namespace
+
+/**
+ * Function: AstOptimizer::constantTrips
+ * Purpose:
+ *  - Describe how often a FOR runs and which values its variable takes.
+ * Inputs:
+ *  - fs: The loop (its body must not assign the variable)
+ *  - out: Receives the description
+ * Outputs:
+ *  - bool: false unless start, end and step are literals and the loop
+ *    provably ends (within 2^16 iterations for the general shape)
+ * Details:
+ *  - Counted shape (countedShape): trips = S <= E ? (E - S) / step + 1 : 0
+ *    in i64 and the exit value S + trips * step, as emitCountedFor.
+ *  - General shape: emitFor's loop is replayed in the variable's type:
+ *    the start as stored, end and step converted once, `I <= E` tested
+ *    before each iteration and I + step stored after it.
+ */
+bool AstOptimizer::constantTrips(const ForStmt& fs, LoopTrips& out) {
+    const auto* start = astCast<NumberExpr>(fs.start.get());
+    const auto* end = astCast<NumberExpr>(fs.end.get());
+    if (!start || !end || (fs.step && !astCast<NumberExpr>(fs.step.get()))) return false;
+    out = LoopTrips{};
+    out.type = typeOfName(fs.var);
+    if (countedShape(fs, out.step)) {
+        out.counted = true;
+        out.first = start->value;
+        const auto s = static_cast<std::int64_t>(start->value);
+        const auto e = static_cast<std::int64_t>(end->value);
+        const auto st = static_cast<std::int64_t>(out.step);
+        out.count = s <= e ? (e - s) / st + 1 : 0;
+        out.exit = out.at(out.count);
+        return true;
+    }
+    const ValueLookup none = [](const VarExpr&, double&) { return false; };
+    double cur, last;
+    if (!evaluate(start, out.type, none, cur) || !evaluate(end, out.type, none, last) ||
+        (fs.step && !evaluate(fs.step.get(), out.type, none, out.step)))
+        return false;
+    cur = storedValue(cur, out.type);
+    while (cur <= last) {
+        if (out.values.size() == kMaxInterpreted) return false;
+        out.values.push_back(cur);
+        if (out.type == NumType::Int) cur = storedValue(cur + out.step, NumType::Int);
+        else if (out.type == NumType::Single) cur = static_cast<float>(cur + out.step);
+        else cur += out.step;
+    }
+    out.count = static_cast<std::int64_t>(out.values.size());
+    out.exit = cur;
+    return true;
+}
+
+} // namespace gwbasic
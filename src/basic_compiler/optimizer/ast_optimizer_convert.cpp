@@ -0,0 +1,62 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_convert.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::convert` and `AstOptimizer::storedValue`, the
+ *    compile-time counterparts of CodeGenerator::emitConvert and
+ *    emitNarrow.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include <cmath>
+#include <cstdint>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::convert
+ * Purpose:
+ *  - Convert a value to the computation type `to` as the IR does.
+ * Inputs:
+ *  - v: Value (exactly representable in its source type)
+ *  - to: Target computation type
+ *  - out: Receives the converted value
+ * Outputs:
+ *  - false when the IR conversion has no defined result (fptosi out of
+ *    the i32 range).
+ * Details:
+ *  - Int rounds half to even (llvm.rint, the default rounding mode of
+ *    nearbyint); Single rounds to float; Double keeps the value.
+ */
+bool AstOptimizer::convert(double v, NumType to, double& out) {
+    switch (to) {
+        case NumType::Int:
+            out = std::nearbyint(v);
+            return out >= -2147483648.0 && out <= 2147483647.0;
+        case NumType::Single:
+            out = static_cast<double>(static_cast<float>(v));
+            return std::isfinite(out) || !std::isfinite(v);
+        case NumType::Double:
+            out = v;
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Function: AstOptimizer::storedValue
+ * Purpose:
+ *  - Value a variable of `type` holds after assigning `v`, already
+ *    computed in `type`.
+ * Inputs:
+ *  - v: Value in the computation type
+ *  - type: Variable type
+ * Outputs:
+ *  - `v` wrapped to 16 bits for Int (trunc i32 to i16), unchanged
+ *    otherwise.
+ */
+double AstOptimizer::storedValue(double v, NumType type) {
+    if (type != NumType::Int) return v;
+    return static_cast<std::int16_t>(static_cast<std::uint16_t>(static_cast<std::int64_t>(v)));
+}
+
+} // namespace gwbasic
@@ -0,0 +1,46 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_counted_shape.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::countedShape`, the optimizer's view of which FOR
+ *    loops the code generator counts with an i64 induction variable.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include <cmath>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::countedShape
+ * Purpose:
+ *  - Decide whether a FOR takes CodeGenerator::emitCountedFor.
+ * Inputs:
+ *  - fs: The loop
+ *  - step: Receives the step (1 when absent) on success
+ * Outputs:
+ *  - bool: true for the counted shape
+ * Details:
+ *  - Same rules as CodeGenerator::countedLoopStep: integral start and end
+ *    (whole literals within range, or Int expressions that are not
+ *    flexible unless the variable is Single, which needs literals up to
+ *    2^24) and a whole literal step of at least 1. Callers check that the
+ *    body leaves the variable alone. Bounds of this shape are exact when
+ *    evaluated as Int, which evaluateProgram relies on.
+ */
+bool AstOptimizer::countedShape(const ForStmt& fs, double& step) {
+    const bool single = typeOfName(fs.var) == NumType::Single;
+    const double limit = single ? 16777216.0 : 2147483647.0;
+    auto whole = [&](const Expr* e) {
+        const auto* n = astCast<NumberExpr>(e);
+        return n && n->value == std::floor(n->value) && std::fabs(n->value) <= limit;
+    };
+    auto integral = [&](const Expr* e) { return whole(e) || (!single && !e->flexible && e->type == NumType::Int); };
+    if (!integral(fs.start.get()) || !integral(fs.end.get())) return false;
+    step = 1.0;
+    if (!fs.step) return true;
+    if (!whole(fs.step.get())) return false;
+    step = static_cast<const NumberExpr*>(fs.step.get())->value;
+    return step >= 1.0;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,122 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_eliminate_common_subexpressions.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::eliminateCommonSubexpressions`, local value
+ *    numbering over the basic blocks of the control-flow graph.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/ValueTable.h"
+#include "basic_compiler/cfg/Dataflow.h"
+#include <algorithm>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::eliminateCommonSubexpressions
+ * Purpose:
+ *  - Compute each Single/Double operation once per basic block.
+ * Inputs:
+ *  - program: Mutable AST root
+ * Outputs:
+ *  - bool: true when a computation was reused
+ * Details:
+ *  - Each block's reachable statements are numbered in order
+ *    (valueNumber) and rewritten (reuseValues) against one ValueTable,
+ *    reset at the block's leader and after every GOSUB (the subroutine
+ *    may assign anything). Control only leaves a block early through an
+ *    IF, so an earlier computation has always run when a later statement
+ *    of the block runs.
+ *  - An assignment makes its target hold the value's number when the
+ *    variable stores the value exactly (same type, not Int); any other
+ *    assignment, INPUT or FOR gives the variables it writes fresh numbers.
+ *    FOR bodies repeat and are left alone; only the start value, computed
+ *    once before the loop variable changes, takes part.
+ *  - Temporaries' assignments are finally placed in front of the
+ *    statements holding the first occurrences, inner ones first.
+ */
+bool AstOptimizer::eliminateCommonSubexpressions(Program& program) {
+    const ControlFlowGraph cfg(program);
+    AstArena& arena = *program.arena;
+    ValueTable table;
+    table.symbols = &arena.symbols();
+    table.inserts.resize(cfg.size());
+    bool changed = false;
+    auto number = [&](AstRef<Expr>& e) {
+        const int vn = valueNumber(e, table);
+        reuseValues(arena, e, table, changed);
+        return vn;
+    };
+    auto clobber = [&](SymbolId sym, std::string_view name) {
+        if (const SymbolId id = varOf(*table.symbols, sym, name); id != kNoSymbol) table.vars[id] = table.fresh();
+    };
+
+    const int n = static_cast<int>(cfg.size());
+    for (int leader = 0; leader < n; ++leader) {
+        if (!cfg.isLeader(leader)) continue;
+        table.reset();
+        const int last = blockEnd(cfg, leader);
+        for (int i = leader; i <= last; ++i) {
+            table.line = i;
+            const Line& line = cfg.line(i);
+            const std::size_t count = reachableStatements(line);
+            for (std::size_t k = 0; k < count; ++k) {
+                table.stmt = k;
+                Stmt& st = *line.statements[k];
+                switch (st.kind) {
+                    case StmtKind::Assign: {
+                        auto& asg = static_cast<AssignStmt&>(st);
+                        const int vn = number(asg.value);
+                        const SymbolId target = varOf(*table.symbols, asg.sym, asg.name);
+                        if (target == kNoSymbol) break;
+                        const Expr& value = *asg.value;
+                        if (!value.flexible && value.type == typeOfName(asg.name) && value.type != NumType::Int) {
+                            table.vars[target] = vn;
+                            table.holders[vn] = target;
+                        } else {
+                            table.vars[target] = table.fresh();
+                        }
+                        break;
+                    }
+                    case StmtKind::Print: number(static_cast<PrintStmt&>(st).value); break;
+                    case StmtKind::If: number(static_cast<IfStmt&>(st).cond); break;
+                    case StmtKind::Input: {
+                        const auto& in = static_cast<const InputStmt&>(st);
+                        clobber(in.sym, in.name);
+                        break;
+                    }
+                    case StmtKind::For: {
+                        auto& fs = static_cast<ForStmt&>(st);
+                        number(fs.start);
+                        clobber(fs.varSym, fs.var);
+                        for (const auto& bs : fs.body)
+                            if (const auto* basg = astCast<AssignStmt>(bs.get())) clobber(basg->sym, basg->name);
+                        break;
+                    }
+                    case StmtKind::Gosub: table.reset(); break;
+                    default: break;
+                }
+                table.numbered.clear();
+            }
+        }
+    }
+
+    std::vector<AstRef<Stmt>> newStmts;
+    for (auto& line : program.lines) {
+        const int idx = cfg.indexOf(line.number);
+        if (idx == ControlFlowGraph::kNone || &cfg.line(idx) != &line) continue;
+        auto& inserts = table.inserts[static_cast<std::size_t>(idx)];
+        if (inserts.empty()) continue;
+        std::ranges::sort(inserts, {}, [](const ValueTable::Insert& ins) { return std::pair(ins.stmt, ins.order); });
+        newStmts.clear();
+        auto next = inserts.begin();
+        for (std::size_t k = 0; k < line.statements.size(); ++k) {
+            for (; next != inserts.end() && next->stmt == k; ++next) newStmts.push_back(next->assign);
+            newStmts.push_back(line.statements[k]);
+        }
+        line.statements = arena.makeList<Stmt>(newStmts);
+    }
+    return changed;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,112 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_evaluate.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::evaluate`, a compile-time interpreter for
+ *    expressions that reproduces the generated code's arithmetic.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include <cstdint>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::evaluate
+ * Purpose:
+ *  - Compute an expression given the values of the variables it reads.
+ * Inputs:
+ *  - e: Expression (may be null)
+ *  - want: Type the caller needs the value in (emitExpr's `want`)
+ *  - valueOf: Value a variable holds (exact in its type); false when
+ *    unknown
+ *  - out: Receives the result on success
+ * Outputs:
+ *  - false when a read is unknown, the expression is a string, or a
+ *    conversion has no defined result.
+ * Details:
+ *  - Follows CodeGenerator::emitExpr and emitComparison step by step: a
+ *    node computes in its own type (the wider of that and `want` when
+ *    flexible), operands are converted to it first, Int arithmetic wraps
+ *    at 32 bits, Single arithmetic is float, comparisons give 0/1, and the
+ *    result is converted to `want` (convert). Every step therefore rounds
+ *    exactly as the IR would, so the result is bit-identical.
+ */
+bool AstOptimizer::evaluate(const Expr* e, NumType want, const ValueLookup& valueOf, double& out) {
+    if (!e) return false;
+    const NumType t = e->flexible ? wider(e->type, want) : e->type;
+    double v;
+    switch (e->kind) {
+        case ExprKind::Number:
+            if (!convert(static_cast<const NumberExpr*>(e)->value, t, v)) return false;
+            break;
+        case ExprKind::Var:
+            if (!valueOf(*static_cast<const VarExpr*>(e), v)) return false;
+            break;
+        case ExprKind::Unary: {
+            const auto* u = static_cast<const UnaryExpr*>(e);
+            if (!evaluate(u->inner.get(), t, valueOf, v)) return false;
+            if (u->op == '-') {
+                if (t == NumType::Int) v = static_cast<std::int32_t>(static_cast<std::uint32_t>(-static_cast<std::int64_t>(v)));
+                else v = 0.0 - v; // fsub 0.0, x: a zero stays +0.0
+            }
+            break;
+        }
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            double L, R;
+            if (b->op >= BinaryOp::Eq) {
+                const NumType ct = b->lhs->flexible && b->rhs->flexible ? NumType::Double : wider(b->lhs->type, b->rhs->type);
+                if (!evaluate(b->lhs.get(), ct, valueOf, L) || !evaluate(b->rhs.get(), ct, valueOf, R)) return false;
+                bool holds = false;
+                switch (b->op) {
+                    case BinaryOp::Eq: holds = L == R; break;
+                    case BinaryOp::Ne: holds = L < R || L > R; break; // fcmp one: false for NaN
+                    case BinaryOp::Lt: holds = L < R; break;
+                    case BinaryOp::Le: holds = L <= R; break;
+                    case BinaryOp::Gt: holds = L > R; break;
+                    case BinaryOp::Ge: holds = L >= R; break;
+                    default: return false;
+                }
+                v = holds ? 1.0 : 0.0;
+                break;
+            }
+            if (!evaluate(b->lhs.get(), t, valueOf, L) || !evaluate(b->rhs.get(), t, valueOf, R)) return false;
+            if (t == NumType::Int) {
+                const auto l = static_cast<std::int64_t>(L);
+                const auto r = static_cast<std::int64_t>(R);
+                std::int64_t res;
+                switch (b->op) {
+                    case BinaryOp::Add: res = l + r; break;
+                    case BinaryOp::Sub: res = l - r; break;
+                    case BinaryOp::Mul: res = l * r; break;
+                    default: return false; // '/' is never Int
+                }
+                v = static_cast<std::int32_t>(static_cast<std::uint32_t>(res));
+            } else if (t == NumType::Single) {
+                const auto l = static_cast<float>(L);
+                const auto r = static_cast<float>(R);
+                switch (b->op) {
+                    case BinaryOp::Add: v = l + r; break;
+                    case BinaryOp::Sub: v = l - r; break;
+                    case BinaryOp::Mul: v = l * r; break;
+                    case BinaryOp::Div: v = l / r; break;
+                    default: return false;
+                }
+            } else {
+                switch (b->op) {
+                    case BinaryOp::Add: v = L + R; break;
+                    case BinaryOp::Sub: v = L - R; break;
+                    case BinaryOp::Mul: v = L * R; break;
+                    case BinaryOp::Div: v = L / R; break;
+                    default: return false;
+                }
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+    return convert(v, want, out);
+}
+
+} // namespace gwbasic
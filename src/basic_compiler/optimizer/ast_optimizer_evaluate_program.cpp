@@ -0,0 +1,333 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_evaluate_program.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::evaluateProgram`, which runs the input-free part
+ *    of a program at compile time and keeps only its output.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/cfg/ControlFlowGraph.h"
+#include "basic_compiler/cfg/Dataflow.h"
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+namespace gwbasic {
+
+namespace {
+constexpr std::size_t kMaxOutput = std::size_t{1} << 20; // bytes of precomputed output
+constexpr std::size_t kGosubDepth = 1024; // CodeGenerator::kGosubDepth
+
+/** How interpretation of a statement ends. */
+enum class Run : std::uint8_t { Next, Exit, Suspend, Abort };
+
+bool isComparison(const Expr* e) {
+    const auto* b = astCast<BinaryExpr>(e);
+    return b && b->op >= BinaryOp::Eq;
+}
+} // namespace
+
+/**
+ * Function: AstOptimizer::evaluateProgram
+ * Purpose:
+ *  - Partial evaluation: run the program from its first line as the
+ *    generated code would until it ends, reaches INPUT or runs out of
+ *    steps, and replace what ran by the text it printed.
+ * Inputs:
+ *  - program: Mutable AST root
+ *  - steps: Statements the interpreter may execute (a FOR iteration
+ *    counts its body plus one)
+ * Outputs:
+ *  - bool: true when the program was rewritten
+ * Details:
+ *  - Statements are interpreted with evaluate/storedValue and FOR loops
+ *    as emitCountedFor and emitFor run them, so every value and every
+ *    printed digit matches the compiled program. GOSUB keeps a return
+ *    stack; a missing GOSUB target does nothing, as its inlined empty
+ *    body would. Anything whose result is not known exactly (a conversion
+ *    without defined result, printing NaN, a full GOSUB stack) abandons
+ *    the attempt, as do programs the code generator would reject.
+ *  - A program that ends becomes its first line holding one PRINT of the
+ *    whole output (newline false: the text is copied out as it is) and END.
+ *  - Otherwise execution resumes at the last line start reached outside a
+ *    subroutine: a new line numbered one below the first prints the
+ *    output up to there, assigns the variables the values they had and
+ *    jumps to that line. The original lines stay; remove-dead-lines drops
+ *    the ones only the evaluated prefix reached.
+ *  - Both results start with that PRINT, which tells later rounds the
+ *    program was already evaluated. A prefix that printed nothing is not
+ *    worth a prelude; constant propagation finds its values anyway.
+ */
+bool AstOptimizer::evaluateProgram(Program& program, std::int64_t steps) {
+    if (program.lines.empty()) return false;
+    if (const auto& head = program.lines.front().statements; !head.empty()) {
+        const auto* pr = astCast<PrintStmt>(head[0].get());
+        if (pr && !pr->newline) return false; // already evaluated
+    }
+    AstArena& arena = *program.arena;
+    const SymbolTable& symbols = arena.symbols();
+    const ControlFlowGraph cfg(program);
+    const int n = static_cast<int>(cfg.size());
+    const int prelude = cfg.number(0) - 1;
+
+    bool preludeFree = prelude >= 0;
+    for (const auto& line : program.lines) {
+        for (const auto& st : line.statements) {
+            switch (st->kind) {
+                case StmtKind::Assign:
+                case StmtKind::Print:
+                case StmtKind::Input:
+                case StmtKind::Return:
+                case StmtKind::End:
+                    break;
+                case StmtKind::Goto:
+                    if (!cfg.find(static_cast<const GotoStmt*>(st.get())->targetLine)) return false;
+                    break;
+                case StmtKind::If: {
+                    const auto* is = static_cast<const IfStmt*>(st.get());
+                    if (!isComparison(is->cond.get()) || !cfg.find(is->targetLine)) return false;
+                    break;
+                }
+                case StmtKind::Gosub:
+                    preludeFree = preludeFree && static_cast<const GosubStmt*>(st.get())->targetLine != prelude;
+                    break;
+                case StmtKind::For:
+                    for (const auto& bs : static_cast<const ForStmt*>(st.get())->body)
+                        if (bs->kind != StmtKind::Assign && bs->kind != StmtKind::Print) return false;
+                    break;
+                default:
+                    return false;
+            }
+        }
+    }
+
+    // Variables get dense slots on first use so line-start snapshots stay small
+    std::vector<int> slotOf(symbols.size(), -1);
+    std::vector<SymbolId> slotVar;
+    std::vector<double> values;
+    values.reserve(symbols.size()); // runFor holds a reference into it across slot()
+    auto slot = [&](SymbolId sym, std::string_view name) {
+        const SymbolId var = varOf(symbols, sym, name);
+        if (var == kNoSymbol) return -1;
+        int& s = slotOf[var];
+        if (s < 0) {
+            s = static_cast<int>(slotVar.size());
+            slotVar.push_back(var);
+            values.push_back(0.0);
+        }
+        return s;
+    };
+    const ValueLookup valueOf = [&](const VarExpr& v, double& out) {
+        const int s = slot(v.sym, v.name);
+        if (s < 0) return false;
+        out = values[static_cast<std::size_t>(s)];
+        return true;
+    };
+    auto assign = [&](SymbolId sym, std::string_view name, const Expr* e) {
+        const int s = slot(sym, name);
+        const NumType t = typeOfName(name);
+        double v;
+        if (s < 0 || !evaluate(e, t, valueOf, v)) return false;
+        values[static_cast<std::size_t>(s)] = storedValue(v, t);
+        return true;
+    };
+    std::string output;
+    auto print = [&](const PrintStmt& pr) {
+        if (const auto* se = astCast<StringExpr>(pr.value.get())) {
+            output += se->value;
+            if (pr.newline) output += '\n';
+            return true;
+        }
+        double v;
+        if (!evaluate(pr.value.get(), NumType::Double, valueOf, v) || std::isnan(v)) return false;
+        char buf[400]; // "%f" of the largest double is 317 characters
+        const int len = std::snprintf(buf, sizeof(buf), "%f\n", v);
+        if (len < 0 || static_cast<std::size_t>(len) >= sizeof(buf)) return false;
+        output.append(buf, static_cast<std::size_t>(len));
+        return true;
+    };
+    auto body = [&](const ForStmt& fs) {
+        steps -= static_cast<std::int64_t>(fs.body.size()) + 1; // an empty body still costs its test
+        if (steps < 0 || output.size() > kMaxOutput) return Run::Suspend;
+        for (const auto& bs : fs.body) {
+            const bool ok = bs->kind == StmtKind::Assign
+                ? assign(static_cast<const AssignStmt*>(bs.get())->sym, static_cast<const AssignStmt*>(bs.get())->name,
+                         static_cast<const AssignStmt*>(bs.get())->value.get())
+                : print(*static_cast<const PrintStmt*>(bs.get()));
+            if (!ok) return Run::Abort;
+        }
+        return Run::Next;
+    };
+    auto runFor = [&](const ForStmt& fs) {
+        const int s = slot(fs.varSym, fs.var);
+        if (s < 0) return Run::Abort;
+        auto& var = values[static_cast<std::size_t>(s)];
+        const NumType t = typeOfName(fs.var);
+        bool assignsVar = false;
+        for (const auto& bs : fs.body) {
+            const auto* asg = astCast<AssignStmt>(bs.get());
+            assignsVar = assignsVar || (asg && slot(asg->sym, asg->name) == s);
+        }
+        double step;
+        if (!assignsVar && countedShape(fs, step)) {
+            LoopTrips trips;
+            trips.type = t;
+            trips.counted = true;
+            trips.step = step;
+            double first, last;
+            // countedShape admits no flexible bound, so Int evaluation is exact
+            if (!evaluate(fs.start.get(), NumType::Int, valueOf, first)) return Run::Abort;
+            trips.first = first;
+            var = trips.at(0); // "TO I + 5" sees the start
+            if (!evaluate(fs.end.get(), NumType::Int, valueOf, last)) return Run::Abort;
+            const auto st = static_cast<std::int64_t>(step);
+            const auto lo = static_cast<std::int64_t>(first);
+            const auto hi = static_cast<std::int64_t>(last);
+            const std::int64_t count = lo <= hi ? (hi - lo) / st + 1 : 0;
+            for (std::int64_t k = 0; k < count; ++k) {
+                var = trips.at(k);
+                if (const Run r = body(fs); r != Run::Next) return r;
+            }
+            var = trips.at(count);
+            return Run::Next;
+        }
+        double v, last, by = 1.0;
+        if (!evaluate(fs.start.get(), t, valueOf, v)) return Run::Abort;
+        var = storedValue(v, t);
+        if (!evaluate(fs.end.get(), t, valueOf, last) || (fs.step && !evaluate(fs.step.get(), t, valueOf, by)))
+            return Run::Abort;
+        while (var <= last) {
+            if (const Run r = body(fs); r != Run::Next) return r;
+            if (t == NumType::Int) var = storedValue(var + by, NumType::Int);
+            else if (t == NumType::Single) var = static_cast<float>(var) + static_cast<float>(by);
+            else var += by;
+        }
+        return Run::Next;
+    };
+
+    struct Snapshot {
+        int line{-1};
+        std::vector<double> values;
+        std::size_t output{0};
+        bool progressed{false};
+    } resume;
+    std::vector<std::pair<int, std::size_t>> returns; // GOSUB continuations
+    int line = 0;
+    std::size_t k = 0;
+    bool progressed = false;
+    Run run = Run::Next;
+    while (run == Run::Next) {
+        if (line >= n) {
+            run = Run::Exit;
+            break;
+        }
+        const Line& ln = cfg.line(line);
+        if (k == 0 && returns.empty()) {
+            resume.line = line;
+            resume.values = values;
+            resume.output = output.size();
+            resume.progressed = progressed;
+        }
+        if (k >= ln.statements.size()) {
+            ++line;
+            k = 0;
+            continue;
+        }
+        if (--steps < 0 || output.size() > kMaxOutput) {
+            run = Run::Suspend;
+            break;
+        }
+        const Stmt& st = *ln.statements[k++];
+        progressed = true;
+        switch (st.kind) {
+            case StmtKind::Assign: {
+                const auto* asg = static_cast<const AssignStmt*>(&st);
+                if (!assign(asg->sym, asg->name, asg->value.get())) run = Run::Abort;
+                break;
+            }
+            case StmtKind::Print:
+                if (!print(static_cast<const PrintStmt&>(st))) run = Run::Abort;
+                break;
+            case StmtKind::Input:
+                run = Run::Suspend;
+                break;
+            case StmtKind::End:
+                run = Run::Exit;
+                break;
+            case StmtKind::Goto:
+                line = cfg.indexOf(static_cast<const GotoStmt*>(&st)->targetLine);
+                k = 0;
+                break;
+            case StmtKind::If: {
+                const auto* is = static_cast<const IfStmt*>(&st);
+                double holds;
+                if (!evaluate(is->cond.get(), NumType::Double, valueOf, holds)) run = Run::Abort;
+                else if (holds != 0.0) {
+                    line = cfg.indexOf(is->targetLine);
+                    k = 0;
+                }
+                break;
+            }
+            case StmtKind::Gosub: {
+                const int target = cfg.indexOf(static_cast<const GosubStmt*>(&st)->targetLine);
+                if (target == ControlFlowGraph::kNone) break;
+                if (returns.size() >= kGosubDepth) {
+                    run = Run::Abort;
+                    break;
+                }
+                returns.emplace_back(line, k);
+                line = target;
+                k = 0;
+                break;
+            }
+            case StmtKind::Return:
+                if (returns.empty()) {
+                    run = Run::Exit;
+                    break;
+                }
+                std::tie(line, k) = returns.back();
+                returns.pop_back();
+                break;
+            case StmtKind::For:
+                run = runFor(static_cast<const ForStmt&>(st));
+                break;
+            default:
+                run = Run::Abort;
+                break;
+        }
+    }
+    if (run == Run::Abort) return false;
+
+    std::vector<AstRef<Stmt>> stmts;
+    auto printText = [&](std::size_t length) {
+        if (length == 0) return;
+        auto pr = arena.make<PrintStmt>(arena.make<StringExpr>(arena.intern(std::string_view(output).substr(0, length))));
+        pr->newline = false;
+        stmts.push_back(pr);
+    };
+    if (run == Run::Exit) {
+        if (program.lines.size() == 1 && output.empty()) return false;
+        printText(output.size());
+        stmts.push_back(arena.make<EndStmt>());
+        Line only{cfg.number(0), arena.makeList<Stmt>(stmts)};
+        program.lines.assign(1, only);
+        return true;
+    }
+    if (!resume.progressed || resume.output == 0 || !preludeFree) return false;
+    printText(resume.output);
+    for (std::size_t s = 0; s < resume.values.size(); ++s) {
+        const double v = resume.values[s];
+        if (v == 0.0 && !std::signbit(v)) continue;
+        const Symbol var{slotVar[s], symbols.name(slotVar[s])};
+        auto value = makeNumber(arena, v, VarExpr(var));
+        if (!value) return false;
+        stmts.push_back(arena.make<AssignStmt>(var, value));
+    }
+    stmts.push_back(arena.make<GotoStmt>(cfg.number(resume.line)));
+    Line head{prelude, arena.makeList<Stmt>(stmts)};
+    program.lines.insert(program.lines.begin(), head);
+    return true;
+}
+
+} // namespace gwbasic
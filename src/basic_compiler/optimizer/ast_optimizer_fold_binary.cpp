@@ -0,0 +1,74 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_fold_binary.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::foldBinary`, constant folding of one binary
+ *    operation whose operands are both literals.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include <cstdint>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::foldBinary
+ * Purpose:
+ *  - Compute `b` at compile time with the precision the generated code
+ *    would use.
+ * Inputs:
+ *  - arena: Program arena for the result
+ *  - b: Operation with NumberExpr operands
+ * Outputs:
+ *  - The folded literal, or nullptr to leave `b` alone.
+ * Details:
+ *  - Comparisons convert both sides to the type emitComparison uses
+ *    (Double when both are flexible) and yield a flexible 0/1.
+ *  - Flexible arithmetic (two plain literals) folds in double precision;
+ *    the result stays flexible, as before typed variables existed.
+ *  - Typed arithmetic converts the operands to `b`'s type first: Int in
+ *    64-bit integers (then wrapped to the i32 the IR computes), Single and
+ *    Double in double precision, rounded to float for Single. One double
+ *    operation on floats rounds to the same float as float arithmetic.
+ */
+AstRef<Expr> AstOptimizer::foldBinary(AstArena& arena, const BinaryExpr& b) {
+    double L, R;
+    if (b.op >= BinaryOp::Eq) {
+        const NumType t = b.lhs->flexible && b.rhs->flexible ? NumType::Double : wider(b.lhs->type, b.rhs->type);
+        if (!numberIn(b.lhs.get(), t, L) || !numberIn(b.rhs.get(), t, R)) return nullptr;
+        bool holds = false;
+        switch (b.op) {
+            case BinaryOp::Eq: holds = L == R; break;
+            case BinaryOp::Ne: holds = L < R || L > R; break; // fcmp one: false for NaN
+            case BinaryOp::Lt: holds = L < R; break;
+            case BinaryOp::Le: holds = L <= R; break;
+            case BinaryOp::Gt: holds = L > R; break;
+            case BinaryOp::Ge: holds = L >= R; break;
+            default: return nullptr;
+        }
+        return arena.make<NumberExpr>(holds ? 1.0 : 0.0);
+    }
+    if (b.flexible) {
+        if (!asNumber(b.lhs.get(), L) || !asNumber(b.rhs.get(), R)) return nullptr;
+    } else if (!numberIn(b.lhs.get(), b.type, L) || !numberIn(b.rhs.get(), b.type, R)) {
+        return nullptr;
+    }
+    if (!b.flexible && b.type == NumType::Int) {
+        const auto l = static_cast<std::int64_t>(L);
+        const auto r = static_cast<std::int64_t>(R);
+        switch (b.op) {
+            case BinaryOp::Add: return makeNumber(arena, static_cast<double>(static_cast<std::int32_t>(l + r)), b);
+            case BinaryOp::Sub: return makeNumber(arena, static_cast<double>(static_cast<std::int32_t>(l - r)), b);
+            case BinaryOp::Mul: return makeNumber(arena, static_cast<double>(static_cast<std::int32_t>(l * r)), b);
+            default: return nullptr;
+        }
+    }
+    switch (b.op) {
+        case BinaryOp::Add: return makeNumber(arena, L + R, b);
+        case BinaryOp::Sub: return makeNumber(arena, L - R, b);
+        case BinaryOp::Mul: return makeNumber(arena, L * R, b);
+        case BinaryOp::Div: return makeNumber(arena, L / R, b);
+        default: return nullptr;
+    }
+}
+
+} // namespace gwbasic
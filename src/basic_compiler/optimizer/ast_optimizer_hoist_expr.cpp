@@ -0,0 +1,56 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_hoist_expr.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::hoistExpr`, the expression half of
+ *    loop-invariant code motion.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::hoistExpr
+ * Purpose:
+ *  - Replace maximal loop-invariant subtrees of a FOR body expression with
+ *    compiler temporaries.
+ * Inputs:
+ *  - arena: Program arena for temporaries and their assignments
+ *  - e: Expression to rewrite (may be null)
+ *  - variant: Names assigned by the loop
+ *  - hoisted: Receives the temporaries' assignments
+ * Outputs:
+ *  - Returns the (possibly replaced) expression.
+ * Details:
+ *  - Only operator nodes are worth a temporary. Flexible (literal-only)
+ *    trees are left to constant folding. Int trees stay in place: they are
+ *    computed in i32, and an Int temporary would narrow them to i16.
+ *  - Temporaries are named "inv$<n>" (makeTemp). Every expression in
+ *    BASIC is pure, so evaluating it before a loop that runs zero times
+ *    only computes an unused value.
+ */
+AstRef<Expr> AstOptimizer::hoistExpr(AstArena& arena, AstRef<Expr> e, std::span<const std::string_view> variant,
+                                     std::vector<AstRef<Stmt>>& hoisted) {
+    if (!e || (e->kind != ExprKind::Binary && e->kind != ExprKind::Unary)) return e;
+    if (!e->flexible && e->type != NumType::Int && !readsAny(e.get(), variant)) {
+        const Symbol temp = makeTemp(arena, "inv$", e->type);
+        auto asg = arena.make<AssignStmt>(temp, e);
+        asg->pos = e->pos;
+        hoisted.push_back(asg);
+        auto v = arena.make<VarExpr>(temp);
+        v->pos = e->pos;
+        return v;
+    }
+    if (auto* b = astCast<BinaryExpr>(e.get())) {
+        b->lhs = hoistExpr(arena, b->lhs, variant, hoisted);
+        b->rhs = hoistExpr(arena, b->rhs, variant, hoisted);
+        b->retype();
+    } else {
+        auto* u = static_cast<UnaryExpr*>(e.get());
+        u->inner = hoistExpr(arena, u->inner, variant, hoisted);
+        u->retype();
+    }
+    return e;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,66 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_hoist_loop_invariants.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::hoistLoopInvariants`, loop-invariant code
+ *    motion for FOR bodies.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::hoistLoopInvariants
+ * Purpose:
+ *  - Compute expressions that cannot change between iterations once,
+ *    before the loop.
+ * Inputs:
+ *  - program: Mutable AST root
+ * Outputs:
+ *  - bool: true when anything was hoisted
+ * Details:
+ *  - A FOR body is straight-line code, so an expression is invariant when
+ *    it reads neither the loop variable nor any variable the body assigns.
+ *    Such subtrees of body assignments and PRINTs become temporaries
+ *    (hoistExpr) whose assignments are inserted in front of the FOR in
+ *    its line; the FOR itself only assigns its variable, so they see the
+ *    same values the body would have.
+ *  - Hoisted trees are replaced by plain variable reads, so a second run
+ *    finds nothing more to do and the pass reaches a fixpoint.
+ */
+bool AstOptimizer::hoistLoopInvariants(Program& program) {
+    AstArena& arena = *program.arena;
+    bool changed = false;
+    std::vector<AstRef<Stmt>> newStmts; // reused scratch for every line
+    std::vector<AstRef<Stmt>> hoisted;
+    std::vector<std::string_view> variant;
+    for (auto& line : program.lines) {
+        newStmts.clear();
+        bool lineChanged = false;
+        for (const auto& st : line.statements) {
+            auto* fs = astCast<ForStmt>(st.get());
+            if (!fs) {
+                newStmts.push_back(st);
+                continue;
+            }
+            variant.assign(1, fs->var);
+            for (const auto& bs : fs->body)
+                if (const auto* asg = astCast<AssignStmt>(bs.get())) variant.push_back(asg->name);
+            hoisted.clear();
+            for (const auto& bs : fs->body) {
+                if (auto* asg = astCast<AssignStmt>(bs.get())) asg->value = hoistExpr(arena, asg->value, variant, hoisted);
+                else if (auto* pr = astCast<PrintStmt>(bs.get())) pr->value = hoistExpr(arena, pr->value, variant, hoisted);
+            }
+            newStmts.insert(newStmts.end(), hoisted.begin(), hoisted.end());
+            newStmts.push_back(st);
+            lineChanged = lineChanged || !hoisted.empty();
+        }
+        if (lineChanged) {
+            line.statements = arena.makeList<Stmt>(newStmts);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,45 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_make_number.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::makeNumber`, which builds the literal that
+ *    replaces a folded expression.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include <cmath>
+#include <cstdint>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::makeNumber
+ * Purpose:
+ *  - Create a NumberExpr standing for a value of the same type as `like`.
+ * Inputs:
+ *  - arena: Program arena
+ *  - v: Computed value (an exact integer when `like` is Int)
+ *  - like: Expression being replaced
+ * Outputs:
+ *  - The new literal, or nullptr when `v` is not finite (IR has no
+ *    spelling for it; the expression is left to run).
+ * Details:
+ *  - A flexible `like` yields an ordinary literal whose type follows its
+ *    context. Otherwise the literal keeps `like`'s type and is not
+ *    flexible, so it converts exactly where the expression did; the value
+ *    is rounded to float for Single and wrapped to 32 bits for Int, as
+ *    the generated arithmetic would.
+ */
+AstRef<Expr> AstOptimizer::makeNumber(AstArena& arena, double v, const Expr& like) {
+    if (!std::isfinite(v)) return nullptr;
+    if (like.flexible) return arena.make<NumberExpr>(v);
+    if (like.type == NumType::Int) v = static_cast<std::int32_t>(static_cast<std::uint32_t>(static_cast<std::int64_t>(v)));
+    else if (like.type == NumType::Single) v = static_cast<float>(v);
+    if (!std::isfinite(v)) return nullptr;
+    auto* n = arena.make<NumberExpr>(v);
+    n->type = like.type;
+    n->flexible = false;
+    n->pos = like.pos;
+    return n;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,36 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_make_temp.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::makeTemp`, which names compiler temporaries.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include <string>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::makeTemp
+ * Purpose:
+ *  - Intern a variable name no program line uses yet.
+ * Inputs:
+ *  - arena: Program arena (its symbol table decides what is taken)
+ *  - prefix: Name stem ending in '$' ("inv$", "cse$")
+ *  - type: Type the temporary holds
+ * Outputs:
+ *  - Symbol of `prefix` + the first free number, plus '!' for Single.
+ * Details:
+ *  - The lexer never puts '$' inside an identifier, so the name cannot
+ *    collide with a source variable; Double needs no suffix (typeOfName).
+ */
+Symbol AstOptimizer::makeTemp(AstArena& arena, std::string_view prefix, NumType type) {
+    std::string name;
+    for (std::size_t n = 1; name.empty() || arena.symbols().find(name) != kNoSymbol; ++n) {
+        name = prefix;
+        name += std::to_string(n);
+        if (type == NumType::Single) name += '!';
+    }
+    return arena.intern(name);
+}
+
+} // namespace gwbasic
@@ -0,0 +1,35 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_number_in.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::numberIn`, which reads a literal the way the
+ *    code generator materializes it in a given type.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::numberIn
+ * Purpose:
+ *  - Value of a NumberExpr as an operand computed in type `want`.
+ * Inputs:
+ *  - e: Expression to probe (may be nullptr)
+ *  - want: Type the surrounding operation computes in
+ *  - out: Receives the value on success
+ * Outputs:
+ *  - true if `e` is a NumberExpr whose conversion is well defined.
+ * Details:
+ *  - Mirrors CodeGenerator::emitExpr: a flexible literal is written in the
+ *    wider of its own type and `want`, a typed one (from constant
+ *    propagation) in its own type; the constant is then converted to
+ *    `want` (convert).
+ */
+bool AstOptimizer::numberIn(const Expr* e, NumType want, double& out) {
+    const auto* n = astCast<NumberExpr>(e);
+    if (!n) return false;
+    const NumType held = n->flexible ? wider(n->type, want) : n->type;
+    return convert(n->value, held, out) && convert(out, want, out);
+}
+
+} // namespace gwbasic
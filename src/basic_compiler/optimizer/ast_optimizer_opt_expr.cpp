@@ -16,74 +16,75 @@ namespace gwbasic {
  *  - Recursively rewrite an `Expr` to apply local simplifications and
  *    constant folding.
  * Inputs:
- *  - e: Owned expression to simplify (may be null)
+ *  - arena: Program arena used for folded NumberExpr replacements
+ *  - e: Expression to simplify (may be null)
+ *  - changed: set when any node is replaced
  * Outputs:
  *  - Returns the (possibly replaced) simplified expression.
  * Details:
- *  - UnaryExpr: eliminates unary plus and folds unary minus for numbers.
- *  - BinaryExpr: folds arithmetic/comparisons; applies identities
- *    (x+0, x*1, x*0, x/1, etc.).
+ *  - UnaryExpr: eliminates unary plus and folds unary minus for numbers
+ *    as 0 - v, the fsub codegen emits (so -(0) stays +0.0, not -0.0).
+ *  - BinaryExpr: folds arithmetic/comparisons (foldBinary); applies
+ *    identities (x+0, x*1, x*0, x/1, etc.) when x already has the
+ *    result's type. Rewritten nodes are re-typed from their new operands
+ *    (Expr::type).
  */
-std::unique_ptr<Expr> AstOptimizer::optExpr(std::unique_ptr<Expr> e) {
+AstRef<Expr> AstOptimizer::optExpr(AstArena& arena, AstRef<Expr> e, bool& changed) {
     if (!e) return e;
-    if (auto u = dynamic_cast<UnaryExpr*>(e.get())) {
-        u->inner = optExpr(std::move(u->inner));
-        if (u->op == '+') return std::move(u->inner);
-        if (u->op == '-') {
-            double v; if (asNumber(u->inner.get(), v)) return std::make_unique<NumberExpr>(-v);
+    auto replaced = [&](AstRef<Expr> r) { changed = true; return r; };
+    switch (e->kind) {
+        case ExprKind::Unary: {
+            auto* u = static_cast<UnaryExpr*>(e.get());
+            u->inner = optExpr(arena, u->inner, changed);
+            u->retype();
+            if (u->op == '+') return replaced(u->inner);
+            if (u->op == '-') {
+                double v;
+                if (u->flexible) {
+                    if (asNumber(u->inner.get(), v)) return replaced(arena.make<NumberExpr>(0.0 - v));
+                } else if (numberIn(u->inner.get(), u->type, v)) {
+                    if (auto n = makeNumber(arena, 0.0 - v, *u)) return replaced(n);
+                }
+                return e;
+            }
             return e;
         }
-        return e;
-    }
-    if (auto b = dynamic_cast<BinaryExpr*>(e.get())) {
-        b->lhs = optExpr(std::move(b->lhs));
-        b->rhs = optExpr(std::move(b->rhs));
-        double L, R;
-        const bool lN = asNumber(b->lhs.get(), L);
-        const bool rN = asNumber(b->rhs.get(), R);
-
-        switch (b->op) {
-            case BinaryOp::Add:
-                if (lN && rN) return std::make_unique<NumberExpr>(L + R);
-                if (isZero(b->lhs.get())) return std::move(b->rhs);
-                if (isZero(b->rhs.get())) return std::move(b->lhs);
-                return e;
-            case BinaryOp::Sub:
-                if (lN && rN) return std::make_unique<NumberExpr>(L - R);
-                if (isZero(b->rhs.get())) return std::move(b->lhs);
-                return e;
-            case BinaryOp::Mul:
-                if (lN && rN) return std::make_unique<NumberExpr>(L * R);
-                if (isZero(b->lhs.get()) || isZero(b->rhs.get())) return std::make_unique<NumberExpr>(0.0);
-                if (isOne(b->lhs.get())) return std::move(b->rhs);
-                if (isOne(b->rhs.get())) return std::move(b->lhs);
-                return e;
-            case BinaryOp::Div:
-                if (lN && rN) return std::make_unique<NumberExpr>(L / R);
-                if (isOne(b->rhs.get())) return std::move(b->lhs);
-                return e;
-            case BinaryOp::Eq:
-                if (lN && rN) return std::make_unique<NumberExpr>(L == R ? 1.0 : 0.0);
+        case ExprKind::Binary: {
+            auto* b = static_cast<BinaryExpr*>(e.get());
+            b->lhs = optExpr(arena, b->lhs, changed);
+            b->rhs = optExpr(arena, b->rhs, changed);
+            b->retype();
+            if (b->lhs->kind == ExprKind::Number && b->rhs->kind == ExprKind::Number) {
+                if (auto n = foldBinary(arena, *b)) return replaced(n);
                 return e;
-            case BinaryOp::Ne:
-                if (lN && rN) return std::make_unique<NumberExpr>(L != R ? 1.0 : 0.0);
-                return e;
-            case BinaryOp::Lt:
-                if (lN && rN) return std::make_unique<NumberExpr>(L < R ? 1.0 : 0.0);
-                return e;
-            case BinaryOp::Le:
-                if (lN && rN) return std::make_unique<NumberExpr>(L <= R ? 1.0 : 0.0);
-                return e;
-            case BinaryOp::Gt:
-                if (lN && rN) return std::make_unique<NumberExpr>(L > R ? 1.0 : 0.0);
-                return e;
-            case BinaryOp::Ge:
-                if (lN && rN) return std::make_unique<NumberExpr>(L >= R ? 1.0 : 0.0);
-                return e;
-            default: return e;
+            }
+            // An operand can stand for the whole operation only when it
+            // computes in the same type (and is as flexible) as the result.
+            auto same = [&](const AstRef<Expr>& x) { return x->type == b->type && x->flexible == b->flexible; };
+
+            switch (b->op) {
+                case BinaryOp::Add:
+                    if (isZero(b->lhs.get()) && same(b->rhs)) return replaced(b->rhs);
+                    if (isZero(b->rhs.get()) && same(b->lhs)) return replaced(b->lhs);
+                    return e;
+                case BinaryOp::Sub:
+                    if (isZero(b->rhs.get()) && same(b->lhs)) return replaced(b->lhs);
+                    return e;
+                case BinaryOp::Mul:
+                    if (isZero(b->lhs.get()) || isZero(b->rhs.get())) return replaced(makeNumber(arena, 0.0, *b));
+                    if (isOne(b->lhs.get()) && same(b->rhs)) return replaced(b->rhs);
+                    if (isOne(b->rhs.get()) && same(b->lhs)) return replaced(b->lhs);
+                    return e;
+                case BinaryOp::Div:
+                    // x/1 keeps '/' semantics: an Int x would turn the quotient into Int
+                    if (isOne(b->rhs.get()) && same(b->lhs)) return replaced(b->lhs);
+                    return e;
+                default: return e;
+            }
         }
+        default:
+            return e;
     }
-    return e;
 }
 
 } // namespace gwbasic
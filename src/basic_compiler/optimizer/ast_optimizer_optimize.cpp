@@ -0,0 +1,27 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_optimize.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::optimize`, the single-shot entry point that runs
+ *    each AST pass once (PassManager runs them per -O level instead).
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::optimize
+ * Purpose:
+ *  - Apply statement- and expression-level simplifications, then remove
+ *    lines the simplified program can no longer reach.
+ * Inputs:
+ *  - program: Mutable AST root to optimize
+ * Effects:
+ *  - See simplifyStatements and removeDeadLines.
+ */
+void AstOptimizer::optimize(Program& program) {
+    simplifyStatements(program);
+    removeDeadLines(program);
+}
+
+} // namespace gwbasic
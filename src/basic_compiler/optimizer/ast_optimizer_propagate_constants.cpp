@@ -0,0 +1,84 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_propagate_constants.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::propagateConstants`, global constant
+ *    propagation over the shared reaching definitions.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/AnalysisCache.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::propagateConstants
+ * Purpose:
+ *  - Replace reads of variables that hold a known constant.
+ * Inputs:
+ *  - program: Mutable AST root
+ * Outputs:
+ *  - bool: true when a read was replaced
+ * Details:
+ *  - A read becomes a typed literal (makeNumber) when the definition
+ *    reaching it stores a known constant (constantAt): the initial zero,
+ *    or an assignment whose value solveConstants computed, as stored in
+ *    the variable (rounded to float for X!, rounded and wrapped to 16
+ *    bits for X%). Chains such as `A = 2: B = A * 3` are solved to a
+ *    fixpoint before anything is rewritten, so one run replaces them all.
+ *  - A FOR's start is read before the loop; its limits and body see the
+ *    definitions after the FOR, which account for everything the loop
+ *    assigns and so hold at any iteration. Rewritten expressions are
+ *    refolded (optExpr).
+ *  - Only expressions change, never statements, so the analyses stay
+ *    valid for the walk and for the passes after it (analyze).
+ */
+bool AstOptimizer::propagateConstants(Program& program) {
+    AnalysisCache& facts = analyze(program);
+    AstArena& arena = *program.arena;
+    const SymbolTable& symbols = arena.symbols();
+    bool changed = false;
+    const Stmt* at = nullptr;
+    bool after = false;
+    const std::function<AstRef<Expr>(const VarExpr&)> read = [&](const VarExpr& v) -> AstRef<Expr> {
+        double c;
+        if (!constantAt(facts, *at, varOf(symbols, v.sym, v.name), after, c)) return nullptr;
+        return makeNumber(arena, c, v);
+    };
+    auto rewrite = [&](AstRef<Expr>& e) {
+        bool replaced = false;
+        e = replaceVars(e, read, replaced);
+        if (replaced) {
+            e = optExpr(arena, e, replaced);
+            changed = true;
+        }
+    };
+    for (const Line& line : program.lines) {
+        for (const auto& ref : line.statements) {
+            Stmt& st = *ref;
+            if (!facts.rd.contains(st)) continue;
+            at = &st;
+            after = false;
+            switch (st.kind) {
+                case StmtKind::Assign: rewrite(static_cast<AssignStmt&>(st).value); break;
+                case StmtKind::Print: rewrite(static_cast<PrintStmt&>(st).value); break;
+                case StmtKind::If: rewrite(static_cast<IfStmt&>(st).cond); break;
+                case StmtKind::For: {
+                    auto& fs = static_cast<ForStmt&>(st);
+                    rewrite(fs.start);
+                    after = true;
+                    rewrite(fs.end);
+                    rewrite(fs.step);
+                    for (const auto& bs : fs.body) {
+                        if (auto* basg = astCast<AssignStmt>(bs.get())) rewrite(basg->value);
+                        else if (auto* bpr = astCast<PrintStmt>(bs.get())) rewrite(bpr->value);
+                    }
+                    break;
+                }
+                default: break;
+            }
+        }
+    }
+    return changed;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,51 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_propagate_copies.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::propagateCopies`, global copy propagation over
+ *    available copies.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::propagateCopies
+ * Purpose:
+ *  - Read the source of a copy instead of the copied variable.
+ * Inputs:
+ *  - program: Mutable AST root
+ * Outputs:
+ *  - bool: true when a read was replaced
+ * Details:
+ *  - A read of v becomes a read of w when a copy `v = w` is available
+ *    there (AvailableCopies): on every path it ran and neither variable
+ *    was assigned since, so both hold the same value. Both have the same
+ *    type, so the expression's type does not change.
+ *  - Copies inside FOR bodies are never recorded. The copy itself usually
+ *    becomes dead (removeDeadStores).
+ */
+bool AstOptimizer::propagateCopies(Program& program) {
+    const ControlFlowGraph cfg(program);
+    const AvailableCopies ac(program, cfg);
+    if (ac.copies().empty()) return false;
+    AstArena& arena = *program.arena;
+    const SymbolTable& symbols = arena.symbols();
+    return rewriteReads(
+        program, cfg, [&](int leader) -> const BitSet& { return ac.in(leader); },
+        [&](const Stmt& st, BitSet& state) { ac.transfer(st, state); },
+        [&](const VarExpr& v, const BitSet& available) -> AstRef<Expr> {
+            const SymbolId var = varOf(symbols, v.sym, v.name);
+            SymbolId source = kNoSymbol;
+            available.forEach([&](std::size_t c) {
+                if (ac.copies()[c].target == var) source = ac.copies()[c].source;
+            });
+            if (source == kNoSymbol) return nullptr;
+            auto r = arena.make<VarExpr>(Symbol{source, symbols.name(source)});
+            r->pos = v.pos;
+            return r;
+        });
+}
+
+} // namespace gwbasic
@@ -0,0 +1,42 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_reads_any.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::readsAny`, a helper to test whether an
+ *    expression depends on a set of variables.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include <algorithm>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::readsAny
+ * Purpose:
+ *  - Determine whether an expression reads one of the given variables.
+ * Inputs:
+ *  - e: Expression to probe (may be nullptr)
+ *  - names: Canonical variable names
+ * Outputs:
+ *  - true if a `VarExpr` in `e` names one of `names`.
+ * Details:
+ *  - Compares names rather than symbol ids so hand-built nodes (no id)
+ *    are handled too.
+ */
+bool AstOptimizer::readsAny(const Expr* e, std::span<const std::string_view> names) {
+    if (!e) return false;
+    switch (e->kind) {
+        case ExprKind::Var:
+            return std::ranges::find(names, static_cast<const VarExpr*>(e)->name) != names.end();
+        case ExprKind::Unary:
+            return readsAny(static_cast<const UnaryExpr*>(e)->inner.get(), names);
+        case ExprKind::Binary: {
+            const auto* b = static_cast<const BinaryExpr*>(e);
+            return readsAny(b->lhs.get(), names) || readsAny(b->rhs.get(), names);
+        }
+        default:
+            return false;
+    }
+}
+
+} // namespace gwbasic
@@ -0,0 +1,33 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_remove_dead_lines.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::removeDeadLines`, which drops lines no path from
+ *    the first line reaches.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/cfg/ControlFlowGraph.h"
+#include <vector>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::removeDeadLines
+ * Purpose:
+ *  - Remove lines that are unreachable in the program's ControlFlowGraph.
+ * Inputs:
+ *  - program: Mutable AST root
+ * Outputs:
+ *  - bool: true when at least one line was removed
+ * Details:
+ *  - Folding IFs can cut the only path to a line; such lines would only
+ *    cost lexing-to-codegen time and IR size.
+ */
+bool AstOptimizer::removeDeadLines(Program& program) {
+    const ControlFlowGraph cfg(program);
+    if (cfg.reachableCount() == cfg.size()) return false;
+    std::erase_if(program.lines, [&](const Line& l) { return !cfg.reachable(cfg.indexOf(l.number)); });
+    return true;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,105 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_remove_dead_stores.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::removeDeadStores`, dead-store elimination over
+ *    liveness.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/cfg/Dataflow.h"
+#include <unordered_set>
+
+namespace gwbasic {
+
+namespace {
+/** readsOutside: Whether fs reads var anywhere but in the values assigned to var itself. */
+bool readsOutside(const SymbolTable& symbols, const ForStmt& fs, SymbolId var) {
+    BitSet reads(symbols.size());
+    addReads(symbols, fs.start.get(), reads);
+    addReads(symbols, fs.end.get(), reads);
+    addReads(symbols, fs.step.get(), reads);
+    for (const auto& bs : fs.body) {
+        if (const auto* basg = astCast<AssignStmt>(bs.get())) {
+            if (varOf(symbols, basg->sym, basg->name) != var) addReads(symbols, basg->value.get(), reads);
+        } else if (const auto* bpr = astCast<PrintStmt>(bs.get())) {
+            addReads(symbols, bpr->value.get(), reads);
+        }
+    }
+    return reads.test(var);
+}
+} // namespace
+
+/**
+ * Function: AstOptimizer::removeDeadStores
+ * Purpose:
+ *  - Delete assignments whose value is never read.
+ * Inputs:
+ *  - program: Mutable AST root
+ * Outputs:
+ *  - bool: true when a statement was removed
+ * Details:
+ *  - Each block is walked backward from the variables live after it
+ *    (Liveness::out); an assignment to a variable that is not live at
+ *    that point is dropped, and the walk continues as if it were absent.
+ *  - Inside a FOR body, assignments to a variable other than the loop
+ *    variable are dropped when it is not live after the loop and nothing
+ *    in the loop reads it except its own assignments (an accumulator
+ *    whose total is never used).
+ *  - Expressions have no side effects, so dropping one never changes
+ *    output. INPUT always stays: it consumes input.
+ */
+bool AstOptimizer::removeDeadStores(Program& program) {
+    const ControlFlowGraph cfg(program);
+    const Liveness lv(program, cfg);
+    AstArena& arena = *program.arena;
+    const SymbolTable& symbols = arena.symbols();
+    std::unordered_set<const Stmt*> dead;
+    std::vector<AstRef<Stmt>> newStmts;
+    bool changed = false;
+
+    BitSet live;
+    const int n = static_cast<int>(cfg.size());
+    for (int leader = 0; leader < n; ++leader) {
+        if (!cfg.isLeader(leader)) continue;
+        const int last = blockEnd(cfg, leader);
+        live = lv.out(last);
+        for (int i = last; i >= leader; --i) {
+            const Line& line = cfg.line(i);
+            for (std::size_t k = reachableStatements(line); k-- > 0;) {
+                Stmt& st = *line.statements[k];
+                if (auto* asg = astCast<AssignStmt>(&st)) {
+                    const SymbolId var = varOf(symbols, asg->sym, asg->name);
+                    if (var != kNoSymbol && !live.test(var)) {
+                        dead.insert(&st);
+                        continue;
+                    }
+                } else if (auto* fs = astCast<ForStmt>(&st)) {
+                    const SymbolId loopVar = varOf(symbols, fs->varSym, fs->var);
+                    newStmts.clear();
+                    for (const auto& bs : fs->body) {
+                        const auto* basg = astCast<AssignStmt>(bs.get());
+                        const SymbolId var = basg ? varOf(symbols, basg->sym, basg->name) : kNoSymbol;
+                        if (var == kNoSymbol || var == loopVar || live.test(var) || readsOutside(symbols, *fs, var))
+                            newStmts.push_back(bs);
+                    }
+                    if (newStmts.size() != fs->body.size()) {
+                        fs->body = arena.makeList<Stmt>(newStmts);
+                        changed = true;
+                    }
+                }
+                lv.transfer(st, live);
+            }
+        }
+    }
+    if (dead.empty()) return changed;
+
+    for (auto& line : program.lines) {
+        newStmts.clear();
+        for (const auto& st : line.statements)
+            if (!dead.contains(st.get())) newStmts.push_back(st);
+        if (newStmts.size() != line.statements.size()) line.statements = arena.makeList<Stmt>(newStmts);
+    }
+    return true;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,55 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_replace_vars.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::replaceVars`, the substitution step shared by
+ *    constant and copy propagation.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::replaceVars
+ * Purpose:
+ *  - Replace variable reads in an expression tree.
+ * Inputs:
+ *  - e: Expression to rewrite (may be null)
+ *  - with: Returns the replacement for a read, or nullptr to keep it
+ *  - changed: set when any read is replaced
+ * Outputs:
+ *  - Returns the (possibly replaced) expression.
+ * Details:
+ *  - Operator nodes are re-typed from their new operands; replacements
+ *    keep the variable's type, so only flexibility can change. Folding is
+ *    left to the caller (optExpr).
+ */
+AstRef<Expr> AstOptimizer::replaceVars(AstRef<Expr> e, const std::function<AstRef<Expr>(const VarExpr&)>& with,
+                                       bool& changed) {
+    if (!e) return e;
+    switch (e->kind) {
+        case ExprKind::Var:
+            if (auto r = with(*static_cast<const VarExpr*>(e.get()))) {
+                changed = true;
+                return r;
+            }
+            return e;
+        case ExprKind::Unary: {
+            auto* u = static_cast<UnaryExpr*>(e.get());
+            u->inner = replaceVars(u->inner, with, changed);
+            u->retype();
+            return e;
+        }
+        case ExprKind::Binary: {
+            auto* b = static_cast<BinaryExpr*>(e.get());
+            b->lhs = replaceVars(b->lhs, with, changed);
+            b->rhs = replaceVars(b->rhs, with, changed);
+            b->retype();
+            return e;
+        }
+        default:
+            return e;
+    }
+}
+
+} // namespace gwbasic
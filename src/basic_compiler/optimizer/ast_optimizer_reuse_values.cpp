@@ -0,0 +1,76 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_reuse_values.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::reuseValues`, the rewriting half of local
+ *    common subexpression elimination.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/ValueTable.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::reuseValues
+ * Purpose:
+ *  - Replace operations already computed earlier in the block by a
+ *    variable holding their value.
+ * Inputs:
+ *  - arena: Program arena for temporaries and their assignments
+ *  - slot: Reference holding the expression (numbered by valueNumber)
+ *  - table: Block state (ValueTable)
+ *  - changed: set when an operation is replaced
+ * Outputs:
+ *  - void (slot and, when a temporary is introduced, the first occurrence
+ *    are rewritten)
+ * Details:
+ *  - Walks top-down so the largest repeated tree is replaced as a whole.
+ *    A node whose value number was first computed elsewhere reads a
+ *    variable that still holds that value (`holders`) when one exists.
+ *    Otherwise the first occurrence moves into a temporary "cse$<n>"
+ *    (makeTemp) assigned just before its statement, and both places read
+ *    the temporary; `inserts` collects those assignments.
+ */
+void AstOptimizer::reuseValues(AstArena& arena, AstRef<Expr>& slot, ValueTable& table, bool& changed) {
+    Expr* e = slot.get();
+    if (!e) return;
+    if ((e->kind == ExprKind::Binary || e->kind == ExprKind::Unary) && !e->flexible && e->type != NumType::Int) {
+        const int vn = table.numbered.at(e);
+        const auto av = table.available.find(vn);
+        if (av != table.available.end() && av->second.slot != &slot) {
+            Symbol with;
+            const auto holder = table.holders.find(vn);
+            if (holder != table.holders.end()) {
+                const auto held = table.vars.find(holder->second);
+                if (held != table.vars.end() && held->second == vn)
+                    with = {holder->second, table.symbols->name(holder->second)};
+            }
+            if (with.id == kNoSymbol) {
+                auto& first = av->second;
+                if (first.temp.id == kNoSymbol) {
+                    first.temp = makeTemp(arena, "cse$", e->type);
+                    auto asg = arena.make<AssignStmt>(first.temp, *first.slot);
+                    asg->pos = (*first.slot)->pos;
+                    table.inserts[static_cast<std::size_t>(first.line)].push_back({first.stmt, first.order, asg});
+                    auto v = arena.make<VarExpr>(first.temp);
+                    v->pos = asg->pos;
+                    *first.slot = v;
+                }
+                with = first.temp;
+            }
+            auto v = arena.make<VarExpr>(with);
+            v->pos = e->pos;
+            slot = v;
+            changed = true;
+            return;
+        }
+    }
+    if (auto* b = astCast<BinaryExpr>(e)) {
+        reuseValues(arena, b->lhs, table, changed);
+        reuseValues(arena, b->rhs, table, changed);
+    } else if (auto* u = astCast<UnaryExpr>(e)) {
+        reuseValues(arena, u->inner, table, changed);
+    }
+}
+
+} // namespace gwbasic
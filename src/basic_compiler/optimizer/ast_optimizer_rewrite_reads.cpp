@@ -0,0 +1,87 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_rewrite_reads.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::rewriteReads`, which visits every variable read
+ *    with the facts of a forward dataflow analysis at that read.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/cfg/Dataflow.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::rewriteReads
+ * Purpose:
+ *  - Drive a read-rewriting pass (copy propagation) over the reachable
+ *    code.
+ * Inputs:
+ *  - program: Mutable AST root (the graph's lines)
+ *  - cfg: Its ControlFlowGraph
+ *  - in, transfer: Block entry sets and transfer function of the analysis
+ *    (AvailableCopies)
+ *  - with: Replacement for a read given the facts holding there
+ * Outputs:
+ *  - bool: true when a read was replaced
+ * Details:
+ *  - Each block is replayed from its leader's entry set with `transfer`,
+ *    so every statement sees the facts holding right before it. A FOR's
+ *    start is read before the loop; its limits and body are offered the
+ *    set after the FOR, which accounts for everything the loop assigns and
+ *    so holds at any iteration. The running set is advanced past the FOR
+ *    first for that, so no block ever copies it beyond its entry set.
+ *  - Only expressions change, never statements, so the analyses stay
+ *    valid while the walk proceeds. Rewritten expressions are refolded
+ *    (optExpr).
+ */
+bool AstOptimizer::rewriteReads(Program& program, const ControlFlowGraph& cfg,
+                                const std::function<const BitSet&(int leader)>& in,
+                                const std::function<void(const Stmt&, BitSet&)>& transfer, const ReadRewriter& with) {
+    AstArena& arena = *program.arena;
+    bool changed = false;
+    BitSet state;
+    const std::function<AstRef<Expr>(const VarExpr&)> read = [&](const VarExpr& v) { return with(v, state); };
+    auto rewrite = [&](AstRef<Expr>& e) {
+        bool replaced = false;
+        e = replaceVars(e, read, replaced);
+        if (replaced) {
+            e = optExpr(arena, e, replaced);
+            changed = true;
+        }
+    };
+    const int n = static_cast<int>(cfg.size());
+    for (int leader = 0; leader < n; ++leader) {
+        if (!cfg.isLeader(leader)) continue;
+        state = in(leader);
+        const int last = blockEnd(cfg, leader);
+        for (int i = leader; i <= last; ++i) {
+            const Line& line = cfg.line(i);
+            const std::size_t count = reachableStatements(line);
+            for (std::size_t k = 0; k < count; ++k) {
+                Stmt& st = *line.statements[k];
+                switch (st.kind) {
+                    case StmtKind::Assign: rewrite(static_cast<AssignStmt&>(st).value); break;
+                    case StmtKind::Print: rewrite(static_cast<PrintStmt&>(st).value); break;
+                    case StmtKind::If: rewrite(static_cast<IfStmt&>(st).cond); break;
+                    case StmtKind::For: {
+                        auto& fs = static_cast<ForStmt&>(st);
+                        rewrite(fs.start);
+                        transfer(st, state);
+                        rewrite(fs.end);
+                        rewrite(fs.step);
+                        for (const auto& bs : fs.body) {
+                            if (auto* basg = astCast<AssignStmt>(bs.get())) rewrite(basg->value);
+                            else if (auto* bpr = astCast<PrintStmt>(bs.get())) rewrite(bpr->value);
+                        }
+                        continue; // already past the FOR
+                    }
+                    default: break;
+                }
+                transfer(st, state);
+            }
+        }
+    }
+    return changed;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,127 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_solve_constants.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::solveConstants`, sparse constant propagation
+ *    over the factored reaching definitions.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/AnalysisCache.h"
+#include <bit>
+#include <cstdint>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::solveConstants
+ * Purpose:
+ *  - Find the constant every new definition stores.
+ * Inputs:
+ *  - facts: Analyses whose rd gained definitions since the last call
+ * Outputs:
+ *  - void (facts.constants and facts.users cover every definition)
+ * Details:
+ *  - Lattice per definition: Unknown (no value reaches it yet), Known
+ *    (one constant, as the variable stores it), Varies. Entry is Known
+ *    zero; INPUT and loop definitions vary. A Join meets its operands
+ *    (Unknown ones do not count). An assignment is computed exactly as the
+ *    generated code would (evaluate, then storedValue) from the values of
+ *    the definitions its reads reach; an Unknown read leaves it Unknown
+ *    for now, a varying read or an undefined result makes it vary.
+ *  - Values only move down (Unknown, Known, Varies), and a change
+ *    requeues the definition's users, so the worklist reaches the fixpoint
+ *    in one run: chains such as `A = 2: B = A * 3: C = B + 1` are settled
+ *    together, and loops are assumed constant until shown otherwise.
+ *  - Definitions added later are Entry zeros nothing older reads, so an
+ *    incremental call only visits the definitions added since.
+ */
+void AstOptimizer::solveConstants(AnalysisCache& facts) {
+    using State = AnalysisCache::Constant::State;
+    ReachingDefinitions& rd = facts.rd;
+    const std::size_t base = facts.constants.size();
+    if (rd.defs().size() == base) return;
+    std::vector<int> work;
+    std::size_t head = 0;
+    std::vector<std::uint8_t> linked; // by definition - base: users registered
+    auto grow = [&] {
+        for (std::size_t d = facts.constants.size(); d < rd.defs().size(); ++d) work.push_back(static_cast<int>(d));
+        facts.constants.resize(rd.defs().size());
+        facts.users.resize(rd.defs().size());
+        linked.resize(rd.defs().size() - base, 0);
+    };
+    grow();
+    while (head < work.size()) {
+        const int d = work[head++];
+        const Definition def = rd.defs()[static_cast<std::size_t>(d)];
+        const bool first = !linked[static_cast<std::size_t>(d) - base];
+        linked[static_cast<std::size_t>(d) - base] = 1;
+        AnalysisCache::Constant next;
+        switch (def.kind) {
+            case Definition::Kind::Entry:
+                next = {State::Known, 0.0};
+                break;
+            case Definition::Kind::Input:
+            case Definition::Kind::Loop:
+                next.state = State::Varies;
+                break;
+            case Definition::Kind::Join:
+                for (const int op : rd.operands(d)) {
+                    if (first) facts.users[static_cast<std::size_t>(op)].push_back(d);
+                    const AnalysisCache::Constant c = facts.constants[static_cast<std::size_t>(op)];
+                    if (c.state == State::Unknown || next.state == State::Varies) continue;
+                    if (c.state == State::Varies ||
+                        (next.state == State::Known && std::bit_cast<std::uint64_t>(c.value) != std::bit_cast<std::uint64_t>(next.value)))
+                        next.state = State::Varies;
+                    else next = c;
+                }
+                break;
+            case Definition::Kind::Assign: {
+                const auto& asg = static_cast<const AssignStmt&>(*def.stmt);
+                const NumType type = typeOfName(asg.name);
+                bool unknown = false;
+                bool varies = false;
+                auto source = [&](const VarExpr& v) {
+                    const int src = rd.reaching(asg, varOf(*facts.symbols, v.sym, v.name));
+                    grow();
+                    return src;
+                };
+                // Register with every read up front: evaluate stops at the first unknown one.
+                auto link = [&](auto& self, const Expr* e) -> void {
+                    if (const auto* r = astCast<VarExpr>(e)) {
+                        if (const int src = source(*r); src >= 0) facts.users[static_cast<std::size_t>(src)].push_back(d);
+                    } else if (const auto* u = astCast<UnaryExpr>(e)) {
+                        self(self, u->inner.get());
+                    } else if (const auto* b = astCast<BinaryExpr>(e)) {
+                        self(self, b->lhs.get());
+                        self(self, b->rhs.get());
+                    }
+                };
+                if (first) link(link, asg.value.get());
+                const ValueLookup valueOf = [&](const VarExpr& v, double& out) {
+                    const int src = source(v);
+                    const AnalysisCache::Constant c = src < 0 ? AnalysisCache::Constant{State::Varies, 0.0}
+                                                              : facts.constants[static_cast<std::size_t>(src)];
+                    varies = varies || c.state == State::Varies;
+                    unknown = unknown || c.state == State::Unknown;
+                    out = c.value;
+                    return c.state == State::Known;
+                };
+                double v = 0.0;
+                if (evaluate(asg.value.get(), type, valueOf, v)) next = {State::Known, storedValue(v, type)};
+                else next.state = unknown && !varies ? State::Unknown : State::Varies;
+                break;
+            }
+        }
+        // Only ever move down the lattice.
+        AnalysisCache::Constant& cur = facts.constants[static_cast<std::size_t>(d)];
+        if (cur.state == State::Varies || next.state == State::Unknown) continue;
+        if (cur.state == State::Known &&
+            (next.state == State::Varies || std::bit_cast<std::uint64_t>(next.value) != std::bit_cast<std::uint64_t>(cur.value)))
+            next.state = State::Varies;
+        else if (cur.state == State::Known) continue;
+        cur = next;
+        for (const int u : facts.users[static_cast<std::size_t>(d)]) work.push_back(u);
+    }
+}
+
+} // namespace gwbasic
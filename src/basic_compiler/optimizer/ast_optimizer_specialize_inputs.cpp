@@ -0,0 +1,78 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_specialize_inputs.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::specializeInputs`, which turns INPUT of the
+ *    variables fixed with --specialize into constant assignments.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+namespace {
+/** The value fixed for an INPUT's variable, or nullptr. */
+const Specialization* valueFor(std::span<const Specialization> values, const InputStmt& in) {
+    std::string_view name = in.name;
+    for (const auto& s : values)
+        if (s.name == name) return &s;
+    // "N" also covers the N% or N! that DEFINT/DEFSNG made of a bare N
+    if (!in.defTyped) return nullptr;
+    name.remove_suffix(1);
+    for (const auto& s : values)
+        if (s.name == name) return &s;
+    return nullptr;
+}
+} // namespace
+
+/**
+ * Function: AstOptimizer::specializeInputs
+ * Purpose:
+ *  - Program specialization: compile the program for known INPUT values.
+ * Inputs:
+ *  - program: Mutable AST root
+ *  - values: Variables and the value every INPUT of them reads
+ * Outputs:
+ *  - bool: true when an INPUT was replaced
+ * Details:
+ *  - A name matches its canonical spelling. A bare name also matches the
+ *    Int or Single variable it denotes under DEFINT/DEFSNG
+ *    (InputStmt::defTyped), but never a distinct suffixed variable: with
+ *    no DEF, "N" fixes INPUT N and leaves INPUT N% alone.
+ *  - The replacement assigns a Double literal that is not flexible, so it
+ *    converts to the variable's type exactly as the value scanf reads
+ *    would. INPUTs inside FOR bodies are replaced in place too.
+ *  - Runs ahead of every other pass (PassManager::forLevel, even at -O0):
+ *    constant propagation, loop closing and unrolling and IF folding then
+ *    see the value like any other constant.
+ */
+bool AstOptimizer::specializeInputs(Program& program, std::span<const Specialization> values) {
+    if (values.empty()) return false;
+    AstArena& arena = *program.arena;
+    bool changed = false;
+    auto specialize = [&](AstRef<Stmt>& st) {
+        const auto* in = astCast<InputStmt>(st.get());
+        if (!in) return;
+        const Specialization* s = valueFor(values, *in);
+        if (!s) return;
+        auto* value = arena.make<NumberExpr>(s->value);
+        value->type = NumType::Double;
+        value->flexible = false;
+        value->pos = in->pos;
+        auto* assign = arena.make<AssignStmt>(Symbol{in->sym, in->name}, value);
+        assign->pos = in->pos;
+        st = assign;
+        changed = true;
+    };
+    for (auto& line : program.lines) {
+        for (auto& st : line.statements) {
+            if (auto* fs = astCast<ForStmt>(st.get())) {
+                for (auto& bs : fs->body) specialize(bs);
+            } else {
+                specialize(st);
+            }
+        }
+    }
+    return changed;
+}
+
+} // namespace gwbasic
@@ -2,23 +2,28 @@
 /**
  * File: ast_optimizer_stmt.cpp
  * Purpose:
- *  - Implement statement-level optimizations for `AstOptimizer`, including
- *    IF-constant reduction and FOR loop canonicalization.
+ *  - Implement statement-level optimizations for `AstOptimizer`: expression
+ *    simplification in every statement, IF-constant reduction and FOR loop
+ *    canonicalization.
  * Theory of operation:
  *  - Walks the program lines and rewrites statements in-place, delegating
  *    expression simplification to `optExpr`.
  */
 #include "basic_compiler/opt/AstOptimizer.h"
+#include <algorithm>
+#include <vector>
 
 namespace gwbasic {
 
 /**
- * Function: AstOptimizer::optimize
+ * Function: AstOptimizer::simplifyStatements
  * Purpose:
  *  - Apply a series of semantics-preserving rewrites to the program AST
  *    to simplify downstream code generation.
  * Inputs:
  *  - program: Mutable AST root to optimize
+ * Outputs:
+ *  - bool: true when anything was rewritten
  * Effects:
  *  - Mutates expressions and statements in-place; removes or replaces
  *    statements when provably redundant.
@@ -27,62 +32,75 @@ namespace gwbasic {
  *  - IF with constant condition: replace it with `GOTO` if true; drop if false.
  *  - FOR: simplify start/end/step; elide step if it becomes 1.0.
  */
-void AstOptimizer::optimize(Program& program) {
+bool AstOptimizer::simplifyStatements(Program& program) {
+    AstArena& arena = *program.arena;
+    bool changed = false;
+    std::vector<AstRef<Stmt>> newStmts; // reused scratch for every line
     for (auto&[number, statements] : program.lines) {
-        std::vector<std::unique_ptr<Stmt>> newStmts;
+        newStmts.clear();
         newStmts.reserve(statements.size());
-        for (auto& st : statements) {
-            if (const auto asg = dynamic_cast<AssignStmt*>(st.get())) {
-                asg->value = optExpr(std::move(asg->value));
-                newStmts.emplace_back(std::move(st));
-            } else if (const auto pr = dynamic_cast<PrintStmt*>(st.get())) {
-                pr->value = optExpr(std::move(pr->value));
-                newStmts.emplace_back(std::move(st));
-            } else if (const auto is = dynamic_cast<IfStmt*>(st.get())) {
-                is->cond = optExpr(std::move(is->cond));
-                if (double v; asNumber(is->cond.get(), v)) {
-                    if (v != 0.0) {
-                        // Replace with GOTO target
-                        auto g = std::make_unique<GotoStmt>(is->targetLine);
-                        g->pos = is->pos;
-                        newStmts.emplace_back(std::move(g));
+        for (const auto& st : statements) {
+            switch (st->kind) {
+                case StmtKind::Assign: {
+                    auto* asg = static_cast<AssignStmt*>(st.get());
+                    asg->value = optExpr(arena, asg->value, changed);
+                    newStmts.emplace_back(st);
+                    break;
+                }
+                case StmtKind::Print: {
+                    auto* pr = static_cast<PrintStmt*>(st.get());
+                    pr->value = optExpr(arena, pr->value, changed);
+                    newStmts.emplace_back(st);
+                    break;
+                }
+                case StmtKind::If: {
+                    auto* is = static_cast<IfStmt*>(st.get());
+                    is->cond = optExpr(arena, is->cond, changed);
+                    if (double v; asNumber(is->cond.get(), v)) {
+                        if (v != 0.0) {
+                            // Replace with GOTO target
+                            auto g = arena.make<GotoStmt>(is->targetLine);
+                            g->pos = is->pos;
+                            newStmts.emplace_back(g);
+                        } else {
+                            // Remove statement (no-op)
+                        }
+                        changed = true;
                     } else {
-                        // Remove statement (no-op)
+                        newStmts.emplace_back(st);
                     }
-                } else {
-                    newStmts.emplace_back(std::move(st));
+                    break;
                 }
-            } else if (const auto fs = dynamic_cast<ForStmt*>(st.get())) {
-                fs->start = optExpr(std::move(fs->start));
-                fs->end   = optExpr(std::move(fs->end));
-                if (fs->step) fs->step = optExpr(std::move(fs->step));
-                // If step simplifies to 1.0, drop it to trigger default path in codegen
-                if (fs->step && isOne(fs->step.get())) fs->step.reset();
-                // Optimize body
-                std::vector<std::unique_ptr<Stmt>> body;
-                body.reserve(fs->body.size());
-                for (auto& bs : fs->body) {
-                    if (const auto basg = dynamic_cast<AssignStmt*>(bs.get())) {
-                        basg->value = optExpr(std::move(basg->value));
-                        body.emplace_back(std::move(bs));
-                    } else if (const auto bpr = dynamic_cast<PrintStmt*>(bs.get())) {
-                        bpr->value = optExpr(std::move(bpr->value));
-                        body.emplace_back(std::move(bs));
-                    } else {
-                        // leave as-is; other constructs in FOR body unchanged
-                        body.emplace_back(std::move(bs));
+                case StmtKind::For: {
+                    auto* fs = static_cast<ForStmt*>(st.get());
+                    fs->start = optExpr(arena, fs->start, changed);
+                    fs->end   = optExpr(arena, fs->end, changed);
+                    if (fs->step) fs->step = optExpr(arena, fs->step, changed);
+                    // If step simplifies to 1.0, drop it to trigger default path in codegen
+                    if (fs->step && isOne(fs->step.get())) { fs->step.reset(); changed = true; }
+                    // Optimize body (statements are rewritten in place; the list is unchanged)
+                    for (const auto& bs : fs->body) {
+                        if (auto* basg = astCast<AssignStmt>(bs.get())) {
+                            basg->value = optExpr(arena, basg->value, changed);
+                        } else if (auto* bpr = astCast<PrintStmt>(bs.get())) {
+                            bpr->value = optExpr(arena, bpr->value, changed);
+                        }
+                        // other constructs in FOR body unchanged
                     }
+                    newStmts.emplace_back(st);
+                    break;
                 }
-                fs->body = std::move(body);
-                newStmts.emplace_back(std::move(st));
-            } else {
-                // Other statements: GOTO/GOSUB/RETURN/END/INPUT left unchanged
-                newStmts.emplace_back(std::move(st));
+                default:
+                    // Other statements: GOTO/GOSUB/RETURN/END/INPUT left unchanged
+                    newStmts.emplace_back(st);
+                    break;
             }
         }
-        statements = std::move(newStmts);
+        if (newStmts.size() != statements.size()) statements = arena.makeList<Stmt>(newStmts);
+        else std::ranges::copy(newStmts, statements.begin());
     }
+
+    return changed;
 }
 
 } // namespace gwbasic
-
@@ -0,0 +1,141 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_unroll_loop.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::unrollLoop`, full and partial unrolling of one
+ *    FOR loop.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/cfg/Dataflow.h"
+#include <cmath>
+
+namespace gwbasic {
+
+namespace {
+
+/** nodes: Expression nodes in e. */
+std::int64_t nodes(const Expr* e) {
+    if (!e) return 0;
+    if (const auto* b = astCast<BinaryExpr>(e)) return 1 + nodes(b->lhs.get()) + nodes(b->rhs.get());
+    if (const auto* u = astCast<UnaryExpr>(e)) return 1 + nodes(u->inner.get());
+    return 1;
+}
+
+} // namespace
+
+/**
+ * Function: AstOptimizer::unrollLoop
+ * Purpose:
+ *  - Replace a FOR with a known trip count by copies of its body.
+ * Inputs:
+ *  - arena: Program arena
+ *  - fs: The loop (its start node is reused by a partially unrolled loop)
+ *  - threshold: Budget in statement and expression nodes
+ *  - out: Receives the replacement statements on success
+ * Outputs:
+ *  - bool: true when the loop was unrolled
+ * Details:
+ *  - Only loops with literal limits whose body leaves the variable alone
+ *    qualify (constantTrips), so every iteration's counter value is known.
+ *  - Full unrolling, when trips * body size fits the budget: each copy is
+ *    preceded by `I = <value of that iteration>` and the variable ends
+ *    with its exit value. Constant propagation then folds the copies and
+ *    dead-store removal drops the intermediate stores.
+ *  - Partial unrolling, for counted loops: the largest factor u of 8 and
+ *    4 whose u body copies fit the budget. The loop keeps running the first
+ *    m = trips / u groups with STEP u * step; copy j reads I + j * step
+ *    where the body read I (exact: the values stay in the variable's range,
+ *    which is checked for Int). The trips % u remaining iterations follow
+ *    as in full unrolling. The new loop is marked unrolled so later rounds
+ *    leave it alone.
+ */
+bool AstOptimizer::unrollLoop(AstArena& arena, ForStmt& fs, int threshold, std::vector<AstRef<Stmt>>& out) {
+    if (fs.unrolled > 1 || fs.body.empty()) return false;
+    const SymbolTable& symbols = arena.symbols();
+    const SymbolId counter = varOf(symbols, fs.varSym, fs.var);
+    if (counter == kNoSymbol) return false;
+    std::int64_t size = 0;
+    for (const auto& bs : fs.body) {
+        if (const auto* asg = astCast<AssignStmt>(bs.get())) {
+            if (varOf(symbols, asg->sym, asg->name) == counter) return false;
+            size += 1 + nodes(asg->value.get());
+        } else if (const auto* pr = astCast<PrintStmt>(bs.get())) {
+            size += 1 + nodes(pr->value.get());
+        } else {
+            return false;
+        }
+    }
+    LoopTrips loop;
+    if (!constantTrips(fs, loop)) return false;
+
+    const Symbol var{fs.varSym, fs.var};
+    const VarExpr like(var);
+    // One copy of the body; reads of the variable become `I + offset`.
+    auto copyBody = [&](std::vector<AstRef<Stmt>>& into, double offset) {
+        const std::function<AstRef<Expr>(const VarExpr&)> shift = [&](const VarExpr& v) -> AstRef<Expr> {
+            if (offset == 0.0 || varOf(symbols, v.sym, v.name) != counter) return nullptr;
+            auto read = arena.make<VarExpr>(var);
+            read->pos = v.pos;
+            auto sum = arena.make<BinaryExpr>(BinaryOp::Add, read, makeNumber(arena, offset, like));
+            sum->pos = v.pos;
+            return sum;
+        };
+        bool replaced = false;
+        for (const auto& bs : fs.body) {
+            AstRef<Stmt> copy;
+            if (const auto* asg = astCast<AssignStmt>(bs.get())) {
+                copy = arena.make<AssignStmt>(Symbol{asg->sym, asg->name}, replaceVars(cloneExpr(arena, asg->value.get()), shift, replaced));
+            } else {
+                const auto* pr = static_cast<const PrintStmt*>(bs.get());
+                copy = arena.make<PrintStmt>(replaceVars(cloneExpr(arena, pr->value.get()), shift, replaced));
+            }
+            copy->pos = bs->pos;
+            into.push_back(copy);
+        }
+    };
+    auto assignVar = [&](std::vector<AstRef<Stmt>>& into, double v) {
+        auto value = makeNumber(arena, v, like);
+        if (!value) return false;
+        auto asg = arena.make<AssignStmt>(var, value);
+        asg->pos = fs.pos;
+        into.push_back(asg);
+        return true;
+    };
+    // Iterations [from, loop.count) one after another, then the exit value.
+    auto unrollTail = [&](std::vector<AstRef<Stmt>>& into, std::int64_t from) {
+        for (std::int64_t k = from; k < loop.count; ++k) {
+            if (!assignVar(into, loop.at(k))) return false;
+            copyBody(into, 0.0);
+        }
+        return assignVar(into, loop.exit);
+    };
+
+    std::vector<AstRef<Stmt>> result;
+    if (loop.count * size <= threshold) {
+        if (!unrollTail(result, 0)) return false;
+        out.insert(out.end(), result.begin(), result.end());
+        return true;
+    }
+    if (!loop.counted) return false;
+    const std::int64_t factor = 8 * size <= threshold ? 8 : 4 * size <= threshold ? 4 : 1;
+    const std::int64_t groups = loop.count / factor;
+    if (factor == 1 || groups < 2) return false;
+    const double stride = static_cast<double>(factor) * loop.step;
+    const double lastGroup = loop.first + static_cast<double>(groups - 1) * stride;
+    const double lastValue = loop.first + static_cast<double>(loop.count - 1) * loop.step;
+    if (stride > (loop.type == NumType::Single ? 16777216.0 : 2147483647.0)) return false;
+    if (loop.type == NumType::Int && (loop.first < -32768.0 || lastValue > 32767.0)) return false;
+
+    std::vector<AstRef<Stmt>> body;
+    for (std::int64_t j = 0; j < factor; ++j) copyBody(body, static_cast<double>(j) * loop.step);
+    auto* main = arena.make<ForStmt>(var, fs.start, arena.make<NumberExpr>(lastGroup), arena.make<NumberExpr>(stride));
+    main->body = arena.makeList<Stmt>(body);
+    main->unrolled = static_cast<std::uint8_t>(factor);
+    main->pos = fs.pos;
+    result.push_back(main);
+    if (groups * factor < loop.count && !unrollTail(result, groups * factor)) return false;
+    out.insert(out.end(), result.begin(), result.end());
+    return true;
+}
+
+} // namespace gwbasic
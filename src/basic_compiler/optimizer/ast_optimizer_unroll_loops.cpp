@@ -0,0 +1,51 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_unroll_loops.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::unrollLoops`, the loop unrolling pass.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::unrollLoops
+ * Purpose:
+ *  - Trade the compare/increment blocks of short FOR loops for copies of
+ *    their bodies.
+ * Inputs:
+ *  - program: Mutable AST root
+ *  - threshold: Node budget per loop (0 disables the pass)
+ * Outputs:
+ *  - bool: true when a loop was unrolled
+ * Details:
+ *  - Each FOR is replaced in its line by the statements unrollLoop
+ *    returns. The copies are ordinary straight-line code, so the next
+ *    round's constant propagation, common subexpressions and dead-store
+ *    removal work across iterations.
+ */
+bool AstOptimizer::unrollLoops(Program& program, int threshold) {
+    if (threshold <= 0) return false;
+    AstArena& arena = *program.arena;
+    bool changed = false;
+    std::vector<AstRef<Stmt>> newStmts;
+    for (auto& line : program.lines) {
+        newStmts.clear();
+        bool lineChanged = false;
+        for (const auto& st : line.statements) {
+            auto* fs = astCast<ForStmt>(st.get());
+            if (!fs || !unrollLoop(arena, *fs, threshold, newStmts)) {
+                newStmts.push_back(st);
+                continue;
+            }
+            lineChanged = true;
+        }
+        if (lineChanged) {
+            line.statements = arena.makeList<Stmt>(newStmts);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+} // namespace gwbasic
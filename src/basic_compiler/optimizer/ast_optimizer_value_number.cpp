@@ -0,0 +1,89 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+/**
+ * File: ast_optimizer_value_number.cpp
+ * Purpose:
+ *  - Define `AstOptimizer::valueNumber`, the numbering half of local
+ *    common subexpression elimination.
+ */
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/ValueTable.h"
+#include "basic_compiler/cfg/Dataflow.h"
+#include <bit>
+
+namespace gwbasic {
+
+/**
+ * Function: AstOptimizer::valueNumber
+ * Purpose:
+ *  - Assign value numbers to an expression tree, bottom-up.
+ * Inputs:
+ *  - slot: Reference holding the expression (a statement field or an
+ *    operand of the parent node)
+ *  - table: Block state (ValueTable)
+ * Outputs:
+ *  - Value number of the expression; every node's number is recorded in
+ *    `table.numbered`.
+ * Details:
+ *  - A variable read takes the number the variable currently holds; a
+ *    literal is keyed by its bits and type; an operation by its operator,
+ *    result type and operand numbers. Operations whose result is flexible
+ *    (literal-only trees and comparisons) get fresh numbers: folding
+ *    handles the former and the latter are 0/1 flags.
+ *  - The first occurrence of each Single/Double operation is registered in
+ *    `table.available` with its position, so a later occurrence can reuse
+ *    it. Int operations compute in 32 bits but Int variables hold 16, so
+ *    they are never reused.
+ */
+int AstOptimizer::valueNumber(AstRef<Expr>& slot, ValueTable& table) {
+    Expr* e = slot.get();
+    if (!e) return table.fresh();
+    auto keyed = [&](std::unordered_map<ValueTable::Key, int, ValueTable::KeyHash>& map, const ValueTable::Key& key) {
+        const auto [it, inserted] = map.try_emplace(key, 0);
+        if (inserted) it->second = table.fresh();
+        return it->second;
+    };
+    int vn;
+    switch (e->kind) {
+        case ExprKind::Var: {
+            const auto* v = static_cast<const VarExpr*>(e);
+            const SymbolId id = varOf(*table.symbols, v->sym, v->name);
+            if (id == kNoSymbol) {
+                vn = table.fresh();
+                break;
+            }
+            const auto [it, inserted] = table.vars.try_emplace(id, 0);
+            if (inserted) it->second = table.fresh();
+            vn = it->second;
+            break;
+        }
+        case ExprKind::Number: {
+            const auto* n = static_cast<const NumberExpr*>(e);
+            vn = keyed(table.literals, {n->flexible ? ValueTable::kFlexibleLiteral : ValueTable::kLiteral,
+                                        std::bit_cast<std::int64_t>(n->value), 0, n->type});
+            break;
+        }
+        case ExprKind::Unary: {
+            auto* u = static_cast<UnaryExpr*>(e);
+            const int inner = valueNumber(u->inner, table);
+            if (u->op == '+') return table.numbered[e] = inner;
+            vn = u->flexible ? table.fresh() : keyed(table.ops, {u->op, inner, 0, u->type});
+            break;
+        }
+        case ExprKind::Binary: {
+            auto* b = static_cast<BinaryExpr*>(e);
+            const int lhs = valueNumber(b->lhs, table);
+            const int rhs = valueNumber(b->rhs, table);
+            vn = b->flexible ? table.fresh() : keyed(table.ops, {static_cast<int>(b->op), lhs, rhs, b->type});
+            break;
+        }
+        default:
+            vn = table.fresh();
+            break;
+    }
+    table.numbered[e] = vn;
+    if ((e->kind == ExprKind::Binary || e->kind == ExprKind::Unary) && !e->flexible && e->type != NumType::Int)
+        table.available.try_emplace(vn, ValueTable::Available{&slot, table.line, table.stmt, table.order++, {}});
+    return vn;
+}
+
+} // namespace gwbasic
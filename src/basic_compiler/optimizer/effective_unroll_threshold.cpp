@@ -0,0 +1,33 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/opt/PassManager.h"
+
+namespace gwbasic {
+
+int effectiveUnrollThreshold(const OptOptions& options) {
+    /*
+     * Function: effectiveUnrollThreshold
+     * Inputs:
+     *  - options: optimization level and overrides
+     * Outputs:
+     *  - int: node budget per unrolled loop, 0 when unrolling is off
+     * Theory of operation:
+     *  - An explicit --unroll-threshold wins at -O2 and above (-O0 and -O1
+     *    have no unrolling pass). Defaults: -O2 allows 128 nodes, enough
+     *    for a few statements over 3-16 iterations; -O3 allows 512; -Os
+     *    never grows code.
+     */
+    switch (options.level) {
+        case OptLevel::O0:
+        case OptLevel::O1:
+            return 0;
+        case OptLevel::O2:
+            return options.unrollThreshold >= 0 ? options.unrollThreshold : 128;
+        case OptLevel::O3:
+            return options.unrollThreshold >= 0 ? options.unrollThreshold : 512;
+        case OptLevel::Os:
+            return options.unrollThreshold >= 0 ? options.unrollThreshold : 0;
+    }
+    return 0;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,24 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/opt/PassManager.h"
+
+namespace gwbasic {
+
+const char* optLevelFlag(OptLevel level) {
+    /*
+     * Function: optLevelFlag
+     * Inputs:
+     *  - level: optimization level
+     * Outputs:
+     *  - const char*: the matching clang flag
+     */
+    switch (level) {
+        case OptLevel::O1: return "-O1";
+        case OptLevel::O2: return "-O2";
+        case OptLevel::O3: return "-O3";
+        case OptLevel::Os: return "-Os";
+        case OptLevel::O0: break;
+    }
+    return "-O0";
+}
+
+} // namespace gwbasic
@@ -0,0 +1,28 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/opt/PassManager.h"
+
+namespace gwbasic {
+
+bool parseOptLevel(std::string_view flag, OptLevel& out) {
+    /*
+     * Function: parseOptLevel
+     * Inputs:
+     *  - flag: command-line token
+     *  - out: receives the level on success
+     * Outputs:
+     *  - bool: true when flag is -O0, -O1, -O2, -O3 or -Os
+     * Theory of operation:
+     *  - Exact match only, as clang spells them; "-O" alone is rejected.
+     */
+    if (flag.size() != 3 || flag[0] != '-' || flag[1] != 'O') return false;
+    switch (flag[2]) {
+        case '0': out = OptLevel::O0; return true;
+        case '1': out = OptLevel::O1; return true;
+        case '2': out = OptLevel::O2; return true;
+        case '3': out = OptLevel::O3; return true;
+        case 's': out = OptLevel::Os; return true;
+        default: return false;
+    }
+}
+
+} // namespace gwbasic
@@ -0,0 +1,42 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/opt/Specialization.h"
+#include "basic_compiler/ast/NumType.h"
+#include <cctype>
+#include <charconv>
+#include <cmath>
+
+namespace gwbasic {
+
+bool parseSpecialization(std::string_view text, Specialization& out) {
+    /*
+     * Function: parseSpecialization
+     * Inputs:
+     *  - text: argument of --specialize, e.g. "N=100" or "K%=-3"
+     *  - out: receives the name and value on success
+     * Outputs:
+     *  - bool: true when text is a variable name, '=' and a finite number
+     * Theory of operation:
+     *  - The name follows the lexer's identifier shape; its suffix selects
+     *    the canonical spelling the parser interns, so "N#" and "N" name
+     *    the same Double variable. The value is read with std::from_chars
+     *    (as Parser::numberOf reads literals) and must use all of its text.
+     */
+    const std::size_t eq = text.find('=');
+    if (eq == std::string_view::npos) return false;
+    std::string_view name = text.substr(0, eq);
+    const std::string_view value = text.substr(eq + 1);
+    if (!name.empty() && isTypeSuffix(name.back())) name.remove_suffix(1);
+    if (name.empty() || !std::isalpha(static_cast<unsigned char>(name.front()))) return false;
+    for (const char c : name)
+        if (!std::isalnum(static_cast<unsigned char>(c))) return false;
+    double v = 0.0;
+    const char* last = value.data() + value.size();
+    if (const auto [ptr, ec] = std::from_chars(value.data(), last, v); ec != std::errc{} || ptr != last) return false;
+    if (!std::isfinite(v)) return false;
+    out.name.assign(name);
+    if (const char suffix = text[eq - 1]; suffix == '%' || suffix == '!') out.name.push_back(suffix);
+    out.value = v;
+    return true;
+}
+
+} // namespace gwbasic
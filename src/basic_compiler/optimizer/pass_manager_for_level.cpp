@@ -0,0 +1,59 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/opt/PassManager.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+namespace gwbasic {
+
+PassManager PassManager::forLevel(const OptOptions& options) {
+    /*
+     * Function: PassManager::forLevel
+     * Inputs:
+     *  - options: optimization level and overrides
+     * Outputs:
+     *  - PassManager: the standard pipeline for the level
+     * Theory of operation:
+     *  - Specializations come first at every level: once their INPUTs are
+     *    constant assignments, the passes below fold them like any other.
+     *  - -O0 is otherwise empty, so the program reaches codegen as parsed.
+     *    Every other level simplifies statements and then drops dead lines;
+     *    -O1 stops after one round. -O2 and above add the dataflow passes
+     *    (constant and copy propagation, closing FOR recurrences once the
+     *    constants are known, loop unrolling within the unroll budget,
+     *    common subexpressions, dead stores) ahead of dead-line removal,
+     *    then loop-invariant code motion, and iterate to a fixpoint.
+     *    Unrolling is left out when the budget is 0 (-Os by default).
+     *  - -O3 first runs the program at compile time as far as it needs no
+     *    input (evaluate-program), trading its code for the text it prints.
+     */
+    const OptLevel level = options.level;
+    PassManager pm;
+    if (!options.specializations.empty()) {
+        pm.add("specialize-inputs", [values = options.specializations](Program& program) {
+            return AstOptimizer::specializeInputs(program, values);
+        });
+    }
+    if (level == OptLevel::O0) {
+        pm.setMaxRounds(1);
+        return pm;
+    }
+    pm.add("simplify-stmts", &AstOptimizer::simplifyStatements);
+    if (level == OptLevel::O1) {
+        pm.add("remove-dead-lines", &AstOptimizer::removeDeadLines);
+        pm.setMaxRounds(1);
+        return pm;
+    }
+    if (level == OptLevel::O3)
+        pm.add("evaluate-program", [](Program& program) { return AstOptimizer::evaluateProgram(program, kEvaluationSteps); });
+    pm.add("propagate-constants", &AstOptimizer::propagateConstants);
+    pm.add("propagate-copies", &AstOptimizer::propagateCopies);
+    pm.add("close-recurrences", &AstOptimizer::closeRecurrences);
+    if (const int threshold = effectiveUnrollThreshold(options); threshold > 0)
+        pm.add("unroll-loops", [threshold](Program& program) { return AstOptimizer::unrollLoops(program, threshold); });
+    pm.add("common-subexprs", &AstOptimizer::eliminateCommonSubexpressions);
+    pm.add("remove-dead-stores", &AstOptimizer::removeDeadStores);
+    pm.add("remove-dead-lines", &AstOptimizer::removeDeadLines);
+    pm.add("hoist-loop-invariants", &AstOptimizer::hoistLoopInvariants);
+    return pm;
+}
+
+} // namespace gwbasic
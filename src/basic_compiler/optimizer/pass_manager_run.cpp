@@ -0,0 +1,50 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <chrono>
+
+#include "basic_compiler/opt/PassManager.h"
+
+namespace gwbasic {
+
+PassStats PassManager::run(Program& program) const {
+    /*
+     * Function: PassManager::run
+     * Inputs:
+     *  - program: AST to rewrite in place
+     * Outputs:
+     *  - PassStats: runs/changes/time per pass, rounds, convergence
+     * Theory of operation:
+     *  - Runs every pass in order per round; a round in which no pass
+     *    reports a change is the fixpoint. Reaching maxRounds_ with changes
+     *    still happening leaves converged false (the program is valid, just
+     *    possibly not fully simplified).
+     *  - Analyses the passes shared (AstArena::analyses) are dropped at the
+     *    end; codegen builds its own.
+     */
+    using Clock = std::chrono::steady_clock;
+    PassStats stats;
+    stats.passes.reserve(passes_.size());
+    for (const Entry& e : passes_) stats.passes.push_back({e.name});
+    if (passes_.empty()) return stats;
+    stats.converged = false;
+    while (stats.rounds < maxRounds_) {
+        ++stats.rounds;
+        bool changed = false;
+        for (std::size_t i = 0; i < passes_.size(); ++i) {
+            const auto t0 = Clock::now();
+            const bool c = passes_[i].pass(program);
+            PassStats::Pass& s = stats.passes[i];
+            s.ms += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+            ++s.runs;
+            if (c) ++s.changes;
+            changed = changed || c;
+        }
+        if (!changed) {
+            stats.converged = true;
+            break;
+        }
+    }
+    program.arena->analyses().reset();
+    return stats;
+}
+
+} // namespace gwbasic
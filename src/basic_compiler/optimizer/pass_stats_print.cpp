@@ -0,0 +1,29 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <cstdio>
+
+#include "basic_compiler/opt/PassManager.h"
+
+namespace gwbasic {
+
+void PassStats::print(std::ostream& os) const {
+    /*
+     * Function: PassStats::print
+     * Inputs:
+     *  - os: destination (the CLI uses stderr)
+     * Outputs:
+     *  - void
+     * Theory of operation:
+     *  - Fixed-width table, one row per pass in pipeline order, then the
+     *    round count and whether a fixpoint was reached.
+     */
+    char buf[128];
+    std::snprintf(buf, sizeof(buf), "%-24s %6s %8s %10s\n", "pass", "runs", "changed", "ms");
+    os << buf;
+    for (const Pass& p : passes) {
+        std::snprintf(buf, sizeof(buf), "%-24.*s %6d %8d %10.3f\n", static_cast<int>(p.name.size()), p.name.data(), p.runs, p.changes, p.ms);
+        os << buf;
+    }
+    os << rounds << (rounds == 1 ? " round" : " rounds") << (converged ? ", fixpoint reached\n" : ", stopped at round limit\n");
+}
+
+} // namespace gwbasic
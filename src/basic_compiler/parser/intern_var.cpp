@@ -0,0 +1,36 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Parser.h"
+
+namespace gwbasic {
+
+Symbol Parser::internVar(const std::string_view lexeme) {
+    /*
+     * Function: Parser::internVar
+     * Inputs:
+     *  - lexeme: Identifier token text, possibly ending in % ! or #
+     * Outputs:
+     *  - Symbol: interned canonical name
+     * Theory of operation:
+     *  - The type comes from the suffix, or else from the DEF declaration
+     *    for the first letter. The canonical name is the base name plus '%'
+     *    (Int) or '!' (Single), and the bare base name for Double, so "A#"
+     *    and an undeclared "A" are one variable and typeOfName() recovers
+     *    the type from the name alone. The name is assembled in a reused
+     *    buffer; intern() copies it into the arena.
+     */
+    std::string_view base = lexeme;
+    NumType type;
+    if (!base.empty() && isTypeSuffix(base.back())) {
+        type = typeOfSuffix(base.back());
+        base.remove_suffix(1);
+    } else {
+        const char c = static_cast<char>(base.empty() ? 'A' : base.front() & ~0x20);
+        type = (c >= 'A' && c <= 'Z') ? defTypes_[c - 'A'] : NumType::Double;
+    }
+    if (type == NumType::Double) return arena_->intern(base);
+    varName_.assign(base);
+    varName_.push_back(type == NumType::Int ? '%' : '!');
+    return arena_->intern(varName_);
+}
+
+} // namespace gwbasic
@@ -0,0 +1,31 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Parser.h"
+#include <charconv>
+#include <sstream>
+
+namespace gwbasic {
+
+int Parser::lineNumberOf(const Token& t) {
+    /*
+     * Function: Parser::lineNumberOf
+     * Inputs:
+     *  - t: Integer token (line number or GOTO/GOSUB/THEN target)
+     * Outputs:
+     *  - int: decoded value
+     * Theory of operation:
+     *  - Parses the lexeme view in place with std::from_chars (std::stoi
+     *    would need an owned string). Values that do not fit an int raise
+     *    ParseError instead of escaping as std::out_of_range.
+     */
+    int v = 0;
+    const char* first = t.lexeme.data();
+    const char* last = first + t.lexeme.size();
+    if (const auto [ptr, ec] = std::from_chars(first, last, v); ec != std::errc{} || ptr != last) {
+        std::ostringstream oss;
+        oss << "Invalid line number '" << t.lexeme << "' at " << t.line << ":" << t.col;
+        throw ParseError(oss.str());
+    }
+    return v;
+}
+
+} // namespace gwbasic
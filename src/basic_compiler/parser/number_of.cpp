@@ -0,0 +1,30 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Parser.h"
+#include <charconv>
+#include <sstream>
+
+namespace gwbasic {
+
+double Parser::numberOf(const Token& t) {
+    /*
+     * Function: Parser::numberOf
+     * Inputs:
+     *  - t: Integer or Float token
+     * Outputs:
+     *  - double: literal value
+     * Theory of operation:
+     *  - Parses the lexeme view in place with std::from_chars, which accepts
+     *    the lexer's digit[.digit] forms (including a trailing '.').
+     */
+    double v = 0.0;
+    const char* first = t.lexeme.data();
+    const char* last = first + t.lexeme.size();
+    if (const auto [ptr, ec] = std::from_chars(first, last, v); ec != std::errc{} || ptr != last) {
+        std::ostringstream oss;
+        oss << "Invalid numeric literal '" << t.lexeme << "' at " << t.line << ":" << t.col;
+        throw ParseError(oss.str());
+    }
+    return v;
+}
+
+} // namespace gwbasic
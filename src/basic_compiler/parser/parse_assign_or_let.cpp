@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Stmt> Parser::parseAssignOrLet() {
+AstRef<Stmt> Parser::parseAssignOrLet() {
     /*
      * Function: Parser::parseAssignOrLet
      * Inputs:
@@ -18,12 +18,12 @@ std::unique_ptr<Stmt> Parser::parseAssignOrLet() {
         // proceed to identifier
     }
     if (!check(TokenType::Identifier)) throw ParseError("Expected variable name after LET");
-    std::string name = peek().lexeme;
+    const Symbol name = internVar(peek().lexeme);
     int l = peek().line, c = peek().col;
     advance();
     consume(TokenType::Assign, "'='");
     auto expr = parseExpression();
-    auto n = std::make_unique<AssignStmt>(name, std::move(expr));
+    auto n = arena_->make<AssignStmt>(name, expr);
     n->pos = {l, c};
     return n;
 }
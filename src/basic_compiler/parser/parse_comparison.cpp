@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Expr> Parser::parseComparison() {
+AstRef<Expr> Parser::parseComparison() {
     /*
      * Function: Parser::parseComparison
      * Inputs:
@@ -16,12 +16,12 @@ std::unique_ptr<Expr> Parser::parseComparison() {
      */
     auto left = parseTerm();
     while (true) {
-        if (match(TokenType::Assign)) { auto right = parseTerm(); left = std::make_unique<BinaryExpr>(BinaryOp::Eq, std::move(left), std::move(right)); }
-        else if (match(TokenType::NotEqual)) { auto right = parseTerm(); left = std::make_unique<BinaryExpr>(BinaryOp::Ne, std::move(left), std::move(right)); }
-        else if (match(TokenType::LessEqual)) { auto right = parseTerm(); left = std::make_unique<BinaryExpr>(BinaryOp::Le, std::move(left), std::move(right)); }
-        else if (match(TokenType::GreaterEqual)) { auto right = parseTerm(); left = std::make_unique<BinaryExpr>(BinaryOp::Ge, std::move(left), std::move(right)); }
-        else if (match(TokenType::Less)) { auto right = parseTerm(); left = std::make_unique<BinaryExpr>(BinaryOp::Lt, std::move(left), std::move(right)); }
-        else if (match(TokenType::Greater)) { auto right = parseTerm(); left = std::make_unique<BinaryExpr>(BinaryOp::Gt, std::move(left), std::move(right)); }
+        if (match(TokenType::Assign)) { auto right = parseTerm(); left = arena_->make<BinaryExpr>(BinaryOp::Eq, left, right); }
+        else if (match(TokenType::NotEqual)) { auto right = parseTerm(); left = arena_->make<BinaryExpr>(BinaryOp::Ne, left, right); }
+        else if (match(TokenType::LessEqual)) { auto right = parseTerm(); left = arena_->make<BinaryExpr>(BinaryOp::Le, left, right); }
+        else if (match(TokenType::GreaterEqual)) { auto right = parseTerm(); left = arena_->make<BinaryExpr>(BinaryOp::Ge, left, right); }
+        else if (match(TokenType::Less)) { auto right = parseTerm(); left = arena_->make<BinaryExpr>(BinaryOp::Lt, left, right); }
+        else if (match(TokenType::Greater)) { auto right = parseTerm(); left = arena_->make<BinaryExpr>(BinaryOp::Gt, left, right); }
         else break;
     }
     return left;
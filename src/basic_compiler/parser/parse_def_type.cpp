@@ -0,0 +1,54 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/token/ToString.h"
+#include <sstream>
+
+namespace gwbasic {
+
+bool Parser::parseDefType() {
+    /*
+     * Function: Parser::parseDefType
+     * Inputs:
+     *  - none (current token may be DEFINT, DEFSNG or DEFDBL)
+     * Outputs:
+     *  - bool: true when a declaration was consumed
+     * Theory of operation:
+     *  - Parses "DEFINT A-C, X" style letter lists and records the type for
+     *    each letter (case-insensitive). Declarations apply to names parsed
+     *    after them, in source order; names with a suffix are unaffected.
+     *    Anything other than a single letter or a letter range throws
+     *    ParseError.
+     */
+    NumType type;
+    if (check(TokenType::KwDefint)) type = NumType::Int;
+    else if (check(TokenType::KwDefsng)) type = NumType::Single;
+    else if (check(TokenType::KwDefdbl)) type = NumType::Double;
+    else return false;
+    advance();
+
+    auto letter = [&]() {
+        const Token& t = peek();
+        const char c = t.lexeme.size() == 1 ? static_cast<char>(t.lexeme[0] & ~0x20) : '\0';
+        if (t.type != TokenType::Identifier || c < 'A' || c > 'Z') {
+            std::ostringstream oss;
+            oss << "Expected letter in DEF type declaration, got " << to_string(t.type)
+                << " at " << t.line << ":" << t.col;
+            throw ParseError(oss.str());
+        }
+        advance();
+        return c - 'A';
+    };
+    do {
+        const int from = letter();
+        const int to = match(TokenType::Minus) ? letter() : from;
+        if (to < from) {
+            std::ostringstream oss;
+            oss << "Descending letter range in DEF type declaration at " << peek().line << ":" << peek().col;
+            throw ParseError(oss.str());
+        }
+        for (int i = from; i <= to; ++i) defTypes_[i] = type;
+    } while (match(TokenType::Comma));
+    return true;
+}
+
+} // namespace gwbasic
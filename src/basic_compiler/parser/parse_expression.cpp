@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Expr> Parser::parseExpression() {
+AstRef<Expr> Parser::parseExpression() {
     /*
      * Function: Parser::parseExpression
      * Inputs:
@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Expr> Parser::parseFactor() {
+AstRef<Expr> Parser::parseFactor() {
     /*
      * Function: Parser::parseFactor
      * Inputs:
@@ -16,8 +16,8 @@ std::unique_ptr<Expr> Parser::parseFactor() {
      */
     auto left = parseUnary();
     while (true) {
-        if (match(TokenType::Star)) { auto right = parseUnary(); left = std::make_unique<BinaryExpr>(BinaryOp::Mul, std::move(left), std::move(right)); }
-        else if (match(TokenType::Slash)) { auto right = parseUnary(); left = std::make_unique<BinaryExpr>(BinaryOp::Div, std::move(left), std::move(right)); }
+        if (match(TokenType::Star)) { auto right = parseUnary(); left = arena_->make<BinaryExpr>(BinaryOp::Mul, left, right); }
+        else if (match(TokenType::Slash)) { auto right = parseUnary(); left = arena_->make<BinaryExpr>(BinaryOp::Div, left, right); }
         else break;
     }
     return left;
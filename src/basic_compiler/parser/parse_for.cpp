@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Stmt> Parser::parseFor() {
+AstRef<Stmt> Parser::parseFor() {
     /*
      * Function: Parser::parseFor
      * Inputs:
@@ -15,26 +15,28 @@ std::unique_ptr<Stmt> Parser::parseFor() {
      *    optional STEP, then collects statements until NEXT on the same line.
      */
     if (!check(TokenType::Identifier)) throw ParseError("Expected variable name after FOR");
-    std::string var = peek().lexeme;
+    const Symbol var = internVar(peek().lexeme);
     int l = peek().line, c = peek().col;
     advance();
     consume(TokenType::Assign, "'='");
     auto start = parseExpression();
     consume(TokenType::KwTo, "TO");
     auto end = parseExpression();
-    std::unique_ptr<Expr> step;
+    AstRef<Expr> step;
     if (match(TokenType::KwStep)) {
         step = parseExpression();
     }
-    auto node = std::make_unique<ForStmt>(var, std::move(start), std::move(end), std::move(step));
+    auto node = arena_->make<ForStmt>(var, start, end, step);
+    const size_t mark = stmtScratch_.size();
     while (!check(TokenType::KwNext)) {
         if (check(TokenType::NewLine) || atEnd()) {
             throw ParseError("FOR body must end with NEXT on the same line for now");
         }
         if (match(TokenType::Colon)) continue;
-        node->body.push_back(parseStatement());
+        stmtScratch_.push_back(parseStatement());
         if (match(TokenType::Colon)) continue;
     }
+    node->body = takeStmtList(mark);
     consume(TokenType::KwNext, "NEXT");
     if (check(TokenType::Identifier)) {
         advance();
@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Stmt> Parser::parseIf() {
+AstRef<Stmt> Parser::parseIf() {
     /*
      * Function: Parser::parseIf
      * Inputs:
@@ -18,9 +18,9 @@ std::unique_ptr<Stmt> Parser::parseIf() {
     int l = peek().line, c = peek().col;
     consume(TokenType::KwThen, "THEN");
     if (!check(TokenType::Integer)) throw ParseError("Expected line number after THEN");
-    int target = std::stoi(peek().lexeme);
+    int target = lineNumberOf(peek());
     advance();
-    auto n = std::make_unique<IfStmt>(std::move(cond), target);
+    auto n = arena_->make<IfStmt>(cond, target);
     n->pos = {l, c};
     return n;
 }
@@ -14,6 +14,7 @@ Line Parser::parseLine() {
      * Theory of operation:
      *  - Reads a leading Integer token as the line number, then parses one or
      *    more statements separated by ':' until a newline or EOF is reached.
+     *    DEFINT/DEFSNG/DEFDBL take effect in the parser and add no node.
      */
     Line line;
     if (!check(TokenType::Integer)) {
@@ -21,21 +22,22 @@ Line Parser::parseLine() {
         oss << "Expected line number at " << peek().line << ":" << peek().col;
         throw ParseError(oss.str());
     }
-    line.number = std::stoi(peek().lexeme);
+    line.number = lineNumberOf(peek());
     advance();
 
+    const size_t mark = stmtScratch_.size();
     while (!atEnd() && !check(TokenType::NewLine)) {
-        auto st = parseStatement();
-        line.statements.push_back(std::move(st));
-        const auto& last = line.statements.back();
-        {
-            std::ostringstream m;
-            m << "line " << line.number << ' ' << nodeName(last.get()) << " @ " << last->pos.line << ':' << last->pos.col;
-            logSyntax(m.str());
+        if (parseDefType()) {
+            match(TokenType::Colon);
+            continue;
         }
+        const auto last = parseStatement();
+        stmtScratch_.push_back(last);
+        GWBASIC_LOG(syntaxLog_, Debug, "line ", line.number, ' ', nodeName(last.get()), " @ ", last->pos.line, ':', last->pos.col);
         if (match(TokenType::Colon)) continue;
         if (check(TokenType::NewLine)) break;
     }
+    line.statements = takeStmtList(mark);
     match(TokenType::NewLine);
     return line;
 }
@@ -5,7 +5,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Expr> Parser::parsePrimary() {
+AstRef<Expr> Parser::parsePrimary() {
     /*
      * Function: Parser::parsePrimary
      * Inputs:
@@ -18,25 +18,25 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
      */
     if (check(TokenType::Integer) || check(TokenType::Float)) {
         int l = peek().line, c = peek().col;
-        double v = std::stod(peek().lexeme);
+        double v = numberOf(peek());
         advance();
-        auto n = std::make_unique<NumberExpr>(v);
+        auto n = arena_->make<NumberExpr>(v);
         n->pos = {l, c};
         return n;
     }
     if (check(TokenType::String)) {
         int l = peek().line, c = peek().col;
-        std::string s = peek().lexeme;
+        const Symbol s = stringValueOf(peek());
         advance();
-        auto n = std::make_unique<StringExpr>(s);
+        auto n = arena_->make<StringExpr>(s);
         n->pos = {l, c};
         return n;
     }
     if (check(TokenType::Identifier)) {
         int l = peek().line, c = peek().col;
-        std::string n = peek().lexeme;
+        const Symbol n = internVar(peek().lexeme);
         advance();
-        auto v = std::make_unique<VarExpr>(n);
+        auto v = arena_->make<VarExpr>(n);
         v->pos = {l, c};
         return v;
     }
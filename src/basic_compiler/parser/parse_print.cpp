@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Stmt> Parser::parsePrint() {
+AstRef<Stmt> Parser::parsePrint() {
     /*
      * Function: Parser::parsePrint
      * Inputs:
@@ -16,19 +16,18 @@ std::unique_ptr<Stmt> Parser::parsePrint() {
      *    output.
      */
     if (check(TokenType::String)) {
-        std::string s = peek().lexeme;
+        const Symbol s = stringValueOf(peek());
         const int l = peek().line;
         const int c = peek().col;
         advance();
-        auto n = std::make_unique<PrintStmt>(std::make_unique<StringExpr>(s));
+        auto n = arena_->make<PrintStmt>(arena_->make<StringExpr>(s));
         n->pos = {l, c};
         return n;
     }
     auto expr = parseExpression();
-    // Capture position before moving from the unique_ptr to avoid use-after-move
     const int eline = expr->pos.line;
     const int ecol = expr->pos.col;
-    auto n = std::make_unique<PrintStmt>(std::move(expr));
+    auto n = arena_->make<PrintStmt>(expr);
     n->pos = {eline, ecol};
     return n;
 }
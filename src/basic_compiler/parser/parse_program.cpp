@@ -1,4 +1,7 @@
 // (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <algorithm>
+#include <iterator>
+
 #include "basic_compiler/Parser.h"
 
 namespace gwbasic {
@@ -12,9 +15,13 @@ Program Parser::parseProgram() {
      *  - Program: AST containing ordered lines with statements
      * Theory of operation:
      *  - Skips leading blank lines; repeatedly parses a numbered line until
-     *    EndOfFile, producing the program AST.
+     *    EndOfFile, producing the program AST. DEF type declarations start
+     *    out as all-Double for each program.
      */
     Program prog;
+    arena_ = prog.arena.get();
+    stmtScratch_.clear();
+    std::fill(std::begin(defTypes_), std::end(defTypes_), NumType::Double);
     while (!atEnd()) {
         while (match(TokenType::NewLine)) {}
         if (atEnd()) break;
@@ -5,14 +5,14 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Stmt> Parser::parseStatement() {
+AstRef<Stmt> Parser::parseStatement() {
     Token startTok = peek();
     /*
      * Function: Parser::parseStatement
      * Inputs:
      *  - none (examines current token)
      * Outputs:
-     *  - std::unique_ptr<Stmt>: Parsed statement node
+     *  - AstRef<Stmt>: Parsed statement node (arena-owned)
      * Theory of operation:
      *  - Dispatches based on the next token to the appropriate parse method
      *    (PRINT, assignment/LET, IF, FOR, GOTO, GOSUB/RETURN, INPUT, END),
@@ -24,31 +24,35 @@ std::unique_ptr<Stmt> Parser::parseStatement() {
     if (match(TokenType::KwFor)) { auto n = parseFor(); n->pos = {startTok.line, startTok.col}; return n; }
     if (match(TokenType::KwGoto)) {
         if (!check(TokenType::Integer)) throw ParseError("Expected line number after GOTO");
-        int target = std::stoi(peek().lexeme);
+        int target = lineNumberOf(peek());
         advance();
-        auto n = std::make_unique<GotoStmt>(target);
+        auto n = arena_->make<GotoStmt>(target);
         n->pos = {startTok.line, startTok.col};
         return n;
     }
     if (match(TokenType::KwGosub)) {
         if (!check(TokenType::Integer)) throw ParseError("Expected line number after GOSUB");
-        int target = std::stoi(peek().lexeme);
+        int target = lineNumberOf(peek());
         advance();
-        auto n = std::make_unique<GosubStmt>(target);
+        auto n = arena_->make<GosubStmt>(target);
         n->pos = {startTok.line, startTok.col};
         return n;
     }
     if (match(TokenType::KwReturn)) {
-        auto n = std::make_unique<ReturnStmt>(); n->pos = {startTok.line, startTok.col}; return n;
+        auto n = arena_->make<ReturnStmt>(); n->pos = {startTok.line, startTok.col}; return n;
     }
     if (match(TokenType::KwInput)) {
         if (!check(TokenType::Identifier)) throw ParseError("Expected variable name after INPUT");
-        std::string name = peek().lexeme;
+        const Symbol name = internVar(peek().lexeme);
         advance();
-        auto n = std::make_unique<InputStmt>(name); n->pos = {startTok.line, startTok.col}; return n;
+        auto n = arena_->make<InputStmt>(name); n->pos = {startTok.line, startTok.col};
+        const NumType type = typeOfName(name.text);
+        const char c = static_cast<char>(name.text.front() & ~0x20);
+        n->defTyped = type != NumType::Double && c >= 'A' && c <= 'Z' && defTypes_[c - 'A'] == type;
+        return n;
     }
     if (match(TokenType::KwEnd)) {
-        auto n = std::make_unique<EndStmt>(); n->pos = {startTok.line, startTok.col}; return n;
+        auto n = arena_->make<EndStmt>(); n->pos = {startTok.line, startTok.col}; return n;
     }
     std::ostringstream oss;
     oss << "Unexpected token in statement: " << to_string(peek().type) << " at " << peek().line << ":" << peek().col;
@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Expr> Parser::parseTerm() {
+AstRef<Expr> Parser::parseTerm() {
     /*
      * Function: Parser::parseTerm
      * Inputs:
@@ -15,8 +15,8 @@ std::unique_ptr<Expr> Parser::parseTerm() {
      */
     auto left = parseFactor();
     while (true) {
-        if (match(TokenType::Plus)) { auto right = parseFactor(); left = std::make_unique<BinaryExpr>(BinaryOp::Add, std::move(left), std::move(right)); }
-        else if (match(TokenType::Minus)) { auto right = parseFactor(); left = std::make_unique<BinaryExpr>(BinaryOp::Sub, std::move(left), std::move(right)); }
+        if (match(TokenType::Plus)) { auto right = parseFactor(); left = arena_->make<BinaryExpr>(BinaryOp::Add, left, right); }
+        else if (match(TokenType::Minus)) { auto right = parseFactor(); left = arena_->make<BinaryExpr>(BinaryOp::Sub, left, right); }
         else break;
     }
     return left;
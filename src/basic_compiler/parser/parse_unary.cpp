@@ -3,7 +3,7 @@
 
 namespace gwbasic {
 
-std::unique_ptr<Expr> Parser::parseUnary() {
+AstRef<Expr> Parser::parseUnary() {
     /*
      * Function: Parser::parseUnary
      * Inputs:
@@ -14,8 +14,8 @@ std::unique_ptr<Expr> Parser::parseUnary() {
      *  - Recognizes leading '+' or '-' and constructs a UnaryExpr; otherwise
      *    defers to parsePrimary().
      */
-    if (match(TokenType::Plus)) return std::make_unique<UnaryExpr>('+', parseUnary());
-    if (match(TokenType::Minus)) return std::make_unique<UnaryExpr>('-', parseUnary());
+    if (match(TokenType::Plus)) return arena_->make<UnaryExpr>('+', parseUnary());
+    if (match(TokenType::Minus)) return arena_->make<UnaryExpr>('-', parseUnary());
     return parsePrimary();
 }
 
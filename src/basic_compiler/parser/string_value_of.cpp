@@ -0,0 +1,23 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+
+namespace gwbasic {
+
+Symbol Parser::stringValueOf(const Token& t) {
+    /*
+     * Function: Parser::stringValueOf
+     * Inputs:
+     *  - t: String token (lexeme is the raw body between the quotes)
+     * Outputs:
+     *  - Symbol: decoded literal interned in the Program arena
+     * Theory of operation:
+     *  - Literals without a backslash are interned straight from the source
+     *    view; only those with escapes are decoded through a temporary.
+     *    Repeated literals share one copy and one symbol id.
+     */
+    if (t.lexeme.find('\\') == std::string_view::npos) return arena_->intern(t.lexeme);
+    return arena_->intern(unescapeStringLiteral(t.lexeme));
+}
+
+} // namespace gwbasic
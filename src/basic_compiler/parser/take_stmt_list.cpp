@@ -0,0 +1,24 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/Parser.h"
+
+namespace gwbasic {
+
+AstList<Stmt> Parser::takeStmtList(const size_t mark) {
+    /*
+     * Function: Parser::takeStmtList
+     * Inputs:
+     *  - mark: scratch stack size recorded before the list was started
+     * Outputs:
+     *  - AstList<Stmt>: arena copy of the statements pushed since mark
+     * Theory of operation:
+     *  - Copies the top of the shared scratch stack into a single arena
+     *    array and pops those entries, so lists cost one bump allocation
+     *    instead of a growing heap vector per line/FOR body.
+     */
+    const std::span<const AstRef<Stmt>> items(stmtScratch_.data() + mark, stmtScratch_.size() - mark);
+    AstList<Stmt> list = arena_->makeList(items);
+    stmtScratch_.resize(mark);
+    return list;
+}
+
+} // namespace gwbasic
@@ -0,0 +1,51 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/SourceBuffer.h"
+
+#include <utility>
+
+namespace gwbasic {
+
+/*
+ * Function: SourceBuffer::fromString
+ * Inputs:
+ *  - text: program source
+ * Outputs:
+ *  - SourceBuffer owning text
+ * Theory of operation:
+ *  - In-memory sources are kept by value; text() views the owned string.
+ */
+SourceBuffer SourceBuffer::fromString(std::string text) {
+    SourceBuffer buf;
+    buf.owned_ = std::move(text);
+    return buf;
+}
+
+/*
+ * Function: SourceBuffer move constructor / move assignment / destructor
+ * Inputs:
+ *  - other: buffer to take the mapping or string from
+ * Outputs:
+ *  - none
+ * Theory of operation:
+ *  - The mapping pointer is transferred and cleared in the source so it is
+ *    unmapped exactly once. text() is derived on demand, so an owned string
+ *    that moves (including small-string storage) never leaves a stale view.
+ */
+SourceBuffer::SourceBuffer(SourceBuffer&& other) noexcept
+    : mapped_(std::exchange(other.mapped_, nullptr)),
+      mappedLen_(std::exchange(other.mappedLen_, 0)),
+      owned_(std::move(other.owned_)) {}
+
+SourceBuffer& SourceBuffer::operator=(SourceBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        mapped_ = std::exchange(other.mapped_, nullptr);
+        mappedLen_ = std::exchange(other.mappedLen_, 0);
+        owned_ = std::move(other.owned_);
+    }
+    return *this;
+}
+
+SourceBuffer::~SourceBuffer() { release(); }
+
+} // namespace gwbasic
@@ -0,0 +1,77 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include "basic_compiler/SourceBuffer.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GWBASIC_HAVE_MMAP 1
+#endif
+
+namespace gwbasic {
+
+/*
+ * Function: SourceBuffer::mapFile
+ * Inputs:
+ *  - path: filesystem path to a GW-BASIC source file
+ * Outputs:
+ *  - SourceBuffer: read-only view of the file contents
+ * Theory of operation:
+ *  - Opens the file and maps it PROT_READ/MAP_PRIVATE so the kernel pages
+ *    it in on demand and nothing is copied into the heap. Non-regular or
+ *    empty files (and platforms without mmap) are read into an owned string
+ *    instead. Open failures throw with the same message the ifstream-based
+ *    loaders used.
+ */
+SourceBuffer SourceBuffer::mapFile(const std::string& path) {
+    SourceBuffer buf;
+#ifdef GWBASIC_HAVE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error(std::string("Unable to open input file: ").append(path));
+    struct stat st{};
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        const auto len = static_cast<std::size_t>(st.st_size);
+        void* p = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            ::close(fd);
+#ifdef MADV_SEQUENTIAL
+            ::madvise(p, len, MADV_SEQUENTIAL);
+#endif
+            buf.mapped_ = p;
+            buf.mappedLen_ = len;
+            return buf;
+        }
+    }
+    ::close(fd);
+#endif
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error(std::string("Unable to open input file: ").append(path));
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    buf.owned_ = std::move(ss).str();
+    return buf;
+}
+
+/*
+ * Function: SourceBuffer::release
+ * Inputs:
+ *  - none
+ * Outputs:
+ *  - void (unmaps the file, if any)
+ * Theory of operation:
+ *  - Shared by the destructor and move assignment.
+ */
+void SourceBuffer::release() noexcept {
+#ifdef GWBASIC_HAVE_MMAP
+    if (mapped_) ::munmap(mapped_, mappedLen_);
+#endif
+    mapped_ = nullptr;
+    mappedLen_ = 0;
+}
+
+} // namespace gwbasic
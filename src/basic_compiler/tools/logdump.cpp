@@ -0,0 +1,49 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "basic_compiler/SourceBuffer.h"
+#include "basic_compiler/codegen/IrSink.h"
+#include "basic_compiler/log/LogFormat.h"
+
+/**
+ * Function: main (basic_compiler-logdump)
+ * Inputs:
+ *  - argc/argv: one or more phase-log files (.lex.log, .syntax.log,
+ *    .semantic.log, .codegen.log)
+ * Outputs:
+ *  - int: Exit status (0=success, 1=unreadable/malformed log, 2=usage)
+ * Theory of operation:
+ *  - Maps each file and, when it carries the binary log header, renders it
+ *    to the text format the compiler used to write; text logs are copied
+ *    through unchanged. Output goes to stdout in file order.
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <phase.log> [more.log ...]\n";
+        std::cerr << "  Renders binary phase logs written by basic_compiler as text on stdout.\n";
+        return 2;
+    }
+    if (std::string first = argv[1]; first == "-h" || first == "--help") {
+        std::cerr << "Usage: " << argv[0] << " <phase.log> [more.log ...]\n";
+        return 0;
+    }
+    gwbasic::FileSink out(1);
+    for (int i = 1; i < argc; ++i) {
+        try {
+            const gwbasic::SourceBuffer log = gwbasic::SourceBuffer::mapFile(argv[i]);
+            if (gwbasic::logging::wire::isBinaryLog(log.text())) {
+                gwbasic::logging::wire::decodeLog(log.text(), out);
+            } else {
+                out << log.text();
+                out.flush();
+            }
+        } catch (const std::exception& ex) {
+            out.flush();
+            std::cerr << "Error: " << argv[i] << ": " << ex.what() << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "clang_path.h"
+#include "run_command.h"
+#include "tool_exists.h"
+
+using namespace gwbasic;
+using namespace e2e_helpers;
+/*
+ * Test Suite: E2E For Wide Bounds
+ * Purpose: Validate that FOR bounds built only from literals keep their
+ *          value when it exceeds the i32 range (unoptimized compile).
+ * Components Under Test: Full compiler pipeline; countedLoopStep, emitFor;
+ *          clang.
+ * Expected Behavior: The flexible bounds compute as Double, not in wrapped
+ *          i32 arithmetic, so the loop prints 3221028867 and 3221028868.
+ */
+TEST(E2E, ForWideBounds) {
+    if (!toolExists(CLANG_PATH)) {
+        GTEST_SKIP() << "clang not found (CLANG_PATH='" << CLANG_PATH << "'), skipping E2E.";
+    }
+    std::string src = R"(10 FOR J = 32767*32767*3 TO 32767*32767*3+1 : PRINT J : NEXT J
+20 END
+)";
+    std::string ir = Compiler::compileString(src);
+
+    std::filesystem::path tmp = std::filesystem::temp_directory_path() / "gwbasic_e2e_for_wide";
+    std::filesystem::create_directories(tmp);
+    std::filesystem::path ll = tmp / "program.ll";
+    std::filesystem::path bin = tmp / "program.out";
+    { std::ofstream f(ll); f << ir; }
+
+    std::ostringstream c1; c1 << CLANG_PATH << " \"" << ll.string() << "\" -o \"" << bin.string() << "\""; std::string cmd = c1.str();
+    int ec = std::system(cmd.c_str());
+    ASSERT_EQ(ec, 0) << "Clang failed: " << cmd;
+    std::ostringstream r1; r1 << '"' << bin.string() << '"'; std::string out = runCommand(r1.str());
+    EXPECT_EQ(out, "3221028867.000000\n3221028868.000000\n");
+}
@@ -0,0 +1,50 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "clang_path.h"
+#include "run_command.h"
+#include "tool_exists.h"
+
+using namespace gwbasic;
+using namespace e2e_helpers;
+/*
+ * Test Suite: E2E Gosub Recursive
+ * Purpose: Validate recursive GOSUB through the return-site stack
+ *          end-to-end.
+ * Components Under Test: Full compiler pipeline; GOSUB return stack; clang.
+ * Expected Behavior: The subroutine counts down 3, 2, 1 on the way in and
+ *          prints "back" once per unwound call before "done".
+ */
+TEST(E2E, GosubRecursive) {
+    if (!toolExists(CLANG_PATH)) {
+        GTEST_SKIP() << "clang not found (CLANG_PATH='" << CLANG_PATH << "'), skipping E2E.";
+    }
+    std::string src = R"(10 LET N = 3
+20 GOSUB 100
+30 PRINT "done"
+40 END
+100 IF N = 0 THEN 140
+110 PRINT N
+120 LET N = N - 1 : GOSUB 100
+130 PRINT "back"
+140 RETURN
+)";
+    std::string ir = Compiler::compileString(src);
+
+    std::filesystem::path tmp = std::filesystem::temp_directory_path() / "gwbasic_e2e_gosub_recursive";
+    std::filesystem::create_directories(tmp);
+    std::filesystem::path ll = tmp / "program.ll";
+    std::filesystem::path bin = tmp / "program.out";
+    { std::ofstream f(ll); f << ir; }
+
+    std::ostringstream c; c << CLANG_PATH << " \"" << ll.string() << "\" -o \"" << bin.string() << "\""; std::string cmd = c.str();
+    int ec = std::system(cmd.c_str());
+    ASSERT_EQ(ec, 0);
+    std::ostringstream r; r << '"' << bin.string() << '"'; std::string out = runCommand(r.str());
+    EXPECT_EQ(out, "3.000000\n2.000000\n1.000000\nback\nback\nback\ndone\n");
+}
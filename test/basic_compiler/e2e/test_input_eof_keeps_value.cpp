@@ -0,0 +1,50 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "clang_path.h"
+#include "run_with_input.h"
+#include "tool_exists.h"
+
+using namespace gwbasic;
+using namespace e2e_helpers;
+/*
+ * Test Suite: E2E Input EOF Keeps Value
+ * Purpose: Validate that an INPUT hitting end of input keeps the variable's
+ *          previous value at every optimization level.
+ * Components Under Test: Full compiler pipeline; scanf-based input;
+ *          Liveness (INPUT reads its variable); removeDeadStores; clang.
+ * Expected Behavior: With stdin "7" the second INPUT X fails and X keeps
+ *          the 6 assigned by LET X = Y, so -O0 and -O2 both print -63 and
+ *          -64; the optimizer must not drop LET X = Y as a dead store.
+ */
+TEST(E2E, InputEofKeepsValue) {
+    if (!toolExists(CLANG_PATH)) {
+        GTEST_SKIP() << "clang not found (CLANG_PATH='" << CLANG_PATH << "'), skipping E2E.";
+    }
+    std::string src = R"(5 Z = 0
+10 INPUT X
+20 PRINT X - 70
+30 Y = X - 1
+40 Z = Z + 1
+70 LET X = Y
+80 IF Z < 2 THEN 10
+90 END
+)";
+    std::filesystem::path tmp = std::filesystem::temp_directory_path() / "gwbasic_e2e_input_eof";
+    std::filesystem::create_directories(tmp);
+    auto run = [&](const std::string& ir, const char* stem) {
+        std::filesystem::path ll = tmp / (std::string(stem) + ".ll");
+        std::filesystem::path bin = tmp / (std::string(stem) + ".out");
+        { std::ofstream f(ll); f << ir; }
+        std::ostringstream c1; c1 << CLANG_PATH << " \"" << ll.string() << "\" -o \"" << bin.string() << "\""; std::string cmd = c1.str();
+        EXPECT_EQ(std::system(cmd.c_str()), 0) << "Clang failed: " << cmd;
+        return runCommandWithInput(bin.string(), "7\\n");
+    };
+    EXPECT_EQ(run(Compiler::compileString(src), "o0"), "-63.000000\n-64.000000\n");
+    EXPECT_EQ(run(Compiler::compileStringOptimized(src, OptLevel::O2), "o2"), "-63.000000\n-64.000000\n");
+}
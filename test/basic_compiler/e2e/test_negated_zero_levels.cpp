@@ -0,0 +1,50 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "clang_path.h"
+#include "run_command.h"
+#include "tool_exists.h"
+
+using namespace gwbasic;
+using namespace e2e_helpers;
+/*
+ * Test Suite: E2E Negated Zero Levels
+ * Purpose: Validate that a program evaluated at compile time (-O3) prints
+ *          a negated zero exactly as the unoptimized program computes it.
+ * Components Under Test: AstOptimizer::evaluate (unary '-'),
+ *          evaluateProgram; CodeGenerator unary minus; clang.
+ * Expected Behavior: -O0 and -O3 both print "0.000000" for -A, -B! and
+ *          -C% with zero operands, never "-0.000000".
+ */
+TEST(E2E, NegatedZeroMatchesAcrossLevels) {
+    if (!toolExists(CLANG_PATH)) {
+        GTEST_SKIP() << "clang not found (CLANG_PATH='" << CLANG_PATH << "'), skipping E2E.";
+    }
+    std::string src = R"(10 A = 0 : B! = 0 : C% = 0
+20 PRINT -A
+30 PRINT -B!
+40 PRINT -C%
+50 PRINT -(A * 5)
+60 END
+)";
+    std::filesystem::path tmp = std::filesystem::temp_directory_path() / "gwbasic_e2e_negzero";
+    std::filesystem::create_directories(tmp);
+    auto run = [&](const std::string& ir, const char* stem) {
+        std::filesystem::path ll = tmp / (std::string(stem) + ".ll");
+        std::filesystem::path bin = tmp / (std::string(stem) + ".out");
+        { std::ofstream f(ll); f << ir; }
+        std::ostringstream c1; c1 << CLANG_PATH << " \"" << ll.string() << "\" -o \"" << bin.string() << "\""; std::string cmd = c1.str();
+        EXPECT_EQ(std::system(cmd.c_str()), 0) << "Clang failed: " << cmd;
+        std::ostringstream r1; r1 << '"' << bin.string() << '"';
+        return runCommand(r1.str());
+    };
+    const std::string o0 = run(Compiler::compileString(src), "o0");
+    const std::string o3 = run(Compiler::compileStringOptimized(src, OptLevel::O3), "o3");
+    EXPECT_EQ(o0, "0.000000\n0.000000\n0.000000\n0.000000\n");
+    EXPECT_EQ(o3, o0);
+}
@@ -0,0 +1,61 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "clang_path.h"
+#include "run_command.h"
+#include "tool_exists.h"
+
+using namespace gwbasic;
+using namespace e2e_helpers;
+/*
+ * Test Suite: E2E Print Runtime
+ * Purpose: Validate the buffered output runtime end-to-end: numbers must
+ *          print exactly as printf("%f\n") would, and output larger than
+ *          the runtime's buffer must arrive complete and in order.
+ * Components Under Test: Full compiler pipeline; rt_print_num (exact path
+ *          and snprintf fallback), rt_print_line, rt_flush; clang.
+ * Expected Behavior: About 530 KB of output identical to the text built
+ *          here with snprintf, including values needing the sixth decimal
+ *          rounded, tiny negatives and a value beyond 2^63.
+ */
+TEST(E2E, PrintRuntimeMatchesPrintf) {
+    if (!toolExists(CLANG_PATH)) {
+        GTEST_SKIP() << "clang not found (CLANG_PATH='" << CLANG_PATH << "'), skipping E2E.";
+    }
+    std::string src = R"(10 FOR I = 1 TO 20000 : PRINT I / 7 : PRINT 0 - I / 3000000 : PRINT "line" : NEXT I
+20 X = 1000000.5
+30 PRINT X * X * X * X
+40 END
+)";
+    std::string ir = Compiler::compileString(src);
+
+    std::filesystem::path tmp = std::filesystem::temp_directory_path() / "gwbasic_e2e_print";
+    std::filesystem::create_directories(tmp);
+    std::filesystem::path ll = tmp / "program.ll";
+    std::filesystem::path bin = tmp / "program.out";
+    { std::ofstream f(ll); f << ir; }
+
+    std::ostringstream c1; c1 << CLANG_PATH << " \"" << ll.string() << "\" -o \"" << bin.string() << "\""; std::string cmd = c1.str();
+    int ec = std::system(cmd.c_str());
+    ASSERT_EQ(ec, 0) << "Clang failed: " << cmd;
+
+    std::string want;
+    char buf[400];
+    for (int i = 1; i <= 20000; ++i) {
+        std::snprintf(buf, sizeof(buf), "%f\n", i / 7.0); want += buf;
+        std::snprintf(buf, sizeof(buf), "%f\n", 0 - i / 3000000.0); want += buf;
+        want += "line\n";
+    }
+    const double x = 1000000.5;
+    std::snprintf(buf, sizeof(buf), "%f\n", x * x * x * x); want += buf;
+
+    std::ostringstream r1; r1 << '"' << bin.string() << '"'; std::string out = runCommand(r1.str());
+    ASSERT_EQ(out.size(), want.size());
+    EXPECT_TRUE(out == want);
+}
@@ -4,8 +4,10 @@
  *          and statements within a small program.
  * Components Under Test: Compiler::compileString end-to-end; CodeGenerator
  *          module/label emission.
- * Expected Behavior: IR defines main, labels for each BASIC line, and
- *          declares @.fmt_num and @.fmt_str.
+ * Expected Behavior: IR defines main, labels only the BASIC lines that
+ *          start a basic block (the first line and jump targets; the
+ *          straight-line run 20..40 joins line 10's block), and declares
+ *          calls the output runtime for both PRINTs.
  */
 #include <gtest/gtest.h>
 #include <string>
@@ -23,10 +25,12 @@ TEST(CodeGen, GeneratesIRWithBlocks) {
     std::string ir = Compiler::compileString(src);
     EXPECT_NE(ir.find("define i32 @main()"), std::string::npos);
     EXPECT_NE(ir.find("line10:"), std::string::npos);
-    EXPECT_NE(ir.find("line20:"), std::string::npos);
-    EXPECT_NE(ir.find("line30:"), std::string::npos);
-    EXPECT_NE(ir.find("line40:"), std::string::npos);
+    EXPECT_EQ(ir.find("line20:"), std::string::npos);
+    EXPECT_EQ(ir.find("line30:"), std::string::npos);
+    EXPECT_EQ(ir.find("line40:"), std::string::npos);
     EXPECT_NE(ir.find("line50:"), std::string::npos);
-    EXPECT_NE(ir.find("@.fmt_num"), std::string::npos);
-    EXPECT_NE(ir.find("@.fmt_str"), std::string::npos);
+    EXPECT_NE(ir.find("line30_cont1:"), std::string::npos);
+    EXPECT_EQ(ir.find("br label %line20"), std::string::npos);
+    EXPECT_NE(ir.find("call void @rt_print_num(double"), std::string::npos);
+    EXPECT_NE(ir.find("call void @rt_print_line(ptr @.str.0, i64 4)"), std::string::npos);
 }
@@ -0,0 +1,41 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: AST Arena
+ * Purpose: Verify the parser builds every node in the Program's arena, with
+ *          nodes of one kind stored contiguously in their per-kind pool and
+ *          identifier text owned by the arena (not the token stream).
+ * Components Under Test: AstArena, AstPool, Parser allocation paths.
+ * Expected Behavior: Pool sizes match the node counts of the source; pool
+ *          index order matches parse order; names survive token teardown.
+ */
+TEST(AstArena, ParserFillsPerKindPools) {
+    Program prog;
+    {
+        std::string src = "10 LET A = 1 + 2\n20 PRINT A * 3\n30 END\n";
+        Lexer lex(src);
+        Parser p(lex.tokenize());
+        prog = p.parseProgram();
+    } // tokens and source are gone; the AST must not reference them
+    AstArena& arena = *prog.arena;
+    EXPECT_EQ(arena.pool<AssignStmt>().size(), 1u);
+    EXPECT_EQ(arena.pool<PrintStmt>().size(), 1u);
+    EXPECT_EQ(arena.pool<EndStmt>().size(), 1u);
+    EXPECT_EQ(arena.pool<BinaryExpr>().size(), 2u);
+    EXPECT_EQ(arena.pool<NumberExpr>().size(), 3u);
+    EXPECT_EQ(arena.pool<VarExpr>().size(), 1u);
+    EXPECT_EQ(arena.pool<BinaryExpr>()[0].op, BinaryOp::Add);
+    EXPECT_EQ(arena.pool<BinaryExpr>()[1].op, BinaryOp::Mul);
+    ASSERT_EQ(prog.lines.size(), 3u);
+    auto* as = astCast<AssignStmt>(prog.lines[0].statements[0].get());
+    ASSERT_NE(as, nullptr);
+    EXPECT_EQ(as, &arena.pool<AssignStmt>()[0]);
+    EXPECT_EQ(as->name, "A");
+    EXPECT_GT(arena.bytesReserved(), 0u);
+}
@@ -0,0 +1,57 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/ast/Program.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: AST Symbol Interning
+ * Purpose: Verify the parser interns variable names and string literals so
+ *          every occurrence of a spelling carries the same dense SymbolId.
+ * Components Under Test: AstArena::intern, SymbolTable, Parser node
+ *          construction.
+ * Expected Behavior: Repeated names share an id and one arena copy; distinct
+ *          spellings get distinct ids; ids index the program's table.
+ */
+TEST(AstArena, InternsNamesAndLiterals) {
+    const std::string src =
+        "10 LET A = B + A\n"
+        "20 PRINT \"hi\"\n"
+        "30 FOR B = 1 TO 2 : PRINT \"hi\" : NEXT B\n"
+        "40 INPUT A\n";
+    Lexer lex(src);
+    Parser parser(lex);
+    auto [lines, arena] = parser.parseProgram();
+    ASSERT_EQ(lines.size(), 4u);
+
+    const auto* asg = astCast<AssignStmt>(lines[0].statements[0].get());
+    ASSERT_NE(asg, nullptr);
+    const auto* sum = astCast<BinaryExpr>(asg->value.get());
+    ASSERT_NE(sum, nullptr);
+    const auto* b = astCast<VarExpr>(sum->lhs.get());
+    const auto* a = astCast<VarExpr>(sum->rhs.get());
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_NE(asg->sym, kNoSymbol);
+    EXPECT_EQ(a->sym, asg->sym);
+    EXPECT_EQ(a->name.data(), asg->name.data());
+    EXPECT_NE(b->sym, asg->sym);
+
+    const auto* p1 = astCast<PrintStmt>(lines[1].statements[0].get());
+    const auto* fs = astCast<ForStmt>(lines[2].statements[0].get());
+    ASSERT_NE(p1, nullptr);
+    ASSERT_NE(fs, nullptr);
+    const auto* s1 = astCast<StringExpr>(p1->value.get());
+    const auto* s2 = astCast<StringExpr>(astCast<PrintStmt>(fs->body[0].get())->value.get());
+    ASSERT_NE(s1, nullptr);
+    ASSERT_NE(s2, nullptr);
+    EXPECT_EQ(s1->sym, s2->sym);
+    EXPECT_EQ(fs->varSym, b->sym);
+    EXPECT_EQ(astCast<InputStmt>(lines[3].statements[0].get())->sym, asg->sym);
+
+    EXPECT_EQ(arena->symbols().size(), 3u);
+    EXPECT_EQ(arena->symbols().name(asg->sym), "A");
+    EXPECT_EQ(arena->symbols().name(s1->sym), "hi");
+}
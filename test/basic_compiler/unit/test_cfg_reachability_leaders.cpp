@@ -0,0 +1,54 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/cfg/ControlFlowGraph.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Control Flow Graph
+ * Purpose: Verify the line CFG's dense index, reachability and basic-block
+ *          leaders on a program with jumps, a subroutine and dead lines.
+ * Components Under Test: ControlFlowGraph::build, indexOf.
+ * Expected Behavior: Lines are indexed in ascending order; lines after
+ *          GOTO/END that nothing targets are unreachable; the first line
+ *          and jump/GOSUB targets are leaders while fall-through lines are
+ *          not; blockCount counts leaders.
+ */
+TEST(ControlFlowGraph, ReachabilityAndLeaders) {
+    Lexer lx("10 LET A = 1\n"
+             "20 IF A > 0 THEN 50\n"
+             "30 GOSUB 100\n"
+             "40 GOTO 60\n"
+             "45 PRINT \"dead\"\n"
+             "50 PRINT A\n"
+             "60 END\n"
+             "70 PRINT \"dead too\"\n"
+             "100 PRINT \"sub\"\n"
+             "110 RETURN\n");
+    Parser ps(lx);
+    const Program prog = ps.parseProgram();
+    const ControlFlowGraph cfg(prog);
+
+    ASSERT_EQ(cfg.size(), 10u);
+    EXPECT_EQ(cfg.indexOf(10), 0);
+    EXPECT_EQ(cfg.indexOf(100), 8);
+    EXPECT_EQ(cfg.indexOf(15), ControlFlowGraph::kNone);
+    EXPECT_EQ(cfg.number(cfg.indexOf(60)), 60);
+
+    EXPECT_FALSE(cfg.reachable(cfg.indexOf(45)));
+    EXPECT_FALSE(cfg.reachable(cfg.indexOf(70)));
+    EXPECT_TRUE(cfg.reachable(cfg.indexOf(110)));
+    EXPECT_EQ(cfg.reachableCount(), 8u);
+
+    EXPECT_TRUE(cfg.isLeader(cfg.indexOf(10)));
+    EXPECT_FALSE(cfg.isLeader(cfg.indexOf(20)));
+    EXPECT_FALSE(cfg.isLeader(cfg.indexOf(40)));
+    EXPECT_TRUE(cfg.isLeader(cfg.indexOf(50)));
+    EXPECT_TRUE(cfg.isLeader(cfg.indexOf(60)));
+    EXPECT_TRUE(cfg.isLeader(cfg.indexOf(100)));
+    EXPECT_FALSE(cfg.isLeader(cfg.indexOf(110)));
+    EXPECT_FALSE(cfg.fallsThrough(cfg.indexOf(40)));
+    EXPECT_EQ(cfg.blockCount(), 4u);
+}
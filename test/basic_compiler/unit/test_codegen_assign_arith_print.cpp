@@ -12,7 +12,8 @@ using namespace gwbasic;
  *          and PRINT numeric path.
  * Components Under Test: CodeGenerator emitExpr, emitLineBlock; Compiler.
  * Expected Behavior: Presence of fmul/fadd/fdiv/fsub, fcmp+uitofp, and
- *          printf with @.fmt_num; variables allocated and zero-initialized.
+ *          rt_print_num; X lives in a register (no alloca, no
+ *          load) and PRINT X uses the value computed at line 10.
  */
 TEST(CodeGenCore, AssignAndArithmeticAndPrint) {
     const auto src =
@@ -25,15 +26,16 @@ TEST(CodeGenCore, AssignAndArithmeticAndPrint) {
         "70 END\n";
     std::string ir = Compiler::compileString(src);
     EXPECT_NE(ir.find("define i32 @main()"), std::string::npos);
-    EXPECT_NE(ir.find("%X = alloca double"), std::string::npos);
-    EXPECT_NE(ir.find("store double 0.0, ptr %X"), std::string::npos);
-    EXPECT_NE(ir.find(" = fmul double 2.0, 3.0"), std::string::npos);
-    EXPECT_NE(ir.find(" = fadd double"), std::string::npos);
+    EXPECT_EQ(ir.find("alloca double"), std::string::npos);
+    EXPECT_EQ(ir.find("load double"), std::string::npos);
+    EXPECT_NE(ir.find("  %t1 = fmul double 2.0, 3.0"), std::string::npos);
+    EXPECT_NE(ir.find("  %t2 = fadd double 1.0, %t1"), std::string::npos);
+    EXPECT_NE(ir.find("  call void @rt_print_num(double %t2)"), std::string::npos);
     EXPECT_NE(ir.find(" = fdiv double 4.0, 2.0"), std::string::npos);
     EXPECT_NE(ir.find(" = fsub double 0.0, %"), std::string::npos);
     EXPECT_NE(ir.find(" = fcmp olt double 1.0, 2.0"), std::string::npos);
     EXPECT_NE(ir.find(" = fcmp oeq double 2.0, 3.0"), std::string::npos);
     EXPECT_NE(ir.find(" = uitofp i1 %"), std::string::npos);
-    EXPECT_NE(ir.find("getelementptr inbounds i8, ptr @.fmt_num"), std::string::npos);
+    EXPECT_NE(ir.find("@.fmt_num"), std::string::npos); // rt_print_num's snprintf fallback
 }
 
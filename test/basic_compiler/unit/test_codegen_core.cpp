@@ -12,14 +12,16 @@ using namespace gwbasic;
  *          arithmetic, unary, comparisons, and PRINT (num/str).
  * Components Under Test: Compiler facade; CodeGenerator emitHeader,
  *          emitGlobals, emitMainPrologue/Epilogue, emitExpr, emitLineBlock.
- * Expected Behavior: IR contains declarations for printf/scanf, entry allocas
- *          and zero-inits for variables, correct fadd/fsub/fmul/fdiv,
- *          fcmp+uitofp for comparisons, and printf calls for numbers/strings.
+ * Expected Behavior: IR contains the scanf declaration, an entry block
+ *          and a return from main, correct fadd/fsub/fmul/fdiv, fcmp+uitofp
+ *          for comparisons, and runtime calls for numbers/strings. A program
+ *          without PRINT gets no output runtime and no flush at exit.
  */
 TEST(CodeGenCore, EmptyProgramHeaderAndExit) {
     std::string ir = Compiler::compileString("");
     EXPECT_NE(ir.find(";; Generated by gwbasic::CodeGenerator"), std::string::npos);
-    EXPECT_NE(ir.find("declare i32 @printf"), std::string::npos);
+    EXPECT_EQ(ir.find("@printf"), std::string::npos);
+    EXPECT_EQ(ir.find("@rt_"), std::string::npos);
     EXPECT_NE(ir.find("declare i32 @scanf"), std::string::npos);
     EXPECT_NE(ir.find("define i32 @main()"), std::string::npos);
     EXPECT_NE(ir.find("  ret i32 0\n}\n"), std::string::npos);
@@ -0,0 +1,27 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: CodeGen Double Literal Exponent
+ * Purpose: Validate that folded constants needing an exponent are written
+ *          as LLVM floating-point literals.
+ * Components Under Test: CodeGenerator::emitExpr (Double NumberExpr),
+ *          AstOptimizer folding.
+ * Expected Behavior: 1e19 and 1e-8 get a '.' in the mantissa ("1.0e+19",
+ *          "1.0e-08"); LLVM reads "1e+19" as an integer token and rejects it.
+ */
+TEST(CodeGenLiterals, FoldedExponentsKeepMantissaPoint) {
+    auto ir = Compiler::compileStringOptimized(
+        "10 PRINT 1000000*1000000*1000000*10\n"
+        "20 PRINT 1/100000000\n"
+        "30 LET A = 0.00000001\n"
+        "40 PRINT A\n"
+        "50 END\n");
+    EXPECT_NE(ir.find("@rt_print_num(double 1.0e+19)"), std::string::npos);
+    EXPECT_NE(ir.find("double 1.0e-08"), std::string::npos);
+    EXPECT_EQ(ir.find("double 1e"), std::string::npos);
+}
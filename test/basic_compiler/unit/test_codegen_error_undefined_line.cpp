@@ -0,0 +1,22 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: CodeGen Error (undefined line number)
+ * Purpose: Ensure GOTO to a line that does not exist is reported instead of
+ *          producing IR that branches to an undefined label.
+ * Components Under Test: CodeGenerator emitLineBlock, ControlFlowGraph.
+ * Expected Behavior: compileString throws CodeGenError naming the line.
+ */
+TEST(CodeGenErrors, GotoUndefinedLine) {
+    try {
+        (void)Compiler::compileString("10 GOTO 500\n20 END\n");
+        FAIL() << "expected CodeGenError";
+    } catch (const CodeGenError& e) {
+        EXPECT_NE(std::string(e.what()).find("Undefined line number 500"), std::string::npos);
+    }
+}
@@ -7,7 +7,6 @@
  *          a PrintStmt with a non-supported Expr type.
  */
 #include <gtest/gtest.h>
-#include <memory>
 #include "basic_compiler/codegen/CodeGenerator.h"
 #include "basic_compiler/ast/Program.h"
 
@@ -18,10 +17,11 @@ namespace { struct DummyExpr : Expr {}; }
 TEST(CodeGenErrors, UnknownExpressionKind) {
     Program p;
     Line l; l.number = 10;
-    auto ps = std::make_unique<PrintStmt>(std::make_unique<DummyExpr>());
+    auto ps = p.arena->make<PrintStmt>(p.arena->make<DummyExpr>());
     ps->pos = SourcePos{10, 1};
-    l.statements.push_back(std::move(ps));
-    p.lines.push_back(std::move(l));
+    const AstRef<Stmt> stmts[] = {ps};
+    l.statements = p.arena->makeList<Stmt>(stmts);
+    p.lines.push_back(l);
     CodeGenerator gen;
     EXPECT_THROW({ (void)gen.generate(p); }, CodeGenError);
 }
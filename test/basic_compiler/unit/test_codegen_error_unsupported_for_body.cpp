@@ -6,7 +6,6 @@
  * Expected Behavior: generate() throws CodeGenError.
  */
 #include <gtest/gtest.h>
-#include <memory>
 #include "basic_compiler/codegen/CodeGenerator.h"
 #include "basic_compiler/ast/Program.h"
 
@@ -17,16 +16,18 @@ namespace { struct DummyStmt : Stmt {}; }
 TEST(CodeGenErrors, UnsupportedStatementInForBody) {
     Program p;
     Line l; l.number = 10;
-    auto fs = std::make_unique<ForStmt>(
-        std::string("I"),
-        std::make_unique<NumberExpr>(1.0),
-        std::make_unique<NumberExpr>(3.0),
-        std::unique_ptr<Expr>{}
+    auto fs = p.arena->make<ForStmt>(
+        "I",
+        p.arena->make<NumberExpr>(1.0),
+        p.arena->make<NumberExpr>(3.0),
+        AstRef<Expr>{}
     );
     fs->pos = SourcePos{10, 1};
-    fs->body.emplace_back(std::make_unique<DummyStmt>());
-    l.statements.push_back(std::move(fs));
-    p.lines.push_back(std::move(l));
+    const AstRef<Stmt> body[] = {p.arena->make<DummyStmt>()};
+    fs->body = p.arena->makeList<Stmt>(body);
+    const AstRef<Stmt> stmts[] = {fs};
+    l.statements = p.arena->makeList<Stmt>(stmts);
+    p.lines.push_back(l);
     CodeGenerator gen;
     EXPECT_THROW({ (void)gen.generate(p); }, CodeGenError);
 }
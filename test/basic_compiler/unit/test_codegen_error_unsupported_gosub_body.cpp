@@ -7,7 +7,6 @@
  * Expected Behavior: generate() throws CodeGenError.
  */
 #include <gtest/gtest.h>
-#include <memory>
 #include "basic_compiler/codegen/CodeGenerator.h"
 #include "basic_compiler/ast/Program.h"
 
@@ -19,15 +18,17 @@ TEST(CodeGenErrors, UnsupportedStatementInGosubBody) {
     Program p;
     {
         Line l; l.number = 10;
-        auto gs = std::make_unique<GosubStmt>(100);
+        auto gs = p.arena->make<GosubStmt>(100);
         gs->pos = SourcePos{10, 1};
-        l.statements.push_back(std::move(gs));
-        p.lines.push_back(std::move(l));
+        const AstRef<Stmt> stmts[] = {gs};
+        l.statements = p.arena->makeList<Stmt>(stmts);
+        p.lines.push_back(l);
     }
     {
         Line l; l.number = 100;
-        l.statements.emplace_back(std::make_unique<DummyStmt>());
-        p.lines.push_back(std::move(l));
+        const AstRef<Stmt> stmts[] = {p.arena->make<DummyStmt>()};
+        l.statements = p.arena->makeList<Stmt>(stmts);
+        p.lines.push_back(l);
     }
     CodeGenerator gen;
     EXPECT_THROW({ (void)gen.generate(p); }, CodeGenError);
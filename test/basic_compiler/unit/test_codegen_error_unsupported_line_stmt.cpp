@@ -6,7 +6,6 @@
  * Expected Behavior: generate() throws CodeGenError.
  */
 #include <gtest/gtest.h>
-#include <memory>
 #include "basic_compiler/codegen/CodeGenerator.h"
 #include "basic_compiler/ast/Program.h"
 
@@ -17,8 +16,9 @@ namespace { struct DummyStmt : Stmt {}; }
 TEST(CodeGenErrors, UnsupportedStatementInLineBlock) {
     Program p;
     Line l; l.number = 10;
-    l.statements.emplace_back(std::make_unique<DummyStmt>());
-    p.lines.push_back(std::move(l));
+    const AstRef<Stmt> stmts[] = {p.arena->make<DummyStmt>()};
+    l.statements = p.arena->makeList<Stmt>(stmts);
+    p.lines.push_back(l);
     CodeGenerator gen;
     EXPECT_THROW({ (void)gen.generate(p); }, CodeGenError);
 }
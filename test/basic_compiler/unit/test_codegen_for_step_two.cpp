@@ -2,8 +2,10 @@
 /*
  * Test Suite: CodeGen Loop (STEP 2)
  * Purpose: Validate FOR with explicit STEP 2 emits increment code.
- * Components Under Test: CodeGenerator emitFor.
- * Expected Behavior: Presence of cond label and fadd increment using step.
+ * Components Under Test: CodeGenerator emitFor, emitCountedFor.
+ * Expected Behavior: Constant bounds give an i64 counted loop: the
+ *          preheader derives the stop value from the trip count (udiv by
+ *          the step) and the latch adds 2 to the induction variable.
  */
 #include <gtest/gtest.h>
 #include <string>
@@ -16,7 +18,8 @@ TEST(CodeGenLoopsInput, ForLoopWithStepTwo) {
         "10 FOR I = 1 TO 5 STEP 2: NEXT\n"
         "20 END\n";
     std::string ir = Compiler::compileString(src);
-    EXPECT_NE(ir.find("line10_for_cond1:"), std::string::npos);
-    EXPECT_NE(ir.find(" = fadd double %"), std::string::npos);
+    EXPECT_NE(ir.find("line10_for_pre1:"), std::string::npos);
+    EXPECT_NE(ir.find(" = udiv i64 %t2, 2"), std::string::npos);
+    EXPECT_NE(ir.find("%I.line10_for_inc1 = add nsw i64 %I.line10_for_body1, 2"), std::string::npos);
 }
 
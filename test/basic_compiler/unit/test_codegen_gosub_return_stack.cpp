@@ -0,0 +1,36 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: CodeGen Control Flow (GOSUB return stack)
+ * Purpose: Verify non-leaf subroutines are emitted once and reached through
+ *          the return-site stack, so recursive GOSUB compiles.
+ * Components Under Test: CodeGenerator emitGosub, emitReturnDispatch,
+ *          isTinyLeafSubroutine.
+ * Expected Behavior: Each GOSUB pushes a return-site id and branches to the
+ *          target line; RETURN branches to %gosub_return, whose switch lists
+ *          every continuation; the body is emitted exactly once.
+ */
+TEST(CodeGenFlow, GosubUsesReturnStack) {
+    const auto src =
+        "10 GOSUB 100\n"
+        "20 END\n"
+        "100 IF N > 3 THEN 130\n"
+        "110 LET N = N + 1\n"
+        "120 GOSUB 100\n"
+        "130 RETURN\n";
+    std::string ir = Compiler::compileString(src);
+    EXPECT_NE(ir.find("  %gosub.stack = alloca [1024 x i32]"), std::string::npos);
+    EXPECT_NE(ir.find("line10_gosub_push1:"), std::string::npos);
+    EXPECT_NE(ir.find("line120_gosub_push1:"), std::string::npos);
+    EXPECT_NE(ir.find("  br label %gosub_return"), std::string::npos);
+    EXPECT_NE(ir.find("    i32 1, label %line10_gosub_cont1\n    i32 2, label %line120_gosub_cont1\n"), std::string::npos);
+    EXPECT_EQ(ir.find("_gosub_entry"), std::string::npos);
+    const auto body = ir.find("fadd double");
+    ASSERT_NE(body, std::string::npos);
+    EXPECT_EQ(ir.find("fadd double", body + 1), std::string::npos);
+}
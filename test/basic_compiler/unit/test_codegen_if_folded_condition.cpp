@@ -0,0 +1,41 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/codegen/CodeGenerator.h"
+#include "basic_compiler/opt/PassManager.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: CodeGen IF Folded Condition
+ * Purpose: Validate that an IF whose comparison a pass folded to a literal
+ *          still compiles when the pass manager stops at its round limit
+ *          before simplify-stmts can remove the IF.
+ * Components Under Test: PassManager round limit, propagate-constants,
+ *          CodeGenerator::emitLineBlock (IF).
+ * Expected Behavior: After one round line 20's condition is the literal 0
+ *          (A = 0 reaches it); codegen branches on "i1 false" to the
+ *          fall-through instead of rejecting the condition.
+ */
+TEST(CodeGenIf, FoldedConditionAtRoundLimit) {
+    Lexer lex(
+        "10 A = 0\n"
+        "20 IF A = 1 THEN 40\n"
+        "30 PRINT 1\n"
+        "40 END\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    PassManager pm = PassManager::forLevel(OptLevel::O2);
+    pm.setMaxRounds(1);
+    const PassStats stats = pm.run(program);
+    EXPECT_EQ(stats.rounds, 1);
+    const auto* is = astCast<IfStmt>(program.lines[1].statements[0].get());
+    ASSERT_NE(is, nullptr);
+    ASSERT_NE(astCast<NumberExpr>(is->cond.get()), nullptr);
+    CodeGenerator gen;
+    std::string ir;
+    ASSERT_NO_THROW(ir = gen.generate(program));
+    EXPECT_NE(ir.find("br i1 false, label %"), std::string::npos);
+}
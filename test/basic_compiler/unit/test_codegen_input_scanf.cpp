@@ -2,7 +2,7 @@
 /*
  * Test Suite: CodeGen Input (scanf)
  * Purpose: Validate INPUT lowers to a scanf call with @.fmt_in.
- * Components Under Test: CodeGenerator emitLineBlock; ensureVarAllocated.
+ * Components Under Test: CodeGenerator emitLineBlock.
  * Expected Behavior: GEP on @.fmt_in and call to @scanf present in IR.
  */
 #include <gtest/gtest.h>
@@ -0,0 +1,52 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "basic_compiler/codegen/IrSink.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: CodeGen IR Sink
+ * Purpose: Verify streamed IR emission produces exactly the text of the
+ *          string-returning path, across buffer refills and fan-out.
+ * Components Under Test: CodeGenerator::generate(Program, IrSink&),
+ *          FileSink, StringSink, TeeSink, IrSink integer formatting.
+ * Expected Behavior: A module several times larger than the sink buffer is
+ *          byte-identical whether taken as a string, written to a file, or
+ *          teed into two sinks.
+ */
+TEST(CodeGenIrSink, StreamedOutputMatchesString) {
+    std::string src;
+    for (int ln = 10; ln <= 40000; ln += 10)
+        src += std::to_string(ln) + " LET A" + std::to_string(ln % 97) + " = A1 * 2 + " + std::to_string(ln) + "\n";
+    src += "40010 PRINT \"done\"\n40020 END\n";
+
+    const std::string expected = Compiler::compileString(src);
+    ASSERT_GT(expected.size(), 4 * IrSink::kBufferBytes);
+
+    const auto path = std::filesystem::temp_directory_path() / "gwbasic_test_ir_sink.ll";
+    StringSink copy;
+    {
+        FileSink file(path.string());
+        TeeSink tee({&file, &copy});
+        Lexer lex(src);
+        Parser parser(lex);
+        const Program program = parser.parseProgram();
+        CodeGenerator gen;
+        gen.generate(program, tee);
+    }
+    std::ifstream in(path, std::ios::binary);
+    const std::string written((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::filesystem::remove(path);
+    EXPECT_EQ(written, expected);
+    EXPECT_EQ(copy.take(), expected);
+
+    StringSink nums;
+    nums << -42 << ' ' << static_cast<size_t>(18446744073709551615ull) << ' ' << std::string_view("x");
+    EXPECT_EQ(nums.take(), "-42 18446744073709551615 x");
+}
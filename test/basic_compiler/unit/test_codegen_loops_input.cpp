@@ -9,10 +9,12 @@ using namespace gwbasic;
  * Test Suite: CodeGen Loops & Input
  * Purpose: Validate lowering of FOR/NEXT loops (default and explicit STEP)
  *          and INPUT statements using scanf format.
- * Components Under Test: CodeGenerator emitFor, emitLineBlock,
- *          ensureVarAllocated.
- * Expected Behavior: Loop emits cond/body/inc/end blocks with inclusive
- *          compare (ole) and fadd increment; INPUT uses @.fmt_in and scanf.
+ * Components Under Test: CodeGenerator emitFor, emitLineBlock.
+ * Expected Behavior: A constant-bound loop emits guard/pre/body/inc/end
+ *          blocks: an inclusive guard (sle), an i64 increment and an exit
+ *          test against the precomputed stop value, with the double
+ *          variable materialized in the body for PRINT; INPUT uses
+ *          @.fmt_in and scanf.
  */
 TEST(CodeGenLoopsInput, ForLoopDefaultStepLabelsAndOps) {
     const auto src =
@@ -20,12 +22,14 @@ TEST(CodeGenLoopsInput, ForLoopDefaultStepLabelsAndOps) {
         "20 END\n";
     std::string ir = Compiler::compileString(src);
     // Check loop blocks and operations
-    EXPECT_NE(ir.find("line10_for_cond1:"), std::string::npos);
+    EXPECT_NE(ir.find("line10_for_pre1:"), std::string::npos);
     EXPECT_NE(ir.find("line10_for_body1:"), std::string::npos);
     EXPECT_NE(ir.find("line10_for_inc1:"), std::string::npos);
     EXPECT_NE(ir.find("line10_for_end1:"), std::string::npos);
-    EXPECT_NE(ir.find(" = fcmp ole double"), std::string::npos); // inclusive end
-    EXPECT_NE(ir.find(" = fadd double"), std::string::npos);     // increment
+    EXPECT_NE(ir.find(" = icmp sle i64 1, 3"), std::string::npos);   // inclusive end
+    EXPECT_NE(ir.find(" = add nsw i64 %I.line10_for_body1, 1"), std::string::npos); // increment
+    EXPECT_NE(ir.find(" = icmp ne i64 %I.line10_for_inc1, %t2"), std::string::npos);
+    EXPECT_NE(ir.find(" = sitofp i64 %I.line10_for_body1 to double"), std::string::npos);
 }
 
 // Single-test-per-file policy: additional cases moved to dedicated files.
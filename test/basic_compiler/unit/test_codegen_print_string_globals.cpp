@@ -9,14 +9,15 @@ using namespace gwbasic;
  * Test Suite: CodeGen Core (print string)
  * Purpose: Validate IR for PRINT string path and global string emission.
  * Components Under Test: CodeGenerator emitGlobals, emitLineBlock.
- * Expected Behavior: @.fmt_str declaration, @.str.N global, and GEP to
- *          @.fmt_str in emitted IR.
+ * Expected Behavior: @.str.N global passed with its length to
+ *          rt_print_line; the runtime is emitted and main flushes at exit.
  */
 TEST(CodeGenCore, PrintStringAndGlobals) {
     const auto src = "10 PRINT \"Hello\"\n20 END\n";
     std::string ir = Compiler::compileString(src);
-    EXPECT_NE(ir.find("@.fmt_str = private unnamed_addr constant"), std::string::npos);
     EXPECT_NE(ir.find("@.str.0 = private unnamed_addr constant"), std::string::npos);
-    EXPECT_NE(ir.find("getelementptr inbounds i8, ptr @.fmt_str"), std::string::npos);
+    EXPECT_NE(ir.find("  call void @rt_print_line(ptr @.str.0, i64 5)"), std::string::npos);
+    EXPECT_NE(ir.find("define internal void @rt_print_line(ptr %s, i64 %n)"), std::string::npos);
+    EXPECT_NE(ir.find("exit:\n  call void @rt_flush()\n  ret i32 0"), std::string::npos);
 }
 
@@ -0,0 +1,44 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: CodeGen SSA
+ * Purpose: Validate that variables are kept in SSA registers: values meet in
+ *          phis at join lines and FOR headers instead of going through
+ *          stack slots.
+ * Components Under Test: CodeGenerator planJoins, emitJoin, edgeTo,
+ *          emitBackEdge, emitFor.
+ * Expected Behavior: No variable allocas, loads or stores; line 30 (a
+ *          back-edge target) joins I from line 10 and from the named
+ *          edge block of line 50; the FOR header carries the loop variable
+ *          and the accumulator; line 70, reached from both arms of the IF
+ *          with the same values, needs no phi.
+ */
+TEST(CodeGenSsa, PhisAtJoinsAndLoopHeaders) {
+    const auto src =
+        "10 LET I = 0\n"
+        "20 LET K = 5\n"
+        "30 LET I = I + 1\n"
+        "40 PRINT I\n"
+        "50 IF I < 3 THEN 30\n"
+        "60 IF I > 9 THEN 70\n"
+        "70 FOR J = 1 TO K: LET S = S + J: NEXT J\n"
+        "80 PRINT S\n"
+        "90 END\n";
+    std::string ir = Compiler::compileString(src);
+    EXPECT_EQ(ir.find("alloca double"), std::string::npos);
+    EXPECT_EQ(ir.find("load double"), std::string::npos);
+    EXPECT_EQ(ir.find("store double"), std::string::npos);
+    EXPECT_NE(ir.find("  %I.line30 = phi double [ 0.0, %line10 ], [ %I.line30_from50_0, %line30_from50_0 ]"), std::string::npos);
+    EXPECT_NE(ir.find("line30_from50_0:\n  %I.line30_from50_0 = bitcast double %t1 to double"), std::string::npos);
+    EXPECT_NE(ir.find("  %J.line70_for_cond1 = phi double [ 1.0, %line70 ], [ %J.line70_for_inc1, %line70_for_inc1 ]"), std::string::npos);
+    EXPECT_NE(ir.find("  %S.line70_for_cond1 = phi double [ %S.line30, %line70 ], [ %S.line70_for_inc1, %line70_for_inc1 ]"), std::string::npos);
+    EXPECT_NE(ir.find("fcmp ole double %J.line70_for_cond1, %K.line30"), std::string::npos);
+    EXPECT_EQ(ir.find("%I.line70 = phi"), std::string::npos);
+    EXPECT_NE(ir.find("double %S.line70_for_cond1)"), std::string::npos);
+}
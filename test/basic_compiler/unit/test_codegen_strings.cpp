@@ -12,7 +12,7 @@ using namespace gwbasic;
  * Components Under Test: CodeGenerator emitGlobals, escapeForIR,
  *          PRINT string lowering.
  * Expected Behavior: Presence of @.str.N constants with expected escapes,
- *          and GEP to @.fmt_str for string printing.
+ *          which rt_print_line receives for string printing.
  */
 TEST(CodeGenStrings, EscapesCommonCharactersInGlobals) {
     // Include tab, newline, quote and backslash: A\tB\nC\"\\D
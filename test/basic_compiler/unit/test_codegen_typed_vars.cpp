@@ -0,0 +1,45 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: CodeGen numeric types
+ * Purpose: Validate that Int and Single variables are lowered to narrow
+ *          machine types instead of double.
+ * Components Under Test: CodeGenerator emitExpr, emitConvert, emitFor,
+ *          emitComparison; Parser DEFINT handling.
+ * Expected Behavior: The DEFINT loop counter (with a Double end, so not a
+ *          counted loop) is an i16 phi stepped in i32;
+ *          the Single accumulator is a float phi updated with fadd float
+ *          after sitofp of the counter; '/' on a Single is float division
+ *          rounded into N% with llvm.rint; the IF compares in i32; PRINT
+ *          widens to double.
+ */
+TEST(CodeGenTypes, IntAndSingleVariables) {
+    const auto src =
+        "10 DEFINT I\n"
+        "20 S! = 0: N = 3\n"
+        "30 FOR I = 1 TO N: S! = S! + I: NEXT I\n"
+        "40 N% = S! / 4\n"
+        "50 IF N% > 1 THEN 70\n"
+        "60 PRINT N%\n"
+        "70 PRINT S! * 2\n";
+    std::string ir = Compiler::compileString(src);
+    EXPECT_NE(ir.find("declare float @llvm.rint.f32(float)"), std::string::npos);
+    EXPECT_NE(ir.find("%I$i.line30_for_cond1 = phi i16 [ 1, %line10 ]"), std::string::npos);
+    EXPECT_NE(ir.find("%S$s.line30_for_cond1 = phi float"), std::string::npos);
+    EXPECT_NE(ir.find("icmp sle i32 %t3, %t2"), std::string::npos);
+    EXPECT_NE(ir.find("sitofp i32 %t5 to float"), std::string::npos);
+    EXPECT_NE(ir.find("fadd float %S$s.line30_for_cond1, %t6"), std::string::npos);
+    EXPECT_NE(ir.find("%I$i.line30_for_inc1 = trunc i32 %t9 to i16"), std::string::npos);
+    EXPECT_NE(ir.find("fdiv float %S$s.line30_for_cond1, 0x4010000000000000"), std::string::npos);
+    EXPECT_NE(ir.find("call float @llvm.rint.f32(float %t10)"), std::string::npos);
+    EXPECT_NE(ir.find("icmp sgt i32 %t14, 1"), std::string::npos);
+    EXPECT_NE(ir.find("%t19 = fpext float %t18 to double"), std::string::npos);
+    EXPECT_NE(ir.find("call void @rt_print_num(double %t19)"), std::string::npos);
+    EXPECT_EQ(ir.find("phi double"), std::string::npos);
+}
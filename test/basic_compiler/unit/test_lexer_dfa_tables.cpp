@@ -0,0 +1,45 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <gtest/gtest.h>
+#include <string_view>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/LexTables.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Lexer DFA Tables
+ * Purpose: Verify the compile-time start table and operator DFA derived
+ *          from kOperators classify bytes and pick the longest spelling.
+ * Components Under Test: lex::kStart, lex::matchOperator, Lexer::next.
+ * Expected Behavior: Every spec row is recognised as itself; "<>=" splits
+ *          into NotEqual then Assign; non-ASCII and unused bytes are
+ *          Invalid and surface as LexError.
+ */
+TEST(Lexer, DfaTablesLongestMatch) {
+    for (const auto& op : lex::kOperators) {
+        const lex::OperatorSpec* m = lex::matchOperator(op.text.data(), op.text.data() + op.text.size());
+        ASSERT_NE(m, nullptr) << op.text;
+        EXPECT_EQ(m->type, op.type) << op.text;
+    }
+    constexpr std::string_view le = "<=5";
+    static_assert(lex::matchOperator(le.data(), le.data() + le.size())->type == TokenType::LessEqual);
+    constexpr std::string_view lt = "< =";
+    static_assert(lex::matchOperator(lt.data(), lt.data() + lt.size())->type == TokenType::Less);
+
+    EXPECT_EQ(lex::kStart['7'], lex::Start::Digit);
+    EXPECT_EQ(lex::kStart['q'], lex::Start::Letter);
+    EXPECT_EQ(lex::kStart['<'], lex::Start::Operator);
+    EXPECT_EQ(lex::kStart['!'], lex::Start::Invalid);
+    EXPECT_EQ(lex::kStart[0xC9], lex::Start::Invalid);
+
+    Lexer lex("10 IF A<>=B THEN 20\n");
+    const auto toks = lex.tokenize();
+    ASSERT_GE(toks.size(), 8u);
+    EXPECT_EQ(toks[3].type, TokenType::NotEqual);
+    EXPECT_EQ(toks[3].lexeme, "<>");
+    EXPECT_EQ(toks[3].col, 8);
+    EXPECT_EQ(toks[4].type, TokenType::Assign);
+    EXPECT_EQ(toks[4].col, 10);
+
+    Lexer bad("10 PRINT \xC9\n");
+    EXPECT_THROW(bad.tokenize(), LexError);
+}
@@ -0,0 +1,36 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/token/KeywordTable.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Lexer Keyword Table
+ * Purpose: Verify keywords are recognised in any letter case straight from
+ *          the source span, and that near-misses stay identifiers.
+ * Components Under Test: lookupKeyword, Lexer::identifierOrKeyword.
+ * Expected Behavior: Mixed-case keywords map to their token types with the
+ *          original spelling as lexeme; prefixes/extensions of keywords and
+ *          words longer than any keyword are identifiers; REM ends the line.
+ */
+TEST(Lexer, KeywordTableCaseInsensitive) {
+    EXPECT_EQ(lookupKeyword("return"), TokenType::KwReturn);
+    EXPECT_EQ(lookupKeyword("Input"), TokenType::KwInput);
+    EXPECT_EQ(lookupKeyword("GOT"), TokenType::Identifier);
+    EXPECT_EQ(lookupKeyword("GOTOX"), TokenType::Identifier);
+    EXPECT_EQ(lookupKeyword("RETURNING"), TokenType::Identifier);
+    EXPECT_EQ(lookupKeyword("T0"), TokenType::Identifier);
+
+    Lexer lex("10 for i = 1 To 3 sTeP 1 : next I : rem x = 1\n");
+    const auto toks = lex.tokenize();
+    ASSERT_GE(toks.size(), 14u);
+    EXPECT_EQ(toks[1].type, TokenType::KwFor);
+    EXPECT_EQ(toks[1].lexeme, "for");
+    EXPECT_EQ(toks[2].type, TokenType::Identifier);
+    EXPECT_EQ(toks[5].type, TokenType::KwTo);
+    EXPECT_EQ(toks[7].type, TokenType::KwStep);
+    EXPECT_EQ(toks[7].lexeme, "sTeP");
+    EXPECT_EQ(toks[10].type, TokenType::KwNext);
+    EXPECT_EQ(toks[12].type, TokenType::Colon);
+    EXPECT_EQ(toks[13].type, TokenType::NewLine);
+}
@@ -0,0 +1,65 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <gtest/gtest.h>
+#include <cctype>
+#include <string>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/lexer/Scan.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Lexer SIMD Scanning
+ * Purpose: Verify the block-wise run scanners agree with a byte-at-a-time
+ *          reference at every offset (block boundaries and scalar tails),
+ *          and that lazily derived line/column positions stay exact.
+ * Components Under Test: scanBlanks, scanDigits, scanIdentChars,
+ *          scanStringBody, scanLineEnd, countNewlines, Lexer::next.
+ * Expected Behavior: Scanners return the same stop position as the scalar
+ *          loop; tokens after long runs and a multi-line string carry the
+ *          correct line and column.
+ */
+TEST(Lexer, SimdScanMatchesScalarAndPositions) {
+    std::string buf;
+    for (int i = 0; i < 200; ++i) buf += "  \t\r9876543210Abc_zZ\x80[@`{\"\\\n"[i % 29];
+    const char* end = buf.data() + buf.size();
+    const auto ref = [&](size_t i, auto pred) { while (i < buf.size() && pred(static_cast<unsigned char>(buf[i]))) ++i; return i; };
+    for (size_t i = 0; i <= buf.size(); ++i) {
+        const char* p = buf.data() + i;
+        EXPECT_EQ(static_cast<size_t>(scanBlanks(p, end) - buf.data()),
+                  ref(i, [](unsigned char c) { return c == ' ' || c == '\t' || c == '\r'; })) << i;
+        EXPECT_EQ(static_cast<size_t>(scanDigits(p, end) - buf.data()),
+                  ref(i, [](unsigned char c) { return c >= '0' && c <= '9'; })) << i;
+        EXPECT_EQ(static_cast<size_t>(scanIdentChars(p, end) - buf.data()),
+                  ref(i, [](unsigned char c) { return std::isalnum(c) || c == '_'; })) << i;
+        EXPECT_EQ(static_cast<size_t>(scanStringBody(p, end) - buf.data()),
+                  ref(i, [](unsigned char c) { return c != '"' && c != '\\'; })) << i;
+        EXPECT_EQ(static_cast<size_t>(scanLineEnd(p, end) - buf.data()),
+                  ref(i, [](unsigned char c) { return c != '\n'; })) << i;
+        size_t nl = 0;
+        for (size_t j = i; j < buf.size(); ++j) nl += buf[j] == '\n';
+        EXPECT_EQ(countNewlines(p, end), nl) << i;
+    }
+
+    const std::string longName(70, 'Q');
+    const std::string src = "10 LET " + longName + " = 1234567890123456789012345678901234.5\n"
+                            "20 PRINT \"first\\\"\nsecond\nthird\" : X = 1 ' comment\n"
+                            "30 END\n";
+    Lexer lex(src);
+    const auto toks = lex.tokenize();
+    ASSERT_GE(toks.size(), 16u);
+    EXPECT_EQ(toks[2].lexeme, longName);
+    EXPECT_EQ(toks[3].col, 8 + 70 + 1);
+    EXPECT_EQ(toks[4].type, TokenType::Float);
+    EXPECT_EQ(toks[4].col, 8 + 70 + 3);
+    ASSERT_EQ(toks[8].type, TokenType::String);
+    EXPECT_EQ(toks[8].line, 2);
+    EXPECT_EQ(toks[8].col, 10);
+    EXPECT_EQ(toks[9].type, TokenType::Colon);
+    EXPECT_EQ(toks[9].line, 4);
+    EXPECT_EQ(toks[9].col, 8);
+    EXPECT_EQ(toks[10].line, 4);
+    EXPECT_EQ(toks[10].col, 10);
+    EXPECT_EQ(toks[13].type, TokenType::NewLine);
+    EXPECT_EQ(toks[14].lexeme, "30");
+    EXPECT_EQ(toks[14].line, 5);
+    EXPECT_EQ(toks[14].col, 1);
+}
@@ -0,0 +1,60 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "basic_compiler/log/LogFormat.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Log Binary Format
+ * Purpose: Verify binary phase logs decode to exactly the text logs and are
+ *          smaller on disk.
+ * Components Under Test: logging::Channel (Format::Binary), wire::decodeLog,
+ *          Compiler::compileStringWithPhaseLogs.
+ * Expected Behavior: For every phase, decodeLog(binary) == text log, and the
+ *          binary file set is smaller than the text one.
+ */
+TEST(LogBinaryFormat, DecodesToTextLogs) {
+    std::string src;
+    for (int ln = 10; ln <= 3000; ln += 10)
+        src += std::to_string(ln) + " LET TOTAL" + std::to_string(ln % 7) + " = TOTAL1 * -2 + " + std::to_string(ln) + ".5\n";
+    src += "3010 PRINT \"tab\\there \\\"q\\\"\"\n3020 FOR I = 1 TO 3: PRINT I: NEXT I\n3030 END\n";
+
+    const auto dir = std::filesystem::temp_directory_path();
+    const char* phases[] = {".lex.log", ".syntax.log", ".semantic.log", ".codegen.log"};
+    auto compileWith = [&](const std::string& base, logging::Format f) {
+        return Compiler::compileStringWithPhaseLogs(src, base + phases[0], base + phases[1], base + phases[2],
+                                                    base + phases[3], f);
+    };
+    const std::string textBase = (dir / "gwbasic_test_fmt_text").string();
+    const std::string binBase = (dir / "gwbasic_test_fmt_bin").string();
+    EXPECT_EQ(compileWith(textBase, logging::Format::Text), compileWith(binBase, logging::Format::Binary));
+
+    auto slurp = [](const std::string& p) {
+        std::ifstream in(p, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    };
+    size_t textBytes = 0, binBytes = 0;
+    for (const char* ext : phases) {
+        const std::string text = slurp(textBase + ext);
+        const std::string bin = slurp(binBase + ext);
+        ASSERT_TRUE(logging::wire::isBinaryLog(bin)) << ext;
+        EXPECT_FALSE(text.empty()) << ext;
+        StringSink decoded;
+        logging::wire::decodeLog(bin, decoded);
+        EXPECT_EQ(decoded.take(), text) << ext;
+        textBytes += text.size();
+        binBytes += bin.size();
+        std::filesystem::remove(textBase + ext);
+        std::filesystem::remove(binBase + ext);
+    }
+    EXPECT_LT(binBytes * 2, textBytes);
+
+    StringSink sink;
+    const std::string undefinedSite = std::string(logging::wire::kMagic, sizeof(logging::wire::kMagic)) + "\x05";
+    EXPECT_THROW(logging::wire::decodeLog(undefinedSite, sink), std::runtime_error);
+}
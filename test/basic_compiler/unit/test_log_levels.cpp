@@ -0,0 +1,56 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "basic_compiler/Compiler.h"
+#include "basic_compiler/log/Log.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Log Levels
+ * Purpose: Verify phase-log records are filtered by level and that message
+ *          fragments are only evaluated for records that are written.
+ * Components Under Test: logging::Channel, GWBASIC_LOG, CodeGenerator
+ *          codegen log levels.
+ * Expected Behavior: Below-threshold records neither appear nor evaluate
+ *          their arguments; a Debug codegen log keeps per-line records and
+ *          drops per-instruction (Trace) ones.
+ */
+TEST(LogLevels, ThresholdFiltersAndDefersFormatting) {
+    const auto dir = std::filesystem::temp_directory_path();
+    const auto chanPath = dir / "gwbasic_test_log_levels.log";
+    int evaluated = 0;
+    auto part = [&evaluated] { ++evaluated; return 7; };
+    {
+        logging::Channel ch;
+        GWBASIC_LOG(ch, Error, "closed ", part());
+        ASSERT_TRUE(ch.open(chanPath.string(), logging::Level::Debug));
+        GWBASIC_LOG(ch, Trace, "trace ", part());
+        GWBASIC_LOG(ch, Debug, "debug ", part(), ' ', std::string("s"), ' ', 2.5);
+    }
+    EXPECT_EQ(evaluated, 1);
+    std::ifstream in(chanPath);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    EXPECT_EQ(text, "debug 7 s 2.5\n");
+
+    const auto cgPath = dir / "gwbasic_test_log_levels.codegen.log";
+    Lexer lex("10 LET A = 1 + 2\n20 END\n");
+    Parser parser(lex);
+    const Program program = parser.parseProgram();
+    {
+        CodeGenerator gen;
+        gen.setLogPath(cgPath.string(), logging::Level::Debug);
+        gen.generate(program);
+    }
+    in.open(cgPath);
+    text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    in.close();
+    EXPECT_NE(text.find("begin line 10\n"), std::string::npos);
+    EXPECT_EQ(text.find(" -> "), std::string::npos);
+    std::filesystem::remove(chanPath);
+    std::filesystem::remove(cgPath);
+}
@@ -0,0 +1,61 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Close Recurrences
+ * Purpose: Validate that FOR loops updating variables by recurrences are
+ *          replaced by their final values, and that inexact ones stay.
+ * Components Under Test: AstOptimizer::closeRecurrences (closeLoop,
+ *          evaluate, constantAt).
+ * Expected Behavior: Line 20 runs a known number of times from known
+ *          values and becomes S% = 55, P = 1024, I = 11. Line 30 has a
+ *          runtime trip count; the Int sum becomes C% = C% + n * 3 and
+ *          J% = 1 + n. Line 40 multiplies an INPUT value by 1.5, which
+ *          rounds at every step, so the loop stays. A second run finds
+ *          nothing.
+ */
+TEST(OptimizerRecurrences, ClosesCountedLoops) {
+    Lexer lex(
+        "10 S% = 0: P = 1: INPUT N%: INPUT Z\n"
+        "20 FOR I = 1 TO 10: S% = S% + I: P = P * 2: NEXT I\n"
+        "30 FOR J% = 1 TO N%: C% = C% + 3: NEXT J%\n"
+        "40 FOR K = 1 TO 10: Z = Z * 1.5: NEXT K\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    ASSERT_TRUE(AstOptimizer::closeRecurrences(program));
+
+    const auto& line20 = program.lines[1].statements;
+    ASSERT_EQ(line20.size(), 3u);
+    const char* names[] = {"S%", "P", "I"};
+    const double values[] = {55.0, 1024.0, 11.0};
+    for (std::size_t i = 0; i < 3; ++i) {
+        const auto* asg = astCast<AssignStmt>(line20[i].get());
+        ASSERT_NE(asg, nullptr);
+        EXPECT_EQ(asg->name, names[i]);
+        const auto* n = astCast<NumberExpr>(asg->value.get());
+        ASSERT_NE(n, nullptr);
+        EXPECT_DOUBLE_EQ(n->value, values[i]);
+    }
+
+    const auto& line30 = program.lines[2].statements;
+    ASSERT_EQ(line30.size(), 2u);
+    const auto* sum = astCast<AssignStmt>(line30[0].get());
+    ASSERT_NE(sum, nullptr);
+    EXPECT_EQ(sum->name, "C%");
+    const auto* add = astCast<BinaryExpr>(sum->value.get());
+    ASSERT_NE(add, nullptr);
+    EXPECT_EQ(add->op, BinaryOp::Add);
+    EXPECT_EQ(add->type, NumType::Int);
+    const auto* exit = astCast<AssignStmt>(line30[1].get());
+    ASSERT_NE(exit, nullptr);
+    EXPECT_EQ(exit->name, "J%");
+
+    EXPECT_NE(astCast<ForStmt>(program.lines[3].statements[0].get()), nullptr);
+    EXPECT_FALSE(AstOptimizer::closeRecurrences(program));
+}
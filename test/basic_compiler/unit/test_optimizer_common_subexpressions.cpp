@@ -0,0 +1,54 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Common Subexpressions
+ * Purpose: Validate local value numbering: repeated Single/Double
+ *          operations in a block are computed once, Int ones are not, and
+ *          nothing is reused across an assignment to an operand.
+ * Components Under Test: AstOptimizer::eliminateCommonSubexpressions.
+ * Expected Behavior: P = X * Y is reused by line 30 as P; X * Y + 1 in
+ *          PRINT and Q is moved into cse$1, assigned in front of the PRINT;
+ *          the Int products stay; after X changes, line 50 computes X * Y
+ *          again. A second run finds nothing.
+ */
+TEST(OptimizerCse, ReusesValuesWithinBlock) {
+    Lexer lex(
+        "10 INPUT X: INPUT Y: INPUT K%\n"
+        "20 P = X * Y: PRINT X * Y + 1\n"
+        "30 Q = X * Y + 1: R% = K% * 2: S% = K% * 2\n"
+        "40 X = X + 1\n"
+        "50 PRINT X * Y\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    ASSERT_TRUE(AstOptimizer::eliminateCommonSubexpressions(program));
+
+    const auto& line20 = program.lines[1].statements;
+    ASSERT_EQ(line20.size(), 3u);
+    const auto* temp = astCast<AssignStmt>(line20[1].get());
+    ASSERT_NE(temp, nullptr);
+    EXPECT_EQ(temp->name, "cse$1");
+    const auto* tempValue = astCast<BinaryExpr>(temp->value.get());
+    ASSERT_NE(tempValue, nullptr);
+    const auto* reused = astCast<VarExpr>(tempValue->lhs.get());
+    ASSERT_NE(reused, nullptr);
+    EXPECT_EQ(reused->name, "P");
+    const auto* pr = astCast<VarExpr>(astCast<PrintStmt>(line20[2].get())->value.get());
+    ASSERT_NE(pr, nullptr);
+    EXPECT_EQ(pr->name, "cse$1");
+
+    const auto& line30 = program.lines[2].statements;
+    const auto* q = astCast<VarExpr>(astCast<AssignStmt>(line30[0].get())->value.get());
+    ASSERT_NE(q, nullptr);
+    EXPECT_EQ(q->name, "cse$1");
+    EXPECT_NE(astCast<BinaryExpr>(astCast<AssignStmt>(line30[2].get())->value.get()), nullptr);
+    EXPECT_NE(astCast<BinaryExpr>(astCast<PrintStmt>(program.lines[4].statements[0].get())->value.get()), nullptr);
+
+    EXPECT_FALSE(AstOptimizer::eliminateCommonSubexpressions(program));
+}
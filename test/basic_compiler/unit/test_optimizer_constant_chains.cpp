@@ -0,0 +1,36 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Constant Chains
+ * Purpose: Validate that constant propagation settles a chain of
+ *          assignments in one run instead of one link per round.
+ * Components Under Test: AstOptimizer::propagateConstants
+ *          (ReachingDefinitions Joins, solveConstants).
+ * Expected Behavior: Both paths into line 40 store 2 in A, so the Join
+ *          there is constant; B = 6 and C = 7 follow in the same call, and
+ *          PRINT C prints the literal 7. A second call finds nothing left.
+ */
+TEST(OptimizerConstantChains, SettlesChainInOneRun) {
+    Lexer lex(
+        "10 A = 2: INPUT X\n"
+        "20 IF X > 0 THEN 40\n"
+        "30 A = 2\n"
+        "40 B = A * 3\n"
+        "50 C = B + 1\n"
+        "60 PRINT C\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+
+    ASSERT_TRUE(AstOptimizer::propagateConstants(program));
+    const auto* printed = astCast<NumberExpr>(astCast<PrintStmt>(program.lines[5].statements[0].get())->value.get());
+    ASSERT_NE(printed, nullptr);
+    EXPECT_DOUBLE_EQ(printed->value, 7.0);
+    EXPECT_FALSE(AstOptimizer::propagateConstants(program));
+}
@@ -0,0 +1,55 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Dataflow Propagation
+ * Purpose: Validate constant and copy propagation across lines and the
+ *          removal of the stores they leave dead.
+ * Components Under Test: AstOptimizer::propagateConstants,
+ *          propagateCopies, removeDeadStores (ReachingDefinitions,
+ *          AvailableCopies, Liveness).
+ * Expected Behavior: C = A * 3 folds to 6, which the same walk carries
+ *          into line 50; A stays a read there because both A = 2 and
+ *          A = 5 reach it. PRINT D reads B through the copy. Both
+ *          assignments of line 20 are then dead and removed; A = 2 and
+ *          A = 5 stay.
+ */
+TEST(OptimizerDataflow, PropagatesConstantsAndCopies) {
+    Lexer lex(
+        "10 A = 2: INPUT B\n"
+        "20 C = A * 3: D = B\n"
+        "30 IF B > 0 THEN 50\n"
+        "40 A = 5\n"
+        "50 PRINT A + C: PRINT D\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+
+    ASSERT_TRUE(AstOptimizer::propagateConstants(program));
+    const auto* c = astCast<NumberExpr>(astCast<AssignStmt>(program.lines[1].statements[0].get())->value.get());
+    ASSERT_NE(c, nullptr);
+    EXPECT_DOUBLE_EQ(c->value, 6.0);
+    const auto* sum = astCast<BinaryExpr>(astCast<PrintStmt>(program.lines[4].statements[0].get())->value.get());
+    ASSERT_NE(sum, nullptr);
+    EXPECT_NE(astCast<VarExpr>(sum->lhs.get()), nullptr);
+    const auto* carried = astCast<NumberExpr>(sum->rhs.get());
+    ASSERT_NE(carried, nullptr);
+    EXPECT_DOUBLE_EQ(carried->value, 6.0);
+    EXPECT_FALSE(AstOptimizer::propagateConstants(program));
+
+    ASSERT_TRUE(AstOptimizer::propagateCopies(program));
+    const auto* d = astCast<VarExpr>(astCast<PrintStmt>(program.lines[4].statements[1].get())->value.get());
+    ASSERT_NE(d, nullptr);
+    EXPECT_EQ(d->name, "B");
+
+    ASSERT_TRUE(AstOptimizer::removeDeadStores(program));
+    EXPECT_TRUE(program.lines[1].statements.empty());
+    EXPECT_EQ(program.lines[0].statements.size(), 2u);
+    EXPECT_EQ(program.lines[3].statements.size(), 1u);
+    EXPECT_FALSE(AstOptimizer::removeDeadStores(program));
+}
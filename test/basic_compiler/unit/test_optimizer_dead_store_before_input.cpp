@@ -0,0 +1,32 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Dead Store Before Input
+ * Purpose: Validate that INPUT counts as a read of its variable.
+ * Components Under Test: Liveness::transfer (INPUT), removeDeadStores.
+ * Expected Behavior: X = Y reaches INPUT X through the loop back edge; a
+ *          failed read keeps that value, so the store stays. W = 1, which
+ *          nothing reads, is still removed.
+ */
+TEST(OptimizerDataflow, StoreBeforeInputStaysLive) {
+    Lexer lex(
+        "10 INPUT X\n"
+        "20 PRINT X\n"
+        "30 Y = X - 1\n"
+        "40 W = 1\n"
+        "70 X = Y\n"
+        "80 IF Y > 0 THEN 10\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    ASSERT_TRUE(AstOptimizer::removeDeadStores(program));
+    EXPECT_TRUE(program.lines[3].statements.empty());
+    ASSERT_EQ(program.lines[4].statements.size(), 1u);
+    EXPECT_NE(astCast<AssignStmt>(program.lines[4].statements[0].get()), nullptr);
+}
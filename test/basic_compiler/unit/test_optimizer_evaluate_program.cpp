@@ -0,0 +1,72 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Evaluate Program
+ * Purpose: Validate compile-time execution of programs that need no input.
+ * Components Under Test: AstOptimizer::evaluateProgram.
+ * Expected Behavior: A program without INPUT (FOR loop, GOSUB, IF) becomes
+ *          one line printing its whole output as text, then END. A program
+ *          that reaches INPUT gets a prelude line 9 that prints the output
+ *          so far, restores the variables and jumps back to the INPUT line.
+ *          A second run changes nothing.
+ */
+TEST(OptimizerEvaluate, PrecomputesOutput) {
+    Lexer lex(
+        "10 S% = 0\n"
+        "20 FOR I = 1 TO 3: S% = S% + I: PRINT S%: NEXT I\n"
+        "30 GOSUB 100\n"
+        "40 IF S% < 10 THEN 60\n"
+        "50 PRINT \"big\"\n"
+        "60 END\n"
+        "100 PRINT I * 0.5\n"
+        "110 RETURN\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    ASSERT_TRUE(AstOptimizer::evaluateProgram(program, 1000));
+    ASSERT_EQ(program.lines.size(), 1u);
+    EXPECT_EQ(program.lines[0].number, 10);
+    const auto& only = program.lines[0].statements;
+    ASSERT_EQ(only.size(), 2u);
+    const auto* text = astCast<PrintStmt>(only[0].get());
+    ASSERT_NE(text, nullptr);
+    EXPECT_FALSE(text->newline);
+    const auto* str = astCast<StringExpr>(text->value.get());
+    ASSERT_NE(str, nullptr);
+    EXPECT_EQ(str->value, "1.000000\n3.000000\n6.000000\n2.000000\n");
+    EXPECT_NE(astCast<EndStmt>(only[1].get()), nullptr);
+    EXPECT_FALSE(AstOptimizer::evaluateProgram(program, 1000));
+
+    Lexer lex2(
+        "10 X = 2: Y% = 7\n"
+        "20 PRINT X * Y%\n"
+        "30 INPUT Z\n"
+        "40 PRINT Z + X\n");
+    Parser parser2(lex2);
+    auto prefix = parser2.parseProgram();
+    ASSERT_TRUE(AstOptimizer::evaluateProgram(prefix, 1000));
+    ASSERT_EQ(prefix.lines.size(), 5u);
+    EXPECT_EQ(prefix.lines[0].number, 9);
+    const auto& head = prefix.lines[0].statements;
+    ASSERT_EQ(head.size(), 4u);
+    const auto* out = astCast<StringExpr>(astCast<PrintStmt>(head[0].get())->value.get());
+    ASSERT_NE(out, nullptr);
+    EXPECT_EQ(out->value, "14.000000\n");
+    const auto* x = astCast<AssignStmt>(head[1].get());
+    const auto* y = astCast<AssignStmt>(head[2].get());
+    ASSERT_NE(x, nullptr);
+    ASSERT_NE(y, nullptr);
+    EXPECT_EQ(x->name, "X");
+    EXPECT_EQ(y->name, "Y%");
+    EXPECT_EQ(y->value->type, NumType::Int);
+    const auto* jump = astCast<GotoStmt>(head[3].get());
+    ASSERT_NE(jump, nullptr);
+    EXPECT_EQ(jump->targetLine, 30);
+    EXPECT_FALSE(AstOptimizer::evaluateProgram(prefix, 1000));
+}
@@ -18,6 +18,6 @@ TEST(OptimizerIf, ConstantFalseRemoved) {
         "30 END\n";
     auto ir = Compiler::compileStringOptimized(src);
     EXPECT_EQ(ir.find("line100"), std::string::npos);
-    EXPECT_NE(ir.find(", double 5.0)"), std::string::npos);
+    EXPECT_NE(ir.find("@rt_print_num(double 5.0)"), std::string::npos);
 }
 
@@ -0,0 +1,46 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Loop Invariants
+ * Purpose: Validate that expressions independent of the loop variable and
+ *          of every variable the body assigns move in front of the FOR.
+ * Components Under Test: AstOptimizer::hoistLoopInvariants.
+ * Expected Behavior: A * B and A / B become inv$1/inv$2 assignments ahead
+ *          of the FOR in line 20; S + ... + I and N + 1 stay in the body;
+ *          a second run finds nothing left to hoist.
+ */
+TEST(OptimizerLoop, HoistsInvariantsBeforeFor) {
+    Lexer lex(
+        "10 INPUT A: INPUT B\n"
+        "20 FOR I = 1 TO 5: S = S + A * B + I: N = N + 1: PRINT A / B: NEXT I\n"
+        "30 PRINT S\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    ASSERT_TRUE(AstOptimizer::hoistLoopInvariants(program));
+
+    const auto& stmts = program.lines[1].statements;
+    ASSERT_EQ(stmts.size(), 3u);
+    const auto* first = astCast<AssignStmt>(stmts[0].get());
+    const auto* second = astCast<AssignStmt>(stmts[1].get());
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(first->name, "inv$1");
+    EXPECT_EQ(second->name, "inv$2");
+    const auto* fs = astCast<ForStmt>(stmts[2].get());
+    ASSERT_NE(fs, nullptr);
+    const auto* pr = astCast<PrintStmt>(fs->body[2].get());
+    ASSERT_NE(pr, nullptr);
+    const auto* read = astCast<VarExpr>(pr->value.get());
+    ASSERT_NE(read, nullptr);
+    EXPECT_EQ(read->name, "inv$2");
+    EXPECT_NE(astCast<BinaryExpr>(astCast<AssignStmt>(fs->body[1].get())->value.get()), nullptr);
+
+    EXPECT_FALSE(AstOptimizer::hoistLoopInvariants(program));
+}
@@ -0,0 +1,23 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Negate Zero
+ * Purpose: Validate that folding unary minus keeps the sign codegen gives.
+ * Components Under Test: AstOptimizer::optExpr (unary '-').
+ * Expected Behavior: -A with A = 0 and -(0) fold to +0.0, as the
+ *          unoptimized "fsub double 0.0, x" computes, never to -0.0.
+ */
+TEST(OptimizerExpr, NegatedZeroStaysPositive) {
+    auto ir = Compiler::compileStringOptimized(
+        "10 LET A = 0\n"
+        "20 PRINT -A\n"
+        "30 PRINT -(0)\n"
+        "40 END\n");
+    EXPECT_NE(ir.find("@rt_print_num(double 0.0)"), std::string::npos);
+    EXPECT_EQ(ir.find("-0.0"), std::string::npos);
+}
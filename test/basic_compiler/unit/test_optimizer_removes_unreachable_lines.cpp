@@ -0,0 +1,25 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Compiler.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Optimizer Dead Lines
+ * Purpose: Verify lines cut off by IF folding are removed from the program.
+ * Components Under Test: AstOptimizer::optimize, ControlFlowGraph.
+ * Expected Behavior: After IF 1 THEN 100 becomes GOTO 100, line 20 is
+ *          unreachable: its string literal is neither declared nor printed.
+ */
+TEST(OptimizerDeadLines, FoldedIfRemovesSkippedLine) {
+    const char* src =
+        "10 IF 1 THEN 100\n"
+        "20 PRINT \"skipped\"\n"
+        "100 PRINT \"kept\"\n"
+        "110 END\n";
+    auto ir = Compiler::compileStringOptimized(src);
+    EXPECT_EQ(ir.find("skipped"), std::string::npos);
+    EXPECT_NE(ir.find("kept"), std::string::npos);
+    EXPECT_EQ(ir.find("line20"), std::string::npos);
+}
@@ -0,0 +1,42 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Shared Analysis
+ * Purpose: Validate that constant propagation and recurrence closing
+ *          share one analysis while only expressions change, and that a
+ *          changed statement list gets a fresh one.
+ * Components Under Test: AstOptimizer::analyze (AstArena::analyses),
+ *          propagateConstants, closeRecurrences.
+ * Expected Behavior: propagateConstants folds N into the FOR limit and
+ *          leaves its analysis in the arena; closeRecurrences uses that
+ *          same analysis and replaces the loop with S = 55, I = 11. The
+ *          next propagateConstants sees the new statements, rebuilds, and
+ *          carries S = 55 into the PRINT.
+ */
+TEST(OptimizerSharedAnalysis, ReusesUntilStatementsChange) {
+    Lexer lex(
+        "10 N = 10\n"
+        "20 FOR I = 1 TO N: S = S + I: NEXT I\n"
+        "30 PRINT S\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+
+    ASSERT_TRUE(AstOptimizer::propagateConstants(program));
+    const auto* shared = program.arena->analyses().get();
+    ASSERT_NE(shared, nullptr);
+    ASSERT_TRUE(AstOptimizer::closeRecurrences(program));
+    EXPECT_EQ(program.arena->analyses().get(), shared);
+
+    ASSERT_TRUE(AstOptimizer::propagateConstants(program));
+    EXPECT_NE(program.arena->analyses().get(), shared);
+    const auto* printed = astCast<NumberExpr>(astCast<PrintStmt>(program.lines[2].statements[0].get())->value.get());
+    ASSERT_NE(printed, nullptr);
+    EXPECT_DOUBLE_EQ(printed->value, 55.0);
+}
@@ -0,0 +1,87 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+#include "basic_compiler/opt/PassManager.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Specialize Inputs
+ * Purpose: Validate compiling a program for known INPUT values.
+ * Components Under Test: parseSpecialization, AstOptimizer::specializeInputs,
+ *          PassManager::forLevel with specializations.
+ * Expected Behavior: "VAR=value" parses to the canonical name ('#'
+ *          dropped); malformed text is rejected. INPUT N becomes a
+ *          non-flexible Double literal assigned to N; a bare "K" covers the
+ *          K% DEFINT made; other INPUTs stay. At -O0 the pipeline runs only
+ *          specialize-inputs; at -O2 the IF on N folds away.
+ */
+TEST(OptimizerSpecialize, InputsBecomeConstants) {
+    Specialization s;
+    ASSERT_TRUE(parseSpecialization("N=100", s));
+    EXPECT_EQ(s.name, "N");
+    EXPECT_EQ(s.value, 100.0);
+    ASSERT_TRUE(parseSpecialization("X1#=-2.5", s));
+    EXPECT_EQ(s.name, "X1");
+    EXPECT_EQ(s.value, -2.5);
+    ASSERT_TRUE(parseSpecialization("K%=3", s));
+    EXPECT_EQ(s.name, "K%");
+    EXPECT_FALSE(parseSpecialization("N", s));
+    EXPECT_FALSE(parseSpecialization("=1", s));
+    EXPECT_FALSE(parseSpecialization("1N=1", s));
+    EXPECT_FALSE(parseSpecialization("N=", s));
+    EXPECT_FALSE(parseSpecialization("N=1x", s));
+
+    const char* src =
+        "5 DEFINT K\n"
+        "10 INPUT N\n"
+        "20 INPUT K\n"
+        "30 INPUT Z\n"
+        "40 IF N > 50 THEN 60\n"
+        "50 PRINT \"small\"\n"
+        "60 PRINT N + K + Z\n";
+    const Specialization values[] = {{"N", 100.0}, {"K", 7.0}};
+    {
+        Lexer lex(src);
+        Parser parser(lex);
+        auto program = parser.parseProgram();
+        ASSERT_TRUE(AstOptimizer::specializeInputs(program, values));
+        const auto* n = astCast<AssignStmt>(program.lines[1].statements[0].get());
+        ASSERT_NE(n, nullptr);
+        EXPECT_EQ(n->name, "N");
+        const auto* lit = astCast<NumberExpr>(n->value.get());
+        ASSERT_NE(lit, nullptr);
+        EXPECT_EQ(lit->value, 100.0);
+        EXPECT_EQ(lit->type, NumType::Double);
+        EXPECT_FALSE(lit->flexible);
+        const auto* k = astCast<AssignStmt>(program.lines[2].statements[0].get());
+        ASSERT_NE(k, nullptr);
+        EXPECT_EQ(k->name, "K%");
+        EXPECT_NE(astCast<InputStmt>(program.lines[3].statements[0].get()), nullptr);
+        EXPECT_FALSE(AstOptimizer::specializeInputs(program, values));
+    }
+    {
+        Lexer lex(src);
+        Parser parser(lex);
+        auto program = parser.parseProgram();
+        OptOptions options(OptLevel::O0);
+        options.specializations.assign(std::begin(values), std::end(values));
+        const PassStats stats = PassManager::forLevel(options).run(program);
+        ASSERT_EQ(stats.passes.size(), 1u);
+        EXPECT_EQ(stats.passes[0].name, "specialize-inputs");
+        EXPECT_EQ(stats.rounds, 1);
+        EXPECT_EQ(program.lines.size(), 7u);
+    }
+    Lexer lex(src);
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    OptOptions options(OptLevel::O2);
+    options.specializations.assign(std::begin(values), std::end(values));
+    const PassStats stats = PassManager::forLevel(options).run(program);
+    EXPECT_EQ(stats.passes[0].name, "specialize-inputs");
+    EXPECT_EQ(stats.passes[0].changes, 1);
+    for (const auto& line : program.lines) EXPECT_NE(line.number, 50);
+}
@@ -0,0 +1,47 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Specialize Suffix
+ * Purpose: Validate that a bare --specialize name fixes only the variable
+ *          the program spells that way.
+ * Components Under Test: Parser (InputStmt::defTyped),
+ *          AstOptimizer::specializeInputs.
+ * Expected Behavior: With no DEF, "N" replaces INPUT N but not INPUT N%,
+ *          and "M!" replaces INPUT M! but not INPUT M. Under DEFINT K the
+ *          bare "K" covers INPUT K% as well as INPUT K.
+ */
+TEST(OptimizerSpecialize, BareNameKeepsSuffixedVariables) {
+    const char* src =
+        "10 INPUT N\n"
+        "20 INPUT N%\n"
+        "30 INPUT M\n"
+        "40 INPUT M!\n"
+        "50 DEFINT K\n"
+        "60 INPUT K%\n"
+        "70 PRINT N + N% + M + M! + K%\n";
+    const Specialization values[] = {{"N", 5.0}, {"M!", 2.0}, {"K", 7.0}};
+    Lexer lex(src);
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    ASSERT_TRUE(AstOptimizer::specializeInputs(program, values));
+    const auto* n = astCast<AssignStmt>(program.lines[0].statements[0].get());
+    ASSERT_NE(n, nullptr);
+    EXPECT_EQ(n->name, "N");
+    const auto* nInt = astCast<InputStmt>(program.lines[1].statements[0].get());
+    ASSERT_NE(nInt, nullptr);
+    EXPECT_EQ(nInt->name, "N%");
+    EXPECT_NE(astCast<InputStmt>(program.lines[2].statements[0].get()), nullptr);
+    const auto* m = astCast<AssignStmt>(program.lines[3].statements[0].get());
+    ASSERT_NE(m, nullptr);
+    EXPECT_EQ(m->name, "M!");
+    const auto* k = astCast<AssignStmt>(program.lines[5].statements[0].get());
+    ASSERT_NE(k, nullptr);
+    EXPECT_EQ(k->name, "K%");
+}
@@ -13,10 +13,10 @@ using namespace gwbasic;
  */
 TEST(OptimizerExpr, UnaryPlusMinusFolding) {
     auto ir = Compiler::compileStringOptimized("10 PRINT +1\n20 END\n");
-    EXPECT_NE(ir.find(", double 1.0)"), std::string::npos);
+    EXPECT_NE(ir.find("@rt_print_num(double 1.0)"), std::string::npos);
     EXPECT_EQ(ir.find(" = fsub double 0.0"), std::string::npos);
 
     ir = Compiler::compileStringOptimized("10 PRINT -(2)\n20 END\n");
-    EXPECT_NE(ir.find(", double -2.0)"), std::string::npos);
+    EXPECT_NE(ir.find("@rt_print_num(double -2.0)"), std::string::npos);
 }
 
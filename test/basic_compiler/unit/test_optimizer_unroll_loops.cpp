@@ -0,0 +1,61 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/AstOptimizer.h"
+
+using namespace gwbasic;
+
+/*
+ * Test Suite: Optimizer Loop Unrolling
+ * Purpose: Validate full and partial unrolling of FOR loops with literal
+ *          limits under a node budget.
+ * Components Under Test: AstOptimizer::unrollLoops (unrollLoop,
+ *          constantTrips).
+ * Expected Behavior: With a budget of 32, line 10 (3 iterations of a
+ *          4-node body) becomes I = 1, body, I = 2, body, I = 3, body,
+ *          I = 4. Line 20 (100 iterations) keeps a loop over 12 groups of
+ *          8 with STEP 8, whose second copy prints J + 1, followed by the
+ *          4 remaining iterations and J = 101. Line 30 reads a runtime
+ *          limit and stays. A second run leaves the unrolled loop alone.
+ */
+TEST(OptimizerUnroll, FullAndPartial) {
+    Lexer lex(
+        "10 FOR I = 1 TO 3: PRINT I * 2: NEXT I\n"
+        "20 FOR J = 1 TO 100: PRINT J: NEXT J\n"
+        "30 INPUT N: FOR K = 1 TO N: PRINT K: NEXT K\n");
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    ASSERT_TRUE(AstOptimizer::unrollLoops(program, 32));
+
+    const auto& line10 = program.lines[0].statements;
+    ASSERT_EQ(line10.size(), 7u);
+    for (std::size_t k = 0; k < 4; ++k) {
+        const auto* asg = astCast<AssignStmt>(line10[2 * k].get());
+        ASSERT_NE(asg, nullptr);
+        EXPECT_EQ(asg->name, "I");
+        const auto* n = astCast<NumberExpr>(asg->value.get());
+        ASSERT_NE(n, nullptr);
+        EXPECT_DOUBLE_EQ(n->value, static_cast<double>(k + 1));
+    }
+    EXPECT_NE(astCast<PrintStmt>(line10[1].get()), nullptr);
+
+    const auto& line20 = program.lines[1].statements;
+    ASSERT_EQ(line20.size(), 1u + 4u * 2u + 1u);
+    const auto* main = astCast<ForStmt>(line20[0].get());
+    ASSERT_NE(main, nullptr);
+    EXPECT_EQ(main->unrolled, 8);
+    EXPECT_EQ(main->body.size(), 8u);
+    EXPECT_DOUBLE_EQ(astCast<NumberExpr>(main->end.get())->value, 89.0);
+    EXPECT_DOUBLE_EQ(astCast<NumberExpr>(main->step.get())->value, 8.0);
+    const auto* shifted = astCast<BinaryExpr>(astCast<PrintStmt>(main->body[1].get())->value.get());
+    ASSERT_NE(shifted, nullptr);
+    EXPECT_EQ(shifted->op, BinaryOp::Add);
+    const auto* exit = astCast<AssignStmt>(line20.back().get());
+    ASSERT_NE(exit, nullptr);
+    EXPECT_DOUBLE_EQ(astCast<NumberExpr>(exit->value.get())->value, 101.0);
+
+    EXPECT_NE(astCast<ForStmt>(program.lines[2].statements[1].get()), nullptr);
+    EXPECT_FALSE(AstOptimizer::unrollLoops(program, 32));
+}
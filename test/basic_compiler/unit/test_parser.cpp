@@ -21,7 +21,7 @@ TEST(Parser, ParseSimpleProgram) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 5u);
     EXPECT_EQ(lines[0].number, 10);
     EXPECT_FALSE(lines[0].statements.empty());
@@ -18,10 +18,10 @@ TEST(Parser, AssignImplicitWithoutLet) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
     ASSERT_EQ(lines[0].statements.size(), 1u);
-    auto* as = dynamic_cast<AssignStmt*>(lines[0].statements[0].get());
+    auto* as = astCast<AssignStmt>(lines[0].statements[0].get());
     ASSERT_NE(as, nullptr);
     EXPECT_EQ(as->name, "A");
 }
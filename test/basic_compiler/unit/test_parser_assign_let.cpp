@@ -21,20 +21,20 @@ TEST(Parser, AssignWithLetAndPrecedence) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
     ASSERT_EQ(lines[0].statements.size(), 1u);
-    auto* as = dynamic_cast<AssignStmt*>(lines[0].statements[0].get());
+    auto* as = astCast<AssignStmt>(lines[0].statements[0].get());
     ASSERT_NE(as, nullptr);
     EXPECT_EQ(as->name, "A");
     // Expect 1 + (2 * 3)
-    auto* add = dynamic_cast<BinaryExpr*>(as->value.get());
+    auto* add = astCast<BinaryExpr>(as->value.get());
     ASSERT_NE(add, nullptr);
     EXPECT_EQ(add->op, BinaryOp::Add);
-    auto* one = dynamic_cast<NumberExpr*>(add->lhs.get());
+    auto* one = astCast<NumberExpr>(add->lhs.get());
     ASSERT_NE(one, nullptr);
     EXPECT_DOUBLE_EQ(one->value, 1.0);
-    auto* mul = dynamic_cast<BinaryExpr*>(add->rhs.get());
+    auto* mul = astCast<BinaryExpr>(add->rhs.get());
     ASSERT_NE(mul, nullptr);
     EXPECT_EQ(mul->op, BinaryOp::Mul);
 }
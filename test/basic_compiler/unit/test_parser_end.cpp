@@ -18,8 +18,8 @@ TEST(Parser, EndStmt) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
-    auto* es = dynamic_cast<EndStmt*>(lines[0].statements[0].get());
+    auto* es = astCast<EndStmt>(lines[0].statements[0].get());
     ASSERT_NE(es, nullptr);
 }
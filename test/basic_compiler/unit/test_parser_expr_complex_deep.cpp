@@ -20,23 +20,23 @@ TEST(Parser, ExprComplexDeep) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
-    auto* as = dynamic_cast<AssignStmt*>(lines[0].statements[0].get());
+    auto* as = astCast<AssignStmt>(lines[0].statements[0].get());
     ASSERT_NE(as, nullptr);
-    auto* mul = dynamic_cast<BinaryExpr*>(as->value.get());
+    auto* mul = astCast<BinaryExpr>(as->value.get());
     ASSERT_NE(mul, nullptr);
     EXPECT_EQ(mul->op, BinaryOp::Mul);
-    auto* left = dynamic_cast<BinaryExpr*>(mul->lhs.get());
+    auto* left = astCast<BinaryExpr>(mul->lhs.get());
     ASSERT_NE(left, nullptr);
     EXPECT_EQ(left->op, BinaryOp::Add);
-    auto* right = dynamic_cast<BinaryExpr*>(mul->rhs.get());
+    auto* right = astCast<BinaryExpr>(mul->rhs.get());
     ASSERT_NE(right, nullptr);
     EXPECT_EQ(right->op, BinaryOp::Sub);
-    auto* div = dynamic_cast<BinaryExpr*>(right->rhs.get());
+    auto* div = astCast<BinaryExpr>(right->rhs.get());
     ASSERT_NE(div, nullptr);
     EXPECT_EQ(div->op, BinaryOp::Div);
-    auto* addInner = dynamic_cast<BinaryExpr*>(div->rhs.get());
+    auto* addInner = astCast<BinaryExpr>(div->rhs.get());
     ASSERT_NE(addInner, nullptr);
     EXPECT_EQ(addInner->op, BinaryOp::Add);
 }
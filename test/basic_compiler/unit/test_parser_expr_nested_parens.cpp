@@ -21,23 +21,23 @@ TEST(Parser, ExprNestedParentheses) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
-    auto* as = dynamic_cast<AssignStmt*>(lines[0].statements[0].get());
+    auto* as = astCast<AssignStmt>(lines[0].statements[0].get());
     ASSERT_NE(as, nullptr);
-    auto* addOuter = dynamic_cast<BinaryExpr*>(as->value.get());
+    auto* addOuter = astCast<BinaryExpr>(as->value.get());
     ASSERT_NE(addOuter, nullptr);
     EXPECT_EQ(addOuter->op, BinaryOp::Add);
-    auto* one = dynamic_cast<NumberExpr*>(addOuter->lhs.get());
+    auto* one = astCast<NumberExpr>(addOuter->lhs.get());
     ASSERT_NE(one, nullptr);
     EXPECT_DOUBLE_EQ(one->value, 1.0);
-    auto* mul = dynamic_cast<BinaryExpr*>(addOuter->rhs.get());
+    auto* mul = astCast<BinaryExpr>(addOuter->rhs.get());
     ASSERT_NE(mul, nullptr);
     EXPECT_EQ(mul->op, BinaryOp::Mul);
-    auto* two = dynamic_cast<NumberExpr*>(mul->lhs.get());
+    auto* two = astCast<NumberExpr>(mul->lhs.get());
     ASSERT_NE(two, nullptr);
     EXPECT_DOUBLE_EQ(two->value, 2.0);
-    auto* addInner = dynamic_cast<BinaryExpr*>(mul->rhs.get());
+    auto* addInner = astCast<BinaryExpr>(mul->rhs.get());
     ASSERT_NE(addInner, nullptr);
     EXPECT_EQ(addInner->op, BinaryOp::Add);
 }
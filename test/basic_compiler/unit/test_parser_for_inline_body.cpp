@@ -21,16 +21,16 @@ TEST(Parser, ForNextInlineBody) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
     ASSERT_EQ(lines[0].statements.size(), 1u);
-    auto* fs = dynamic_cast<ForStmt*>(lines[0].statements[0].get());
+    auto* fs = astCast<ForStmt>(lines[0].statements[0].get());
     ASSERT_NE(fs, nullptr);
     EXPECT_EQ(fs->var, "I");
     ASSERT_EQ(fs->body.size(), 1u);
-    auto* pr = dynamic_cast<PrintStmt*>(fs->body[0].get());
+    auto* pr = astCast<PrintStmt>(fs->body[0].get());
     ASSERT_NE(pr, nullptr);
-    auto* ve = dynamic_cast<VarExpr*>(pr->value.get());
+    auto* ve = astCast<VarExpr>(pr->value.get());
     ASSERT_NE(ve, nullptr);
     EXPECT_EQ(ve->name, "I");
 }
@@ -19,13 +19,13 @@ TEST(Parser, ForWithStep) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
     ASSERT_EQ(lines[0].statements.size(), 1u);
-    auto* fs = dynamic_cast<ForStmt*>(lines[0].statements[0].get());
+    auto* fs = astCast<ForStmt>(lines[0].statements[0].get());
     ASSERT_NE(fs, nullptr);
     ASSERT_NE(fs->step, nullptr);
-    auto* stepNum = dynamic_cast<NumberExpr*>(fs->step.get());
+    auto* stepNum = astCast<NumberExpr>(fs->step.get());
     ASSERT_NE(stepNum, nullptr);
     EXPECT_DOUBLE_EQ(stepNum->value, 2.0);
 }
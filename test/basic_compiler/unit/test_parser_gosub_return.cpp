@@ -19,11 +19,11 @@ TEST(Parser, GosubAndReturn) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 2u);
-    auto* gs = dynamic_cast<GosubStmt*>(lines[0].statements[0].get());
+    auto* gs = astCast<GosubStmt>(lines[0].statements[0].get());
     ASSERT_NE(gs, nullptr);
     EXPECT_EQ(gs->targetLine, 300);
-    auto* rs = dynamic_cast<ReturnStmt*>(lines[1].statements[0].get());
+    auto* rs = astCast<ReturnStmt>(lines[1].statements[0].get());
     ASSERT_NE(rs, nullptr);
 }
@@ -18,9 +18,9 @@ TEST(Parser, Goto) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
-    auto* gs = dynamic_cast<GotoStmt*>(lines[0].statements[0].get());
+    auto* gs = astCast<GotoStmt>(lines[0].statements[0].get());
     ASSERT_NE(gs, nullptr);
     EXPECT_EQ(gs->targetLine, 200);
 }
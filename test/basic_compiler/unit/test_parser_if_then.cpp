@@ -19,12 +19,12 @@ TEST(Parser, IfThenComparison) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
     ASSERT_EQ(lines[0].statements.size(), 1u);
-    auto* is = dynamic_cast<IfStmt*>(lines[0].statements[0].get());
+    auto* is = astCast<IfStmt>(lines[0].statements[0].get());
     ASSERT_NE(is, nullptr);
     EXPECT_EQ(is->targetLine, 50);
-    auto* cmp = dynamic_cast<BinaryExpr*>(is->cond.get());
+    auto* cmp = astCast<BinaryExpr>(is->cond.get());
     ASSERT_NE(cmp, nullptr);
 }
@@ -18,9 +18,9 @@ TEST(Parser, InputStmt) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
-    auto* is = dynamic_cast<InputStmt*>(lines[0].statements[0].get());
+    auto* is = astCast<InputStmt>(lines[0].statements[0].get());
     ASSERT_NE(is, nullptr);
     EXPECT_EQ(is->name, "X");
 }
@@ -19,12 +19,12 @@ TEST(Parser, PrintString) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
     ASSERT_EQ(lines[0].statements.size(), 1u);
-    auto* ps = dynamic_cast<PrintStmt*>(lines[0].statements[0].get());
+    auto* ps = astCast<PrintStmt>(lines[0].statements[0].get());
     ASSERT_NE(ps, nullptr);
-    auto* se = dynamic_cast<StringExpr*>(ps->value.get());
+    auto* se = astCast<StringExpr>(ps->value.get());
     ASSERT_NE(se, nullptr);
     EXPECT_EQ(se->value, "Hello");
 }
@@ -0,0 +1,43 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/codegen/CodeGenerator.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Parser Streaming Lexer
+ * Purpose: Verify the parser can pull tokens directly from a Lexer without
+ *          a materialized token vector.
+ * Components Under Test: Lexer::next, TokenStream, Parser(Lexer&).
+ * Expected Behavior: Streaming and vector-fed parses of the same program
+ *          generate identical IR; a lexical error after valid lines is
+ *          raised from parseProgram() as LexError.
+ */
+TEST(Parser, StreamingLexerMatchesTokenVector) {
+    const std::string src =
+        "10 LET A = 1\n"
+        "20 FOR I = 1 TO 3 STEP 1 : PRINT I : NEXT I\n"
+        "30 IF A <> 2 THEN 50\n"
+        "40 GOSUB 60\n"
+        "50 END\n"
+        "60 PRINT A * (2 + 3) : RETURN\n";
+
+    Lexer vecLex(src);
+    Parser vecParser(vecLex.tokenize());
+    auto vecProg = vecParser.parseProgram();
+
+    Lexer streamLex(src);
+    Parser streamParser(streamLex);
+    auto streamProg = streamParser.parseProgram();
+
+    ASSERT_EQ(streamProg.lines.size(), vecProg.lines.size());
+    CodeGenerator g1, g2;
+    EXPECT_EQ(g2.generate(streamProg), g1.generate(vecProg));
+
+    Lexer badLex("10 PRINT 1\n20 PRINT 2 ? 3\n");
+    Parser badParser(badLex);
+    EXPECT_THROW(badParser.parseProgram(), LexError);
+}
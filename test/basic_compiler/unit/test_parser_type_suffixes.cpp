@@ -0,0 +1,45 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/ast/AssignStmt.h"
+#include "basic_compiler/ast/VarExpr.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Parser type suffixes
+ * Purpose: Validate that %, ! and # suffixes and DEFINT/DEFSNG/DEFDBL give
+ *          variables their canonical typed names.
+ * Components Under Test: Lexer identifierOrKeyword, Parser parseDefType,
+ *          internVar.
+ * Expected Behavior: "A#" and an undeclared "A" are the same Double name;
+ *          DEFINT I-K makes "J" the Int "J%" while "J!" stays Single; the
+ *          declaration adds no statement; a bad letter list throws.
+ */
+TEST(Parser, TypeSuffixesAndDefint) {
+    std::string src =
+        "10 A# = 1: B = A\n"
+        "20 DEFINT I-K: J = 2: J! = J\n";
+    Lexer lex(src);
+    Parser p(lex);
+    auto [lines, arena] = p.parseProgram();
+    ASSERT_EQ(lines.size(), 2u);
+    ASSERT_EQ(lines[1].statements.size(), 2u);
+    auto* a = astCast<AssignStmt>(lines[0].statements[0].get());
+    auto* b = astCast<AssignStmt>(lines[0].statements[1].get());
+    auto* j = astCast<AssignStmt>(lines[1].statements[0].get());
+    auto* js = astCast<AssignStmt>(lines[1].statements[1].get());
+    ASSERT_TRUE(a && b && j && js);
+    EXPECT_EQ(a->name, "A");
+    EXPECT_EQ(static_cast<const VarExpr*>(b->value.get())->name, "A");
+    EXPECT_EQ(j->name, "J%");
+    EXPECT_EQ(js->name, "J!");
+    EXPECT_EQ(js->value->type, NumType::Int);
+
+    std::string bad = "10 DEFINT 1\n";
+    Lexer badLex(bad);
+    Parser badParser(badLex);
+    EXPECT_THROW(badParser.parseProgram(), ParseError);
+}
@@ -22,17 +22,17 @@ TEST(Parser, UnaryMinusBasic) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
-    auto* as = dynamic_cast<AssignStmt*>(lines[0].statements[0].get());
+    auto* as = astCast<AssignStmt>(lines[0].statements[0].get());
     ASSERT_NE(as, nullptr);
-    auto* add = dynamic_cast<BinaryExpr*>(as->value.get());
+    auto* add = astCast<BinaryExpr>(as->value.get());
     ASSERT_NE(add, nullptr);
     EXPECT_EQ(add->op, BinaryOp::Add);
-    auto* un = dynamic_cast<UnaryExpr*>(add->lhs.get());
+    auto* un = astCast<UnaryExpr>(add->lhs.get());
     ASSERT_NE(un, nullptr);
     EXPECT_EQ(un->op, '-');
-    auto* num2 = dynamic_cast<NumberExpr*>(add->rhs.get());
+    auto* num2 = astCast<NumberExpr>(add->rhs.get());
     ASSERT_NE(num2, nullptr);
     EXPECT_DOUBLE_EQ(num2->value, 2.0);
 }
@@ -21,14 +21,14 @@ TEST(Parser, UnaryPlusNoop) {
     Lexer lex(src);
     auto toks = lex.tokenize();
     Parser p(std::move(toks));
-    auto [lines] = p.parseProgram();
+    auto [lines, arena] = p.parseProgram();
     ASSERT_EQ(lines.size(), 1u);
-    auto* as = dynamic_cast<AssignStmt*>(lines[0].statements[0].get());
+    auto* as = astCast<AssignStmt>(lines[0].statements[0].get());
     ASSERT_NE(as, nullptr);
-    auto* mul = dynamic_cast<BinaryExpr*>(as->value.get());
+    auto* mul = astCast<BinaryExpr>(as->value.get());
     ASSERT_NE(mul, nullptr);
     EXPECT_EQ(mul->op, BinaryOp::Mul);
-    auto* un = dynamic_cast<UnaryExpr*>(mul->lhs.get());
+    auto* un = astCast<UnaryExpr>(mul->lhs.get());
     ASSERT_NE(un, nullptr);
     EXPECT_EQ(un->op, '+');
 }
@@ -0,0 +1,80 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/Parser.h"
+#include "basic_compiler/opt/PassManager.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: Pass Manager
+ * Purpose: Verify the -O pipelines: -O0 runs nothing, -O2 iterates until a
+ *          round changes nothing, and statistics record what each pass did.
+ * Components Under Test: PassManager::forLevel/run, PassStats::print,
+ *          parseOptLevel, optLevelFlag, effectiveUnrollThreshold.
+ * Expected Behavior: --unroll-threshold overrides the level's unroll
+ *          budget at -O2 and above only. At -O2, round 1 folds the IF into
+ *          a GOTO (simplify) and drops line 20 (dead lines); there are no
+ *          variables for the dataflow passes and no loop to close, unroll
+ *          or hoist from; round 2 changes nothing, so the pipeline
+ *          converges after two rounds. -O0 leaves every line.
+ */
+TEST(PassManager, LevelsAndFixpointStats) {
+    const char* src =
+        "10 IF 2 > 1 THEN 30\n"
+        "20 PRINT \"skipped\"\n"
+        "30 PRINT 1 + 2\n"
+        "40 END\n";
+    OptLevel level = OptLevel::O0;
+    ASSERT_TRUE(parseOptLevel("-O2", level));
+    EXPECT_EQ(level, OptLevel::O2);
+    EXPECT_STREQ(optLevelFlag(level), "-O2");
+    EXPECT_TRUE(parseOptLevel("-Os", level));
+    EXPECT_FALSE(parseOptLevel("-O", level));
+    EXPECT_FALSE(parseOptLevel("-O4", level));
+    EXPECT_EQ(effectiveUnrollThreshold(OptLevel::O2), 128);
+    EXPECT_EQ(effectiveUnrollThreshold(OptLevel::Os), 0);
+    OptOptions tuned(OptLevel::O1);
+    tuned.unrollThreshold = 300;
+    EXPECT_EQ(effectiveUnrollThreshold(tuned), 0);
+    tuned.level = OptLevel::O3;
+    EXPECT_EQ(effectiveUnrollThreshold(tuned), 300);
+
+    {
+        Lexer lex(src);
+        Parser parser(lex);
+        auto program = parser.parseProgram();
+        const PassStats stats = PassManager::forLevel(OptLevel::O0).run(program);
+        EXPECT_TRUE(stats.passes.empty());
+        EXPECT_EQ(program.lines.size(), 4u);
+    }
+
+    Lexer lex(src);
+    Parser parser(lex);
+    auto program = parser.parseProgram();
+    const PassStats stats = PassManager::forLevel(OptLevel::O2).run(program);
+    ASSERT_EQ(stats.passes.size(), 9u);
+    EXPECT_EQ(stats.passes[0].name, "simplify-stmts");
+    EXPECT_EQ(stats.passes[0].runs, 2);
+    EXPECT_EQ(stats.passes[0].changes, 1);
+    EXPECT_EQ(stats.passes[1].name, "propagate-constants");
+    EXPECT_EQ(stats.passes[3].name, "close-recurrences");
+    EXPECT_EQ(stats.passes[4].name, "unroll-loops");
+    EXPECT_EQ(stats.passes[6].name, "remove-dead-stores");
+    for (std::size_t i = 1; i <= 6; ++i) EXPECT_EQ(stats.passes[i].changes, 0) << stats.passes[i].name;
+    EXPECT_EQ(stats.passes[7].name, "remove-dead-lines");
+    EXPECT_EQ(stats.passes[7].changes, 1);
+    EXPECT_EQ(stats.passes[8].name, "hoist-loop-invariants");
+    EXPECT_EQ(stats.passes[8].changes, 0);
+    EXPECT_EQ(stats.rounds, 2);
+    EXPECT_TRUE(stats.converged);
+    ASSERT_EQ(program.lines.size(), 3u);
+    EXPECT_EQ(program.lines[1].number, 30);
+
+    std::ostringstream os;
+    stats.print(os);
+    EXPECT_NE(os.str().find("remove-dead-lines"), std::string::npos);
+    EXPECT_NE(os.str().find("2 rounds, fixpoint reached"), std::string::npos);
+}
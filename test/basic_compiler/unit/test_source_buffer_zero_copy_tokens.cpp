@@ -0,0 +1,44 @@
+// (c) 2025 Sam Caldwell. All Rights Reserved.
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "basic_compiler/Lexer.h"
+#include "basic_compiler/SourceBuffer.h"
+
+using namespace gwbasic;
+/*
+ * Test Suite: SourceBuffer Zero-Copy Tokens
+ * Purpose: Verify that a source file is memory-mapped and that token
+ *          lexemes are views into the mapping rather than owned copies.
+ * Components Under Test: SourceBuffer::mapFile, Lexer::tokenize.
+ * Expected Behavior: The buffer reports a mapping; identifier, number and
+ *          string lexemes point inside text(); string lexemes keep their
+ *          escapes until decoded with unescapeStringLiteral().
+ */
+TEST(SourceBuffer, MappedFileTokensViewTheMapping) {
+    const auto path = std::filesystem::temp_directory_path() / "gwbasic_source_buffer_test.bas";
+    { std::ofstream f(path, std::ios::binary); f << "10 LET COUNT = 42\n20 PRINT \"A\\tB\"\n"; }
+
+    const SourceBuffer buf = SourceBuffer::mapFile(path.string());
+    EXPECT_TRUE(buf.isMapped());
+    const std::string_view text = buf.text();
+    ASSERT_EQ(text.substr(0, 5), "10 LE");
+
+    Lexer lex(text);
+    const auto toks = lex.tokenize();
+    const auto inside = [&](std::string_view s) {
+        return s.data() >= text.data() && s.data() + s.size() <= text.data() + text.size();
+    };
+    ASSERT_GE(toks.size(), 9u);
+    EXPECT_EQ(toks[2].lexeme, "COUNT");
+    EXPECT_TRUE(inside(toks[2].lexeme));
+    EXPECT_EQ(toks[4].lexeme, "42");
+    EXPECT_TRUE(inside(toks[4].lexeme));
+    ASSERT_EQ(toks[8].type, TokenType::String);
+    EXPECT_EQ(toks[8].lexeme, "A\\tB");
+    EXPECT_TRUE(inside(toks[8].lexeme));
+    EXPECT_EQ(unescapeStringLiteral(toks[8].lexeme), "A\tB");
+
+    std::filesystem::remove(path);
+}